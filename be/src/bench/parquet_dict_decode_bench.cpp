@@ -17,6 +17,8 @@
 #include <memory>
 #include <random>
 
+#include "formats/parquet/encoding_byte_stream_split.h"
+#include "formats/parquet/encoding_delta.h"
 #include "formats/parquet/encoding_dict.h"
 #include "formats/parquet/encoding_plain.h"
 
@@ -98,6 +100,73 @@ static void BM_DictDecoder(benchmark::State& state) {
 
 BENCHMARK(BM_DictDecoder)->DenseRange(0, 100, 10)->Unit(benchmark::kMillisecond);
 
+// Decode a page of kTestChunkSize values with `decoder` into a column, `encoder` builds the page.
+template <typename T>
+static void decode_page(benchmark::State& state, Encoder* encoder, Decoder* decoder, const std::vector<T>& values,
+                        const TypeDescriptor& type) {
+    encoder->append(reinterpret_cast<const uint8_t*>(values.data()), values.size());
+    Slice data = encoder->build();
+    ColumnPtr column = ColumnHelper::create_column(type, false);
+    for (auto _ : state) {
+        state.PauseTiming();
+        column->reset_column();
+        state.ResumeTiming();
+        decoder->set_data(data);
+        Status st = decoder->next_batch(values.size(), ColumnContentType::VALUE, column.get());
+        benchmark::DoNotOptimize(st);
+    }
+    state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+// range(0) is the max delta between adjacent values.
+static void BM_DeltaBinaryPackedDecoder(benchmark::State& state) {
+    std::mt19937 rng(0);
+    std::uniform_int_distribution<int64_t> dist(0, state.range(0));
+    std::vector<int64_t> values(kTestChunkSize);
+    for (int i = 1; i < kTestChunkSize; i++) {
+        values[i] = values[i - 1] + dist(rng);
+    }
+    DeltaBinaryPackedEncoder<int64_t> encoder;
+    DeltaBinaryPackedDecoder<int64_t> decoder;
+    decode_page(state, &encoder, &decoder, values, TypeDescriptor{TYPE_BIGINT});
+}
+
+BENCHMARK(BM_DeltaBinaryPackedDecoder)->RangeMultiplier(16)->Range(1, 1 << 20);
+
+static void BM_ByteStreamSplitDecoder(benchmark::State& state) {
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> dist(0, 1000);
+    std::vector<double> values(kTestChunkSize);
+    for (auto& value : values) {
+        value = dist(rng);
+    }
+    ByteStreamSplitEncoder<double> encoder;
+    ByteStreamSplitDecoder<double> decoder;
+    decode_page(state, &encoder, &decoder, values, TypeDescriptor{TYPE_DOUBLE});
+}
+
+BENCHMARK(BM_ByteStreamSplitDecoder);
+
+// range(0) selects DELTA_LENGTH_BYTE_ARRAY(0) or DELTA_BYTE_ARRAY(1)
+static void BM_DeltaByteArrayDecoder(benchmark::State& state) {
+    std::vector<std::string> strings;
+    for (int i = 0; i < kTestChunkSize; i++) {
+        strings.emplace_back("https://www.starrocks.io/docs/" + std::to_string(i / 16) + "/" + std::to_string(i));
+    }
+    std::vector<Slice> values(strings.begin(), strings.end());
+    if (state.range(0) == 0) {
+        DeltaLengthByteArrayEncoder encoder;
+        DeltaLengthByteArrayDecoder decoder;
+        decode_page(state, &encoder, &decoder, values, TypeDescriptor{TYPE_VARCHAR});
+    } else {
+        DeltaByteArrayEncoder encoder;
+        DeltaByteArrayDecoder decoder;
+        decode_page(state, &encoder, &decoder, values, TypeDescriptor{TYPE_VARCHAR});
+    }
+}
+
+BENCHMARK(BM_DeltaByteArrayDecoder)->DenseRange(0, 1);
+
 } // namespace parquet
 } // namespace starrocks
 
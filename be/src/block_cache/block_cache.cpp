@@ -17,6 +17,7 @@
 #include <fmt/format.h>
 
 #include <filesystem>
+#include <limits>
 
 #ifdef WITH_CACHELIB
 #include "block_cache/cachelib_wrapper.h"
@@ -28,6 +29,7 @@
 #include "common/logging.h"
 #include "common/statusor.h"
 #include "gutil/strings/substitute.h"
+#include "util/coding.h"
 
 namespace starrocks {
 
@@ -70,6 +72,8 @@ Status BlockCache::init(const CacheOptions& options) {
         return Status::NotSupported("unsupported block cache engine");
     }
     RETURN_IF_ERROR(_kv_cache->init(cache_options));
+    _admission_ghost = std::make_unique<GhostCache>(config::datacache_ghost_entries);
+    _promotion_ghost = std::make_unique<GhostCache>(config::datacache_ghost_entries);
     _initialized.store(true, std::memory_order_relaxed);
     if (_disk_space_monitor) {
         _disk_space_monitor->start();
@@ -89,9 +93,20 @@ Status BlockCache::write_buffer(const CacheKey& cache_key, off_t offset, const I
 
     size_t index = offset / _block_size;
     std::string block_key = fmt::format("{}/{}", cache_key, index);
+    if (!_admit(block_key)) {
+        return Status::Cancelled("block is not admitted for the first access");
+    }
     return _kv_cache->write_buffer(block_key, buffer, options);
 }
 
+bool BlockCache::_admit(const std::string& block_key) {
+    if (config::datacache_admission_enable && !_admission_ghost->touch(block_key)) {
+        _admission_reject_count.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    return true;
+}
+
 static void empty_deleter(void*) {}
 
 Status BlockCache::write_buffer(const CacheKey& cache_key, off_t offset, size_t size, const char* data,
@@ -121,7 +136,17 @@ Status BlockCache::read_buffer(const CacheKey& cache_key, off_t offset, size_t s
 
     size_t index = offset / _block_size;
     std::string block_key = fmt::format("{}/{}", cache_key, index);
-    return _kv_cache->read_buffer(block_key, offset - index * _block_size, size, buffer, options);
+    // Only the blocks which have been hit before are promoted, so the hot blocks are kept in memory rather than
+    // the ones scanned once.
+    const bool track_hits = options && config::datacache_hot_block_promotion_enable;
+    if (track_hits) {
+        options->promote_to_mem = _promotion_ghost->contains(block_key);
+    }
+    Status st = _kv_cache->read_buffer(block_key, offset - index * _block_size, size, buffer, options);
+    if (track_hits && st.ok()) {
+        _promotion_ghost->touch(block_key);
+    }
+    return st;
 }
 
 StatusOr<size_t> BlockCache::read_buffer(const CacheKey& cache_key, off_t offset, size_t size, char* data,
@@ -136,6 +161,69 @@ Status BlockCache::read_object(const CacheKey& cache_key, DataCacheHandle* handl
     return _kv_cache->read_object(cache_key, handle, options);
 }
 
+// The blob is stored as a 4 bytes length followed by the data, which are split into blocks.
+Status BlockCache::write_blob(const CacheKey& cache_key, const std::string_view& blob, WriteCacheOptions* options) {
+    if (blob.size() > std::numeric_limits<uint32_t>::max()) {
+        return Status::InvalidArgument(strings::Substitute("blob size $0 is too large", blob.size()));
+    }
+    std::string data;
+    data.reserve(sizeof(uint32_t) + blob.size());
+    put_fixed32_le(&data, static_cast<uint32_t>(blob.size()));
+    data.append(blob.data(), blob.size());
+
+    // The blocks are admitted together, otherwise each block of a multi-block blob is rejected on different
+    // writes and the blob is never complete.
+    if (!_admit(fmt::format("{}/0", cache_key))) {
+        return Status::Cancelled("blob is not admitted for the first access");
+    }
+
+    // Write the first block, which holds the length, at last. So a blob can not be read before it's complete.
+    // The other blocks may be left by a previous write which failed before the first block, they are the same
+    // as the ones to write, so only the result of the first block matters.
+    size_t num_blocks = (data.size() + _block_size - 1) / _block_size;
+    for (size_t i = num_blocks; i > 1; i--) {
+        size_t offset = (i - 1) * _block_size;
+        size_t size = std::min(_block_size, data.size() - offset);
+        Status st = _write_block(cache_key, offset, size, data.data() + offset, options);
+        if (!st.ok() && !st.is_already_exist()) {
+            return st;
+        }
+    }
+    return _write_block(cache_key, 0, std::min(_block_size, data.size()), data.data(), options);
+}
+
+Status BlockCache::_write_block(const CacheKey& cache_key, off_t offset, size_t size, const char* data,
+                                WriteCacheOptions* options) {
+    IOBuffer buffer;
+    buffer.append_user_data((void*)data, size, empty_deleter);
+    std::string block_key = fmt::format("{}/{}", cache_key, offset / _block_size);
+    return _kv_cache->write_buffer(block_key, buffer, options);
+}
+
+StatusOr<std::string> BlockCache::read_blob(const CacheKey& cache_key, ReadCacheOptions* options) {
+    uint8_t header[sizeof(uint32_t)];
+    ASSIGN_OR_RETURN(size_t read_size, read_buffer(cache_key, 0, sizeof(header), (char*)header, options));
+    if (read_size != sizeof(header)) {
+        return Status::Corruption(strings::Substitute("invalid blob header size $0", read_size));
+    }
+    uint32_t length = decode_fixed32_le(header);
+
+    std::string blob;
+    blob.resize(length);
+    size_t offset = sizeof(header);
+    size_t end = sizeof(header) + length;
+    while (offset < end) {
+        size_t size = std::min((offset / _block_size + 1) * _block_size, end) - offset;
+        char* dst = blob.data() + offset - sizeof(header);
+        ASSIGN_OR_RETURN(read_size, read_buffer(cache_key, offset, size, dst, options));
+        if (read_size != size) {
+            return Status::Corruption(strings::Substitute("invalid blob block size $0, expected $1", read_size, size));
+        }
+        offset += size;
+    }
+    return blob;
+}
+
 Status BlockCache::remove(const CacheKey& cache_key, off_t offset, size_t size) {
     if (offset % _block_size != 0) {
         LOG(WARNING) << "remove block key: " << cache_key << " with invalid args, offset: " << offset
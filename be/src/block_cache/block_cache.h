@@ -17,8 +17,10 @@
 #include <atomic>
 
 #include "block_cache/disk_space_monitor.h"
+#include "block_cache/ghost_cache.h"
 #include "block_cache/kv_cache.h"
 #include "common/status.h"
+#include "common/statusor.h"
 
 namespace starrocks {
 
@@ -35,7 +37,9 @@ public:
     // Init the block cache instance
     Status init(const CacheOptions& options);
 
-    // Write data buffer to cache, the `offset` must be aligned by block size
+    // Write data buffer to cache, the `offset` must be aligned by block size.
+    // If admission is enabled, a block accessed for the first time within the window is not admitted and
+    // `Status::Cancelled` is returned.
     Status write_buffer(const CacheKey& cache_key, off_t offset, const IOBuffer& buffer,
                         WriteCacheOptions* options = nullptr);
 
@@ -59,6 +63,14 @@ public:
     // function, the corresponding pointer will never be freed by the cache system.
     Status read_object(const CacheKey& cache_key, DataCacheHandle* handle, ReadCacheOptions* options = nullptr);
 
+    // Write a small object with variable size, such as the raw bytes of file footer, as data blocks. Unlike
+    // `write_object`, it can be written to the disk cache and survives restart.
+    // If admission is enabled, the blob is admitted or rejected as a whole, by the access of its first block.
+    Status write_blob(const CacheKey& cache_key, const std::string_view& blob, WriteCacheOptions* options = nullptr);
+
+    // Read the whole object written by `write_blob`.
+    StatusOr<std::string> read_blob(const CacheKey& cache_key, ReadCacheOptions* options = nullptr);
+
     // Remove data from cache. The offset and size must be aligned by block size
     Status remove(const CacheKey& cache_key, off_t offset, size_t size);
 
@@ -88,14 +100,27 @@ public:
 
     static const size_t MAX_BLOCK_SIZE;
 
+    int64_t admission_reject_count() const { return _admission_reject_count.load(std::memory_order_relaxed); }
+
 private:
 #ifndef BE_TEST
     BlockCache() = default;
 #endif
 
+    // Whether the block is admitted to cache, always true if admission is disabled.
+    bool _admit(const std::string& block_key);
+
+    // Write the block without admission.
+    Status _write_block(const CacheKey& cache_key, off_t offset, size_t size, const char* data,
+                        WriteCacheOptions* options);
+
     size_t _block_size = 0;
     std::unique_ptr<KvCache> _kv_cache;
     std::unique_ptr<DiskSpaceMonitor> _disk_space_monitor;
+    // Ghost entries of the blocks written and read recently, for admission and promotion respectively.
+    std::unique_ptr<GhostCache> _admission_ghost;
+    std::unique_ptr<GhostCache> _promotion_ghost;
+    std::atomic<int64_t> _admission_reject_count = 0;
     std::atomic<bool> _initialized = false;
 };
 
@@ -65,6 +65,8 @@ struct WriteCacheOptions {
 
 struct ReadCacheOptions {
     bool use_adaptor = false;
+    // Whether to promote the data to memory if it's read from disk, only works when the tiered cache is enabled.
+    bool promote_to_mem = true;
 
     struct Stats {
         int64_t read_mem_bytes = 0;
@@ -0,0 +1,49 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "block_cache/ghost_cache.h"
+
+#include <algorithm>
+
+#include "util/hash_util.hpp"
+
+namespace starrocks {
+
+GhostCache::GhostCache(size_t capacity)
+        : _capacity(std::max<size_t>(capacity, 1)), _slots(new std::atomic<uint64_t>[_capacity]) {
+    for (size_t i = 0; i < _capacity; i++) {
+        _slots[i].store(0, std::memory_order_relaxed);
+    }
+}
+
+uint64_t GhostCache::_fingerprint(std::string_view key) {
+    return HashUtil::xx_hash64(key.data(), key.size(), 0) | 1;
+}
+
+bool GhostCache::touch(std::string_view key) {
+    uint64_t fingerprint = _fingerprint(key);
+    auto& slot = _slots[fingerprint % _capacity];
+    if (slot.load(std::memory_order_relaxed) == fingerprint) {
+        return true;
+    }
+    slot.store(fingerprint, std::memory_order_relaxed);
+    return false;
+}
+
+bool GhostCache::contains(std::string_view key) const {
+    uint64_t fingerprint = _fingerprint(key);
+    return _slots[fingerprint % _capacity].load(std::memory_order_relaxed) == fingerprint;
+}
+
+} // namespace starrocks
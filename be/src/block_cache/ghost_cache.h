@@ -0,0 +1,50 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+
+namespace starrocks {
+
+// GhostCache remembers the recently accessed keys without their values, like the ghost entries of ARC or 2Q.
+// It is used to tell whether a block has been accessed more than once within a window.
+//
+// Only the 64 bits fingerprints of keys are kept in a direct-mapped table, a new key overwrites the slot of an
+// old one. So the window is about the last `capacity` distinct keys, and a false positive of a new key is
+// very rare. It's lock free and costs 8 bytes per entry.
+class GhostCache {
+public:
+    explicit GhostCache(size_t capacity);
+
+    // Record an access of `key`, return true if it has been accessed within the window.
+    bool touch(std::string_view key);
+
+    // Return true if `key` has been accessed within the window, without recording the access.
+    bool contains(std::string_view key) const;
+
+    size_t capacity() const { return _capacity; }
+
+private:
+    // 0 means an empty slot, so the lowest bit is always set.
+    static uint64_t _fingerprint(std::string_view key);
+
+    size_t _capacity;
+    std::unique_ptr<std::atomic<uint64_t>[]> _slots;
+};
+
+} // namespace starrocks
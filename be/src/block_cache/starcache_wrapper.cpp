@@ -100,8 +100,8 @@ Status StarCacheWrapper::read_buffer(const std::string& key, size_t off, size_t
     }
     starcache::ReadOptions opts;
     opts.use_adaptor = options->use_adaptor;
-    opts.mode = _enable_tiered_cache ? starcache::ReadOptions::ReadMode::READ_BACK
-                                     : starcache::ReadOptions::ReadMode::READ_THROUGH;
+    opts.mode = _enable_tiered_cache && options->promote_to_mem ? starcache::ReadOptions::ReadMode::READ_BACK
+                                                                : starcache::ReadOptions::ReadMode::READ_THROUGH;
     auto st = to_status(_cache->read(key, off, size, &buffer->raw_buf(), &opts));
     if (st.ok()) {
         options->stats.read_mem_bytes = opts.stats.read_mem_bytes;
@@ -0,0 +1,64 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "block_cache/table_cache_metrics.h"
+
+#include "util/starrocks_metrics.h"
+
+namespace starrocks {
+
+TableCacheMetrics::Metrics::Metrics()
+        : hit_bytes(MetricUnit::BYTES), miss_bytes(MetricUnit::BYTES), hit_ratio(MetricUnit::PERCENT) {}
+
+TableCacheMetrics* TableCacheMetrics::instance() {
+    static TableCacheMetrics metrics;
+    return &metrics;
+}
+
+void TableCacheMetrics::update(const std::string& table_name, int64_t hit_bytes, int64_t miss_bytes) {
+    if (table_name.empty() || hit_bytes + miss_bytes <= 0) {
+        return;
+    }
+    std::lock_guard l(_mutex);
+    auto iter = _metrics.find(table_name);
+    if (iter == _metrics.end()) {
+        if (_metrics.size() >= MAX_TABLES) {
+            return;
+        }
+        auto metrics = std::make_unique<Metrics>();
+        auto* registry = StarRocksMetrics::instance()->metrics();
+        MetricLabels labels = MetricLabels().add("table", table_name);
+        registry->register_metric("datacache_table_hit_bytes", labels, &metrics->hit_bytes);
+        registry->register_metric("datacache_table_miss_bytes", labels, &metrics->miss_bytes);
+        registry->register_metric("datacache_table_hit_ratio", labels, &metrics->hit_ratio);
+        iter = _metrics.emplace(table_name, std::move(metrics)).first;
+    }
+    auto& metrics = iter->second;
+    metrics->hit_bytes.increment(hit_bytes);
+    metrics->miss_bytes.increment(miss_bytes);
+    int64_t total_hit = metrics->hit_bytes.value();
+    int64_t total = total_hit + metrics->miss_bytes.value();
+    metrics->hit_ratio.set_value(static_cast<double>(total_hit) * 100 / total);
+}
+
+double TableCacheMetrics::hit_ratio(const std::string& table_name) {
+    std::lock_guard l(_mutex);
+    auto iter = _metrics.find(table_name);
+    if (iter == _metrics.end()) {
+        return -1;
+    }
+    return iter->second->hit_ratio.value();
+}
+
+} // namespace starrocks
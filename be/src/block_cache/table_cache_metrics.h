@@ -0,0 +1,52 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "util/metrics.h"
+
+namespace starrocks {
+
+// Datacache hit and miss bytes of each external table, exposed as metrics with a `table` label.
+class TableCacheMetrics {
+public:
+    // Limit the number of tables to avoid too many metrics.
+    static constexpr size_t MAX_TABLES = 1024;
+
+    static TableCacheMetrics* instance();
+
+    void update(const std::string& table_name, int64_t hit_bytes, int64_t miss_bytes);
+
+    // Hit ratio of the table in percent, return -1 if the table is not tracked.
+    double hit_ratio(const std::string& table_name);
+
+private:
+    struct Metrics {
+        Metrics();
+
+        IntAtomicCounter hit_bytes;
+        IntAtomicCounter miss_bytes;
+        DoubleGauge hit_ratio;
+    };
+
+    std::mutex _mutex;
+    std::unordered_map<std::string, std::unique_ptr<Metrics>> _metrics;
+};
+
+} // namespace starrocks
@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include "column/binary_view.h"
 #include "column/bytes.h"
 #include "column/column.h"
 #include "column/datum.h"
@@ -33,7 +34,7 @@ public:
     using Offset = T;
     using Offsets = Buffer<T>;
 
-    using Bytes = starrocks::raw::RawVectorPad16<uint8_t>;
+    using Bytes = starrocks::Bytes;
 
     struct BinaryDataProxyContainer {
         BinaryDataProxyContainer(const BinaryColumnBase& column) : _column(column) {}
@@ -46,6 +47,17 @@ public:
         const BinaryColumnBase& _column;
     };
 
+    struct BinaryViewProxyContainer {
+        BinaryViewProxyContainer(const BinaryColumnBase& column) : _column(column) {}
+
+        BinaryView operator[](size_t index) const { return _column.get_view(index); }
+
+        size_t size() const { return _column.size(); }
+
+    private:
+        const BinaryColumnBase& _column;
+    };
+
     using Container = Buffer<Slice>;
     using ProxyContainer = BinaryDataProxyContainer;
 
@@ -137,6 +149,11 @@ public:
         return Slice(_bytes.data() + _offsets[idx], _offsets[idx + 1] - _offsets[idx]);
     }
 
+    // The view of a long string refers to the bytes of this column, it's invalid once the column is changed.
+    BinaryView get_view(size_t idx) const {
+        return BinaryView(_bytes.data() + _offsets[idx], _offsets[idx + 1] - _offsets[idx]);
+    }
+
     void check_or_die() const override;
 
     // For n value, the offsets size is n + 1
@@ -283,6 +300,8 @@ public:
 
     const BinaryDataProxyContainer& get_proxy_data() const { return _immuable_container; }
 
+    BinaryViewProxyContainer get_view_proxy_data() const { return BinaryViewProxyContainer(*this); }
+
     Bytes& get_bytes() { return _bytes; }
 
     const Bytes& get_bytes() const { return _bytes; }
@@ -0,0 +1,127 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "util/slice.h"
+
+namespace starrocks {
+
+// A 16 bytes view of a string in BinaryColumn, strings not longer than 12 bytes are stored inline, and the longer
+// ones keep the first 4 bytes inline and refer to the bytes of the column, so the view is built without copying
+// the bytes.
+// Comparing views compares the inline prefixes first, and only dereferences the bytes when the prefixes are the
+// same, which avoids most cache misses of comparing short or distinct strings.
+//
+// |  size (4B)  | prefix (4B) |     inline suffix (8B) or pointer (8B)    |
+class BinaryView {
+public:
+    static constexpr uint32_t PREFIX_SIZE = 4;
+    static constexpr uint32_t INLINE_SIZE = 12;
+
+    BinaryView() : _size(0) {
+        memset(_prefix, 0, PREFIX_SIZE);
+        _value.suffix = 0;
+    }
+
+    BinaryView(const uint8_t* data, uint32_t size) : _size(size) {
+        static_assert(offsetof(BinaryView, _value) == sizeof(_size) + PREFIX_SIZE, "inline bytes must be contiguous");
+        // zero padding makes equal strings have equal views.
+        memset(_prefix, 0, PREFIX_SIZE);
+        memcpy(_prefix, data, std::min(size, PREFIX_SIZE));
+        if (size <= INLINE_SIZE) {
+            _value.suffix = 0;
+            if (size > PREFIX_SIZE) {
+                memcpy(_value.inlined, data + PREFIX_SIZE, size - PREFIX_SIZE);
+            }
+        } else {
+            _value.ptr = data;
+        }
+    }
+
+    explicit BinaryView(const Slice& slice) : BinaryView(reinterpret_cast<const uint8_t*>(slice.data), slice.size) {}
+
+    uint32_t size() const { return _size; }
+
+    bool is_inline() const { return _size <= INLINE_SIZE; }
+
+    // NOTE: the data of an inline view is stored in the view itself, it's invalid once the view is moved.
+    // The prefix and the inline suffix are contiguous.
+    const char* data() const {
+        return is_inline() ? reinterpret_cast<const char*>(_prefix) : reinterpret_cast<const char*>(_value.ptr);
+    }
+
+    Slice to_slice() const { return {data(), _size}; }
+
+    bool operator==(const BinaryView& rhs) const {
+        // size and prefix
+        if (_size_and_prefix() != rhs._size_and_prefix()) {
+            return false;
+        }
+        if (is_inline()) {
+            return _value.suffix == rhs._value.suffix;
+        }
+        return memcmp(_value.ptr + PREFIX_SIZE, rhs._value.ptr + PREFIX_SIZE, _size - PREFIX_SIZE) == 0;
+    }
+
+    bool operator!=(const BinaryView& rhs) const { return !(*this == rhs); }
+
+    // Same order as Slice::compare, the result is negative, 0 or positive.
+    int compare(const BinaryView& rhs) const {
+        uint32_t lhs_prefix = _big_endian_prefix();
+        uint32_t rhs_prefix = rhs._big_endian_prefix();
+        if (lhs_prefix != rhs_prefix) {
+            // the padding zeros of a string shorter than 4 bytes are not greater than any byte of the other one.
+            return lhs_prefix < rhs_prefix ? -1 : 1;
+        }
+        uint32_t min_size = std::min(_size, rhs._size);
+        if (min_size > PREFIX_SIZE) {
+            int r = memcmp(data() + PREFIX_SIZE, rhs.data() + PREFIX_SIZE, min_size - PREFIX_SIZE);
+            if (r != 0) {
+                return r;
+            }
+        }
+        return _size < rhs._size ? -1 : (_size > rhs._size ? 1 : 0);
+    }
+
+private:
+    uint64_t _size_and_prefix() const {
+        uint32_t prefix;
+        memcpy(&prefix, _prefix, sizeof(prefix));
+        return (static_cast<uint64_t>(_size) << 32) | prefix;
+    }
+
+    uint32_t _big_endian_prefix() const {
+        uint32_t v;
+        memcpy(&v, _prefix, sizeof(v));
+        return __builtin_bswap32(v);
+    }
+
+    uint32_t _size;
+    uint8_t _prefix[PREFIX_SIZE];
+    union {
+        uint8_t inlined[INLINE_SIZE - PREFIX_SIZE];
+        uint64_t suffix;
+        const uint8_t* ptr;
+    } _value;
+};
+
+static_assert(sizeof(BinaryView) == 16, "BinaryView must be 16 bytes");
+
+} // namespace starrocks
@@ -17,12 +17,14 @@
 #include <cstdint>
 #include <vector>
 
+#include "column/column_buffer_pool.h"
 #include "util/raw_container.h"
 
 namespace starrocks {
 
 // Bytes is a special vector<uint8_t> in which the internal memory is always allocated with an additional 16 bytes,
 // to make life easier with 128 bit instructions.
-typedef starrocks::raw::RawVectorPad16<uint8_t> Bytes;
+// The large ones are allocated from ColumnBufferPool.
+typedef std::vector<uint8_t, starrocks::raw::RawAllocator<uint8_t, 16, ColumnBufferAllocator<uint8_t>>> Bytes;
 
 } // namespace starrocks
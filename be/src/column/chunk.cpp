@@ -32,6 +32,7 @@ Chunk::Chunk() {
 }
 
 Status Chunk::upgrade_if_overflow() {
+    _cached_expr_columns.reset();
     for (auto& column : _columns) {
         auto ret = column->upgrade_if_overflow();
         if (!ret.ok()) {
@@ -46,6 +47,7 @@ Status Chunk::upgrade_if_overflow() {
 }
 
 Status Chunk::downgrade() {
+    _cached_expr_columns.reset();
     for (auto& column : _columns) {
         auto ret = column->downgrade();
         if (!ret.ok()) {
@@ -94,6 +96,7 @@ void Chunk::reset() {
     }
     _delete_state = DEL_NOT_SATISFIED;
     _extra_data.reset();
+    _cached_expr_columns.reset();
 }
 
 void Chunk::swap_chunk(Chunk& other) {
@@ -103,9 +106,11 @@ void Chunk::swap_chunk(Chunk& other) {
     _slot_id_to_index.swap(other._slot_id_to_index);
     std::swap(_delete_state, other._delete_state);
     _extra_data.swap(other._extra_data);
+    _cached_expr_columns.swap(other._cached_expr_columns);
 }
 
 void Chunk::set_num_rows(size_t count) {
+    _cached_expr_columns.reset();
     for (ColumnPtr& c : _columns) {
         c->resize(count);
     }
@@ -113,6 +118,7 @@ void Chunk::set_num_rows(size_t count) {
 
 void Chunk::update_rows(const Chunk& src, const uint32_t* indexes) {
     DCHECK(_columns.size() == src.num_columns());
+    _cached_expr_columns.reset();
     for (int i = 0; i < _columns.size(); i++) {
         ColumnPtr& c = _columns[i];
         c->update_rows(*src.columns()[i], indexes);
@@ -139,17 +145,20 @@ void Chunk::append_column(ColumnPtr column, SlotId slot_id) {
 }
 
 void Chunk::update_column(ColumnPtr column, SlotId slot_id) {
+    _cached_expr_columns.reset();
     _columns[_slot_id_to_index[slot_id]] = std::move(column);
     check_or_die();
 }
 
 void Chunk::update_column_by_index(ColumnPtr column, size_t idx) {
+    _cached_expr_columns.reset();
     _columns[idx] = std::move(column);
     check_or_die();
 }
 
 void Chunk::append_or_update_column(ColumnPtr column, SlotId slot_id) {
     if (_slot_id_to_index.contains(slot_id)) {
+        _cached_expr_columns.reset();
         _columns[_slot_id_to_index[slot_id]] = std::move(column);
     } else {
         _slot_id_to_index[slot_id] = _columns.size();
@@ -168,6 +177,7 @@ void Chunk::insert_column(size_t idx, ColumnPtr column, const FieldPtr& field) {
 }
 
 void Chunk::append_default() {
+    _cached_expr_columns.reset();
     for (const auto& column : _columns) {
         column->append_default();
     }
@@ -175,6 +185,7 @@ void Chunk::append_default() {
 
 void Chunk::remove_column_by_index(size_t idx) {
     DCHECK_LT(idx, _columns.size());
+    _cached_expr_columns.reset();
     _columns.erase(_columns.begin() + idx);
     if (_schema != nullptr) {
         _schema->remove(idx);
@@ -185,6 +196,7 @@ void Chunk::remove_column_by_index(size_t idx) {
 void Chunk::remove_column_by_slot_id(SlotId slot_id) {
     auto iter = _slot_id_to_index.find(slot_id);
     if (iter != _slot_id_to_index.end()) {
+        _cached_expr_columns.reset();
         auto idx = iter->second;
         _columns.erase(_columns.begin() + idx);
         if (_schema != nullptr) {
@@ -202,6 +214,9 @@ void Chunk::remove_column_by_slot_id(SlotId slot_id) {
 
 void Chunk::remove_columns_by_index(const std::vector<size_t>& indexes) {
     DCHECK(std::is_sorted(indexes.begin(), indexes.end()));
+    if (!indexes.empty()) {
+        _cached_expr_columns.reset();
+    }
     for (size_t i = indexes.size(); i > 0; i--) {
         _columns.erase(_columns.begin() + indexes[i - 1]);
     }
@@ -273,6 +288,7 @@ std::unique_ptr<Chunk> Chunk::clone_unique() const {
 
 void Chunk::append_selective(const Chunk& src, const uint32_t* indexes, uint32_t from, uint32_t size) {
     DCHECK_EQ(_columns.size(), src.columns().size());
+    _cached_expr_columns.reset();
     for (size_t i = 0; i < _columns.size(); ++i) {
         _columns[i]->append_selective(*src.columns()[i].get(), indexes, from, size);
     }
@@ -282,6 +298,8 @@ void Chunk::rolling_append_selective(Chunk& src, const uint32_t* indexes, uint32
     size_t num_columns = _columns.size();
     DCHECK_EQ(num_columns, src.columns().size());
 
+    _cached_expr_columns.reset();
+    src.clear_cached_expr_columns();
     for (size_t i = 0; i < num_columns; ++i) {
         _columns[i]->append_selective(*src.columns()[i].get(), indexes, from, size);
         src.columns()[i].reset();
@@ -292,6 +310,7 @@ size_t Chunk::filter(const Buffer<uint8_t>& selection, bool force) {
     if (!force && SIMD::count_zero(selection) == 0) {
         return num_rows();
     }
+    _filter_cached_expr_columns(selection);
     for (auto& column : _columns) {
         column->filter(selection);
     }
@@ -299,12 +318,82 @@ size_t Chunk::filter(const Buffer<uint8_t>& selection, bool force) {
 }
 
 size_t Chunk::filter_range(const Buffer<uint8_t>& selection, size_t from, size_t to) {
+    _cached_expr_columns.reset();
     for (auto& column : _columns) {
         column->filter_range(selection, from, to);
     }
     return num_rows();
 }
 
+ColumnPtr Chunk::get_cached_expr_column(const std::string& fingerprint,
+                                        const std::vector<SlotId>& input_slot_ids) const {
+    if (_cached_expr_columns == nullptr) {
+        return nullptr;
+    }
+    auto it = _cached_expr_columns->find(fingerprint);
+    if (it == _cached_expr_columns->end() || it->second.column->size() != num_rows()) {
+        return nullptr;
+    }
+    ExprInputs inputs;
+    if (!_get_expr_inputs(input_slot_ids, &inputs) || inputs != it->second.inputs) {
+        return nullptr;
+    }
+    return it->second.column;
+}
+
+void Chunk::cache_expr_column(const std::string& fingerprint, const std::vector<SlotId>& input_slot_ids,
+                              ColumnPtr column) {
+    ExprInputs inputs;
+    if (!_get_expr_inputs(input_slot_ids, &inputs)) {
+        return;
+    }
+    if (_cached_expr_columns == nullptr) {
+        _cached_expr_columns = std::make_unique<phmap::flat_hash_map<std::string, CachedExprColumn>>();
+    }
+    (*_cached_expr_columns)[fingerprint] = {std::move(column), std::move(inputs)};
+}
+
+bool Chunk::_get_expr_inputs(const std::vector<SlotId>& slot_ids, ExprInputs* inputs) const {
+    inputs->reserve(slot_ids.size());
+    for (SlotId slot_id : slot_ids) {
+        auto iter = _slot_id_to_index.find(slot_id);
+        if (iter == _slot_id_to_index.end()) {
+            return false;
+        }
+        const auto& column = _columns[iter->second];
+        inputs->emplace_back(column, column->size());
+    }
+    return true;
+}
+
+void Chunk::_filter_cached_expr_columns(const Buffer<uint8_t>& selection) {
+    if (_cached_expr_columns == nullptr) {
+        return;
+    }
+    size_t rows = num_rows();
+    for (auto it = _cached_expr_columns->begin(); it != _cached_expr_columns->end();) {
+        auto& [column, inputs] = it->second;
+        bool valid = column->size() == rows;
+        for (const auto& input : inputs) {
+            valid &= input.second == rows;
+        }
+        if (!valid) {
+            _cached_expr_columns->erase(it++);
+            continue;
+        }
+        // copy on write, the column may be still referenced by the results returned before.
+        if (column.use_count() > 1) {
+            column = column->clone_shared();
+        }
+        column->filter(selection);
+        // the input columns are filtered in place with the same selection.
+        for (auto& input : inputs) {
+            input.second = column->size();
+        }
+        ++it;
+    }
+}
+
 DatumTuple Chunk::get(size_t n) const {
     DatumTuple res;
     res.reserve(_columns.size());
@@ -319,6 +408,11 @@ size_t Chunk::memory_usage() const {
     for (const auto& column : _columns) {
         memory_usage += column->memory_usage();
     }
+    if (_cached_expr_columns != nullptr) {
+        for (const auto& [_, cached] : *_cached_expr_columns) {
+            memory_usage += cached.column->memory_usage();
+        }
+    }
     return memory_usage;
 }
 
@@ -429,6 +523,7 @@ void Chunk::merge(Chunk&& src) {
 
 void Chunk::append(const Chunk& src, size_t offset, size_t count) {
     DCHECK_EQ(num_columns(), src.num_columns());
+    _cached_expr_columns.reset();
     const size_t n = src.num_columns();
     for (size_t i = 0; i < n; i++) {
         ColumnPtr& c = get_column_by_index(i);
@@ -438,6 +533,7 @@ void Chunk::append(const Chunk& src, size_t offset, size_t count) {
 
 void Chunk::append_safe(const Chunk& src, size_t offset, size_t count) {
     DCHECK_EQ(num_columns(), src.num_columns());
+    _cached_expr_columns.reset();
     const size_t n = src.num_columns();
     size_t cur_rows = num_rows();
 
@@ -291,9 +291,33 @@ public:
     void set_extra_data(ChunkExtraDataPtr data) { this->_extra_data = std::move(data); }
     bool has_extra_data() const { return this->_extra_data != nullptr; }
 
+    // Columns of the common subexpressions evaluated on this chunk, keyed by the fingerprints of the expressions,
+    // see CachedExpr. They are filtered together with the chunk, and dropped by the other methods modifying the
+    // rows. The cached columns are shared with the callers, so a column still referenced elsewhere is copied
+    // before it's filtered. Callers modifying the columns in place through the mutable accessors should call
+    // clear_cached_expr_columns().
+    // Return nullptr if the expression is not cached, or any column of `input_slot_ids` is replaced or resized
+    // since it's cached.
+    ColumnPtr get_cached_expr_column(const std::string& fingerprint, const std::vector<SlotId>& input_slot_ids) const;
+    void cache_expr_column(const std::string& fingerprint, const std::vector<SlotId>& input_slot_ids,
+                           ColumnPtr column);
+    void clear_cached_expr_columns() { _cached_expr_columns.reset(); }
+
 private:
+    // Each input column and its size, to tell whether the inputs of a cached column are changed. The columns are
+    // held, so a replaced column can't be mistaken for a new one allocated at the same address.
+    using ExprInputs = std::vector<std::pair<ColumnPtr, size_t>>;
+    struct CachedExprColumn {
+        ColumnPtr column;
+        ExprInputs inputs;
+    };
+
     void rebuild_cid_index();
 
+    // Return false if any of the slots doesn't exist.
+    bool _get_expr_inputs(const std::vector<SlotId>& slot_ids, ExprInputs* inputs) const;
+    void _filter_cached_expr_columns(const Buffer<uint8_t>& selection);
+
     Columns _columns;
     std::shared_ptr<Schema> _schema;
     ColumnIdHashMap _cid_to_index;
@@ -302,6 +326,8 @@ private:
     DelCondSatisfied _delete_state = DEL_NOT_SATISFIED;
     query_cache::owner_info _owner_info;
     ChunkExtraDataPtr _extra_data;
+    // allocated when the first column is cached.
+    std::unique_ptr<phmap::flat_hash_map<std::string, CachedExprColumn>> _cached_expr_columns;
 };
 
 inline const ColumnPtr& Chunk::get_column_by_name(const std::string& column_name) const {
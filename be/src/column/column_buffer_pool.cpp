@@ -0,0 +1,216 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "column/column_buffer_pool.h"
+
+#include <malloc.h>
+#include <sched.h>
+
+#include <algorithm>
+#include <mutex>
+#include <thread>
+
+#include "common/config.h"
+#include "gutil/dynamic_annotations.h"
+#include "runtime/current_thread.h"
+#include "runtime/mem_tracker.h"
+#include "util/bit_util.h"
+#include "util/spinlock.h"
+
+namespace starrocks {
+
+static constexpr int LOG2_MIN_BYTES = 16;
+static constexpr int CLASSES_PER_POWER = 4;
+static constexpr int NUM_CLASSES = (26 - LOG2_MIN_BYTES) * CLASSES_PER_POWER + 1;
+static_assert(ColumnBufferPool::MIN_BYTES == (1UL << LOG2_MIN_BYTES));
+static_assert(ColumnBufferPool::MAX_BYTES == (1UL << 26));
+
+// Index of the largest class not greater than `size`, `size` must not be less than MIN_BYTES.
+static int floor_class(size_t size) {
+    int log2 = BitUtil::Log2Floor64(size);
+    int sub = (size >> (log2 - 2)) & (CLASSES_PER_POWER - 1);
+    return (log2 - LOG2_MIN_BYTES) * CLASSES_PER_POWER + sub;
+}
+
+static size_t class_size(int idx) {
+    int log2 = LOG2_MIN_BYTES + idx / CLASSES_PER_POWER;
+    return static_cast<size_t>(CLASSES_PER_POWER + idx % CLASSES_PER_POWER) << (log2 - 2);
+}
+
+static int ceil_class(size_t size) {
+    int idx = floor_class(size);
+    return class_size(idx) < size ? idx + 1 : idx;
+}
+
+struct CachedBuffer {
+    void* ptr;
+    size_t usable_size;
+};
+
+// Free lists of a cpu core.
+class ColumnBufferFreeLists {
+public:
+    ColumnBufferFreeLists() {
+        for (auto& low_water : _low_waters) {
+            low_water = 0;
+        }
+    }
+
+    bool pop(int idx, CachedBuffer* buffer) {
+        std::lock_guard<SpinLock> l(_lock);
+        auto& list = _lists[idx];
+        if (list.empty()) {
+            return false;
+        }
+        *buffer = list.back();
+        list.pop_back();
+        _low_waters[idx] = std::min(_low_waters[idx], list.size());
+        return true;
+    }
+
+    void push(int idx, const CachedBuffer& buffer) {
+        std::lock_guard<SpinLock> l(_lock);
+        _lists[idx].push_back(buffer);
+    }
+
+    // Take the buffers not popped since the last call, or all of them.
+    void take_buffers(bool all, std::vector<CachedBuffer>* buffers) {
+        std::lock_guard<SpinLock> l(_lock);
+        for (int i = 0; i < NUM_CLASSES; i++) {
+            auto& list = _lists[i];
+            // the front ones are the least recently pushed.
+            size_t n = all ? list.size() : std::min(_low_waters[i], list.size());
+            buffers->insert(buffers->end(), list.begin(), list.begin() + n);
+            list.erase(list.begin(), list.begin() + n);
+            _low_waters[i] = list.size();
+        }
+    }
+
+private:
+    SpinLock _lock;
+    std::vector<CachedBuffer> _lists[NUM_CLASSES];
+    // the minimum size of each list since the last take_buffers().
+    size_t _low_waters[NUM_CLASSES];
+};
+
+static size_t current_core() {
+    int cpu = sched_getcpu();
+    return cpu < 0 ? 0 : cpu;
+}
+
+ColumnBufferPool* ColumnBufferPool::instance() {
+    // never destroyed, columns may be freed after the static objects are destroyed.
+    static auto* s_pool = new ColumnBufferPool();
+    return s_pool;
+}
+
+// CpuInfo may be not initialized yet when the first column is created.
+ColumnBufferPool::ColumnBufferPool() : _free_lists(std::max(std::thread::hardware_concurrency(), 1U)) {
+    for (auto& free_lists : _free_lists) {
+        free_lists = std::make_unique<ColumnBufferFreeLists>();
+    }
+}
+
+ColumnBufferPool::~ColumnBufferPool() {
+    std::vector<CachedBuffer> buffers;
+    for (auto& free_lists : _free_lists) {
+        free_lists->take_buffers(true, &buffers);
+    }
+    for (const auto& buffer : buffers) {
+        ASAN_UNPOISON_MEMORY_REGION(buffer.ptr, buffer.usable_size);
+        ::operator delete(buffer.ptr);
+    }
+}
+
+size_t ColumnBufferPool::allocation_size(size_t size) {
+    if (size < MIN_BYTES || size > MAX_BYTES) {
+        return size;
+    }
+    return class_size(ceil_class(size));
+}
+
+void* ColumnBufferPool::_allocate_pooled(size_t size) {
+    int idx = ceil_class(size);
+    size_t num_cores = _free_lists.size();
+    size_t core_id = current_core() % num_cores;
+
+    CachedBuffer buffer;
+    bool found = _free_lists[core_id]->pop(idx, &buffer);
+    // try other cores only if there may be enough cached buffers.
+    for (size_t i = 1; !found && i < num_cores && cached_bytes() >= size; i++) {
+        found = _free_lists[(core_id + i) % num_cores]->pop(idx, &buffer);
+    }
+    if (!found) {
+        return ::operator new(class_size(idx));
+    }
+
+    ASAN_UNPOISON_MEMORY_REGION(buffer.ptr, buffer.usable_size);
+    _cached_bytes.fetch_sub(buffer.usable_size, std::memory_order_relaxed);
+    if (_mem_tracker != nullptr) {
+        _mem_tracker->release(buffer.usable_size);
+    }
+    tls_thread_status.mem_consume(buffer.usable_size);
+    return buffer.ptr;
+}
+
+void ColumnBufferPool::_deallocate_pooled(void* ptr) {
+    // the buffer may be allocated by the global allocator, and its size may be different from the one of
+    // the container, so it's cached by its usable size.
+    size_t usable_size = malloc_usable_size(ptr);
+    int idx = usable_size < MIN_BYTES ? -1 : floor_class(usable_size);
+    if (!config::enable_column_buffer_pool || idx < 0 || idx >= NUM_CLASSES ||
+        cached_bytes() + usable_size > config::column_buffer_pool_capacity) {
+        ::operator delete(ptr);
+        return;
+    }
+
+    _cached_bytes.fetch_add(usable_size, std::memory_order_relaxed);
+    tls_thread_status.mem_release(usable_size);
+    if (_mem_tracker != nullptr) {
+        _mem_tracker->consume(usable_size);
+    }
+    ASAN_POISON_MEMORY_REGION(ptr, usable_size);
+    size_t core_id = current_core() % _free_lists.size();
+    _free_lists[core_id]->push(idx, {ptr, usable_size});
+}
+
+size_t ColumnBufferPool::release_idle_buffers() {
+    return _release_buffers(false);
+}
+
+size_t ColumnBufferPool::release_all_buffers() {
+    return _release_buffers(true);
+}
+
+size_t ColumnBufferPool::_release_buffers(bool all) {
+    std::vector<CachedBuffer> buffers;
+    for (auto& free_lists : _free_lists) {
+        free_lists->take_buffers(all, &buffers);
+    }
+    size_t freed_bytes = 0;
+    for (const auto& buffer : buffers) {
+        freed_bytes += buffer.usable_size;
+        ASAN_UNPOISON_MEMORY_REGION(buffer.ptr, buffer.usable_size);
+        ::operator delete(buffer.ptr);
+    }
+    _cached_bytes.fetch_sub(freed_bytes, std::memory_order_relaxed);
+    // the buffers are freed on behalf of the pool.
+    if (_mem_tracker != nullptr) {
+        _mem_tracker->release(freed_bytes);
+    }
+    tls_thread_status.mem_consume(freed_bytes);
+    return freed_bytes;
+}
+
+} // namespace starrocks
@@ -0,0 +1,121 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+namespace starrocks {
+
+class MemTracker;
+class ColumnBufferFreeLists;
+
+// A process wide pool of the large data buffers of columns, so the buffers released by a query are reused by
+// the next ones instead of returning the pages to the system and faulting them in again.
+//
+// Buffers are cached in size classes, four classes for each power of two, and in a free list of each cpu core
+// like MemChunkAllocator, so there is no lock contention in common case. A buffer is put into the class
+// of its usable size, so buffers allocated by the global allocator and moved into a pooled container
+// are safe to be reused, and buffers allocated from the pool can be freed by the global allocator.
+//
+// The cached bytes are accounted to the mem tracker of the pool instead of the queries, and bounded by
+// config::column_buffer_pool_capacity. The buffers not reused since the last release_idle_buffers() are
+// freed by the memory maintenance daemon.
+class ColumnBufferPool {
+public:
+    // Smaller buffers are cheap to allocate by the global allocator.
+    static constexpr size_t MIN_BYTES = 64 * 1024;
+    static constexpr size_t MAX_BYTES = 64 * 1024 * 1024;
+
+    static ColumnBufferPool* instance();
+
+    ColumnBufferPool();
+    ~ColumnBufferPool();
+
+    ColumnBufferPool(const ColumnBufferPool&) = delete;
+    ColumnBufferPool& operator=(const ColumnBufferPool&) = delete;
+
+    // Throw std::bad_alloc if out of memory.
+    void* allocate(size_t size) {
+        if (size < MIN_BYTES || size > MAX_BYTES) {
+            return ::operator new(size);
+        }
+        return _allocate_pooled(size);
+    }
+
+    void deallocate(void* ptr, size_t size) {
+        if (ptr == nullptr) {
+            return;
+        }
+        if (size < MIN_BYTES || size > MAX_BYTES) {
+            ::operator delete(ptr);
+            return;
+        }
+        _deallocate_pooled(ptr);
+    }
+
+    // Free the buffers not allocated since the last call, returns the number of bytes freed.
+    size_t release_idle_buffers();
+    // Free all the cached buffers, returns the number of bytes freed.
+    size_t release_all_buffers();
+
+    void set_mem_tracker(std::shared_ptr<MemTracker> mem_tracker) { _mem_tracker = std::move(mem_tracker); }
+    MemTracker* mem_tracker() const { return _mem_tracker.get(); }
+
+    size_t cached_bytes() const { return _cached_bytes.load(std::memory_order_relaxed); }
+
+    // The size of the buffer allocated for `size` bytes, exposed for test.
+    static size_t allocation_size(size_t size);
+
+private:
+    void* _allocate_pooled(size_t size);
+    void _deallocate_pooled(void* ptr);
+    size_t _release_buffers(bool all);
+
+    std::shared_ptr<MemTracker> _mem_tracker;
+    std::atomic<int64_t> _cached_bytes{0};
+    std::vector<std::unique_ptr<ColumnBufferFreeLists>> _free_lists;
+};
+
+// Stateless allocator of column buffers allocating from ColumnBufferPool.
+template <class T>
+class ColumnBufferAllocator {
+public:
+    using value_type = T;
+    using is_always_equal = std::true_type;
+
+    ColumnBufferAllocator() = default;
+    template <class U>
+    ColumnBufferAllocator(const ColumnBufferAllocator<U>&) {}
+
+    T* allocate(size_t n) { return static_cast<T*>(ColumnBufferPool::instance()->allocate(n * sizeof(T))); }
+    void deallocate(T* ptr, size_t n) { ColumnBufferPool::instance()->deallocate(ptr, n * sizeof(T)); }
+
+    template <class U>
+    bool operator==(const ColumnBufferAllocator<U>&) const {
+        return true;
+    }
+    template <class U>
+    bool operator!=(const ColumnBufferAllocator<U>&) const {
+        return false;
+    }
+};
+
+} // namespace starrocks
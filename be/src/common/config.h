@@ -279,6 +279,12 @@ CONF_mBool(enable_zonemap_index_memory_page_cache, "false");
 CONF_mBool(enable_ordinal_index_memory_page_cache, "false");
 // whether to disable column pool
 CONF_Bool(disable_column_pool, "true");
+// Whether the large data buffers of binary columns released by queries are cached to be reused by the next
+// queries, instead of being returned to the system and faulted in again.
+CONF_mBool(enable_column_buffer_pool, "false");
+// Max bytes of the buffers cached by the column buffer pool, the buffers not reused in a memory maintenance
+// interval are freed, and all of them are freed once the process memory exceeds memory_urgent_level.
+CONF_mInt64(column_buffer_pool_capacity, "536870912");
 
 CONF_mInt32(base_compaction_check_interval_seconds, "60");
 CONF_mInt64(min_base_compaction_num_singleton_deltas, "5");
@@ -348,6 +354,13 @@ CONF_mBool(enable_rowset_verify, "false");
 // If the number of schema columns is greater than this,
 // the columns will be divided into groups for vertical compaction.
 CONF_Int64(vertical_compaction_max_columns_per_group, "5");
+// Max non-key column groups merged concurrently in one vertical compaction task.
+// Readers of these groups are opened at the same time, and are bounded by compaction_memory_limit_per_worker.
+CONF_mInt64(vertical_compaction_max_parallel_column_groups, "4");
+// Threads shared by all vertical compaction tasks to merge non-key column groups concurrently.
+CONF_Int32(vertical_compaction_column_group_thread_num, "8");
+// Max merged chunks of a column group waiting to be written while an earlier group is being written.
+CONF_mInt32(vertical_compaction_column_group_queue_size, "4");
 
 CONF_Bool(enable_event_based_compaction_framework, "true");
 
@@ -357,6 +370,13 @@ CONF_mInt64(size_tiered_min_level_size, "131072");
 CONF_mInt64(size_tiered_level_multiple, "5");
 CONF_mInt64(size_tiered_level_multiple_dupkey, "10");
 CONF_mInt64(size_tiered_level_num, "7");
+// Compaction score of a tablet is boosted by its read amplification (segments merged per query scan):
+//   score * (1 + weight * log2(1 + read_amplification))
+// so tablets that are queried heavily are compacted first. It only changes the order of picking candidates,
+// the reported compaction scores are not boosted. 0 means disabled.
+CONF_mDouble(compaction_read_amplification_weight, "0");
+// Read amplification of a tablet decays to 0 if it's not queried within this window.
+CONF_mInt64(compaction_read_amplification_window_seconds, "600");
 
 CONF_Bool(enable_check_string_lengths, "true");
 
@@ -747,6 +767,10 @@ CONF_Int64(pipeline_sink_brpc_dop, "64");
 // exceeds it*pipeline_exec_thread_pool_thread_num.
 CONF_Int64(pipeline_max_num_drivers_per_exec_thread, "10240");
 CONF_mBool(pipeline_print_profile, "false");
+// Whether to count cpu cycles, instructions, cache misses, dTLB misses and page faults of each pipeline operator
+// by perf_event_open, shown in the CommonMetrics of the operators. It costs two syscalls per chunk of each
+// operator, and requires kernel.perf_event_paranoid <= 2.
+CONF_mBool(enable_operator_perf_event_counters, "false");
 
 // The arguments of multilevel feedback pipeline_driver_queue. It prioritizes small queries over larger ones,
 // when the value of level_time_slice_base_ns is smaller and queue_ratio_of_adjacent_queue is larger.
@@ -847,10 +871,21 @@ CONF_Int32(orc_loading_buffer_size, "8388608");
 CONF_mBool(parquet_coalesce_read_enable, "true");
 CONF_Bool(parquet_late_materialization_enable, "true");
 CONF_Bool(parquet_page_index_enable, "true");
+// Skip parquet row groups whose bloom filters don't contain any value of eq/in predicates.
+CONF_mBool(parquet_bloom_filter_enable, "true");
+// Skip parquet row groups whose dict pages don't contain any value satisfying predicates.
+// Only for non-string columns, string columns are always filtered by dict.
+CONF_mBool(parquet_dict_page_filter_enable, "true");
 
 CONF_Int32(io_coalesce_read_max_buffer_size, "8388608");
 CONF_Int32(io_coalesce_read_max_distance_size, "1048576");
 CONF_mBool(io_coalesce_adaptive_lazy_active, "true");
+// Choose the max distance of io coalesce by the latency and bandwidth learned from the remote reads of each
+// storage (e.g. s3, hdfs), instead of io_coalesce_read_max_distance_size. The adaptive distance is limited to
+// [io_coalesce_adaptive_min_distance_size, io_coalesce_read_max_buffer_size / 2]. Off by default until it
+// is proven on more workloads.
+CONF_mBool(io_coalesce_adaptive_distance_enable, "false");
+CONF_mInt64(io_coalesce_adaptive_min_distance_size, "65536");
 CONF_Int32(io_tasks_per_scan_operator, "4");
 CONF_Int32(connector_io_tasks_per_scan_operator, "16");
 CONF_Int32(connector_io_tasks_min_size, "2");
@@ -1077,6 +1112,15 @@ CONF_Int64(datacache_max_flying_memory_mb, "2");
 CONF_Double(datacache_skip_read_factor, "1.0");
 // Whether to use block buffer to hold the datacache block data.
 CONF_Bool(datacache_block_buffer_enable, "true");
+// Whether to admit a block into datacache only when it has been accessed more than once within a window, which
+// keeps the cache from being flushed by one-off large scans. The window is tracked by `datacache_ghost_entries`
+// ghost entries, which only remember the fingerprints of the recently accessed blocks.
+CONF_mBool(datacache_admission_enable, "false");
+// Whether to promote a block from disk to memory only when it's hit more than once within the window. If false,
+// every block read from disk is promoted. Only works when the tiered cache is enabled.
+CONF_mBool(datacache_hot_block_promotion_enable, "false");
+// The number of ghost entries used by admission and promotion respectively, each costs 8 bytes.
+CONF_Int64(datacache_ghost_entries, "1048576");
 // To control how many threads will be created for datacache synchronous tasks.
 // For the default value, it means for every 8 cpu, one thread will be created.
 CONF_Double(datacache_scheduler_threads_per_cpu, "0.125");
@@ -1087,6 +1131,10 @@ CONF_Double(datacache_scheduler_threads_per_cpu, "0.125");
 // For object data, such as parquet footer object, which can only be cached in memory are not affected
 // by this configuration.
 CONF_Bool(datacache_tiered_cache_enable, "true");
+// Whether to write the raw parquet footer and orc file tail to the block cache as data blocks as well. Unlike the
+// footer objects, they can be written to the disk cache and survive restart, so the file metadata is read from
+// local disk rather than from remote storage again after restart. Only works when file metacache is used.
+CONF_mBool(datacache_persist_file_metadata, "true");
 // DataCache engines, alternatives: cachelib, starcache.
 // Set the default value empty to indicate whether it is manully configured by users.
 // If not, we need to adjust the default engine based on build switches like "WITH_CACHELIB" and "WITH_STARCACHE".
@@ -1169,6 +1217,10 @@ CONF_mBool(enable_pindex_rebuild_in_compaction, "true");
 // enable read pindex by page
 CONF_mBool(enable_pindex_read_by_page, "true");
 
+// Under memory pressure, release the bloom filters of the l1/l2 levels of the least recently used persistent
+// primary indexes before evicting whole indexes from cache, the bloom filters are reloaded on demand.
+CONF_mBool(enable_pindex_release_cold_memory, "false");
+
 // Used by query cache, cache entries are evicted when it exceeds its capacity(500MB in default)
 CONF_Int64(query_cache_capacity, "536870912");
 
@@ -1247,6 +1299,15 @@ CONF_mInt32(finish_publish_version_internal, "100");
 
 CONF_mBool(enable_stream_load_verbose_log, "false");
 
+// When all jsonpaths of a json load are top-level keys, iterate each json object only once and skip
+// the unused fields instead of searching every key in the object.
+CONF_mBool(enable_json_load_flat_path_projection, "true");
+
+// An uncompressed csv file range of broker load larger than twice this size is split into tasks of
+// this size at runtime, so that it can be parsed by several scan threads, e.g. 268435456.
+// <= 0 disables the split.
+CONF_mInt64(file_scan_split_size, "0");
+
 CONF_mInt32(get_txn_status_internal_sec, "30");
 
 CONF_mBool(dump_metrics_with_bvar, "true");
@@ -1305,6 +1366,30 @@ CONF_mBool(enable_light_pk_compaction_publish, "true");
 // if mem_limit < 16 GB, disable JIT.
 // else it = min(mem_limit*0.01, 1GB)
 CONF_mInt64(jit_lru_cache_size, "0");
+// Local directory to persist compiled JIT objects, they are reused after BE restarts and evictions of the
+// JIT LRU cache. Empty means objects are only cached in memory.
+CONF_String(jit_disk_cache_path, "");
+// Max total size of the objects persisted in jit_disk_cache_path, the least recently used ones are removed.
+CONF_Int64(jit_disk_cache_capacity, "1073741824");
+// Number of threads compiling jit functions off the query threads, only key serializers are compiled by them now.
+CONF_Int32(jit_compile_thread_num, "2");
+
+// Whether subexpressions occurring more than once in the conjuncts and projections of a fragment are evaluated
+// once per chunk, e.g. json_query(payload, '$.a') of both a filter and a projection.
+CONF_mBool(enable_common_expr_reuse, "false");
+
+// Conjuncts calling functions, matching patterns or reading json are evaluated on the copies of their columns of
+// the rows not filtered by the previous conjuncts, if the ratio of these rows is not greater than it. 0 means
+// conjuncts are always evaluated on all rows. Disabled by default, see be/src/bench/selective_eval_bench.cpp.
+CONF_mDouble(selective_eval_max_selected_ratio, "0");
+
+// Whether the hash tables of aggregations and joins allocate from an arena of the fragment instance, which is
+// released at once at the teardown of the fragment instance.
+CONF_mBool(enable_hash_table_arena, "false");
+// Size of the chunks of the hash table arena, chunks not smaller than 2MB are advised to use huge pages.
+CONF_Int64(hash_table_arena_chunk_size, "2097152");
+// Whether the chunks and big blocks of the hash table arena are advised to be backed by transparent huge pages.
+CONF_Bool(hash_table_arena_huge_pages, "false");
 
 CONF_mInt64(arrow_io_coalesce_read_max_buffer_size, "8388608");
 CONF_mInt64(arrow_io_coalesce_read_max_distance_size, "1048576");
@@ -37,6 +37,7 @@
 #include <gflags/gflags.h>
 
 #include "block_cache/block_cache.h"
+#include "column/column_buffer_pool.h"
 #include "column/column_helper.h"
 #include "column/column_pool.h"
 #include "common/config.h"
@@ -111,6 +112,14 @@ void gc_memory(void* arg_this) {
         ReleaseColumnPool releaser(kFreeRatio);
         ForEach<ColumnPoolList>(releaser);
         LOG_IF(INFO, releaser.freed_bytes() > 0) << "Released " << releaser.freed_bytes() << " bytes from column pool";
+
+        // all the cached buffers are given back under memory pressure, not only the idle ones.
+        auto* process_mem_tracker = GlobalEnv::GetInstance()->process_mem_tracker();
+        bool memory_urgent = process_mem_tracker != nullptr &&
+                             process_mem_tracker->limit_exceeded_by_ratio(config::memory_urgent_level);
+        size_t freed_buffer_bytes = memory_urgent ? ColumnBufferPool::instance()->release_all_buffers()
+                                                  : ColumnBufferPool::instance()->release_idle_buffers();
+        LOG_IF(INFO, freed_buffer_bytes > 0) << "Released " << freed_buffer_bytes << " bytes from column buffer pool";
     }
 }
 
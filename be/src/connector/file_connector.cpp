@@ -14,6 +14,7 @@
 
 #include "connector/file_connector.h"
 
+#include "common/config.h"
 #include "exec/avro_scanner.h"
 #include "exec/csv_scanner.h"
 #include "exec/exec_node.h"
@@ -73,10 +74,72 @@ Status FileDataSource::open(RuntimeState* state) {
     _tuple_desc = state->desc_tbl().get_tuple_descriptor(_provider->_file_scan_node.tuple_id);
     DCHECK(_tuple_desc != nullptr);
     _init_counter();
+    if (_split_context != nullptr) {
+        auto* split_context = down_cast<const FileSplitContext*>(_split_context);
+        TBrokerRangeDesc& range_desc = _scan_range.ranges[0];
+        range_desc.start_offset = split_context->split_start;
+        range_desc.size = split_context->split_end - split_context->split_start;
+    } else if (_morsel != nullptr && _could_split()) {
+        // The range is scanned by the split tasks, which are picked up by other scan operators.
+        _generate_split_tasks();
+        _scan_finished = true;
+        return Status::OK();
+    }
     RETURN_IF_ERROR(_create_scanner());
     return Status::OK();
 }
 
+bool FileDataSource::_could_split() const {
+    int64_t split_size = config::file_scan_split_size;
+    if (split_size <= 0 || _scan_range.ranges.size() != 1) {
+        return false;
+    }
+    const TBrokerRangeDesc& range_desc = _scan_range.ranges[0];
+    if (range_desc.format_type != TFileFormatType::FORMAT_CSV_PLAIN || range_desc.file_type == TFileType::FILE_STREAM ||
+        range_desc.size < 2 * split_size) {
+        return false;
+    }
+    if (range_desc.__isset.compression_type && range_desc.compression_type != TCompressionType::NO_COMPRESSION &&
+        range_desc.compression_type != TCompressionType::UNKNOWN_COMPRESSION) {
+        return false;
+    }
+    // A record may contain row delimiter if it is enclosed or escaped, so it can not be located by the row
+    // delimiter. And the header is only at the beginning of the file.
+    const TBrokerScanRangeParams& params = _scan_range.params;
+    if ((params.__isset.enclose && params.enclose != 0) || (params.__isset.escape && params.escape != 0)) {
+        return false;
+    }
+    return true;
+}
+
+// Each split task [start, end) reads the records which start in (start, end], except that the first one
+// also reads the record starting at the beginning of the range. It's the same as the ranges split by FE,
+// the csv scanner skips the first record if start offset > 0 and stops after the record crossing the end.
+void FileDataSource::_generate_split_tasks() {
+    const TBrokerRangeDesc& range_desc = _scan_range.ranges[0];
+    int64_t split_size = config::file_scan_split_size;
+    int64_t range_start = range_desc.start_offset;
+    int64_t range_end = range_desc.start_offset + range_desc.size;
+    for (int64_t start = range_start; start < range_end; start += split_size) {
+        auto split_context = std::make_unique<FileSplitContext>();
+        split_context->split_start = start;
+        // merge the small tail into the last task.
+        split_context->split_end = (range_end - start < 2 * split_size) ? range_end : start + split_size;
+        bool is_tail = split_context->split_end == range_end;
+        _split_tasks.emplace_back(std::move(split_context));
+        if (is_tail) {
+            break;
+        }
+    }
+}
+
+void FileDataSource::get_split_tasks(std::vector<pipeline::ScanSplitContextPtr>* split_tasks) {
+    for (auto& t : _split_tasks) {
+        split_tasks->emplace_back(std::move(t));
+    }
+    _split_tasks.clear();
+}
+
 Status FileDataSource::_create_scanner() {
     if (_scan_range.ranges.empty()) {
         return Status::EndOfFile("scan range is empty");
@@ -36,6 +36,12 @@ public:
 class FileDataSource;
 class FileDataSourceProvider;
 
+// A part [split_start, split_end) of a large csv file range which is scanned by an individual data source.
+struct FileSplitContext : public pipeline::ScanSplitContext {
+    int64_t split_start = 0;
+    int64_t split_end = 0;
+};
+
 class FileDataSourceProvider final : public DataSourceProvider {
 public:
     ~FileDataSourceProvider() override = default;
@@ -62,6 +68,7 @@ public:
     void close(RuntimeState* state) override;
     Status get_next(RuntimeState* state, ChunkPtr* chunk) override;
     const std::string get_custom_coredump_msg() const override;
+    void get_split_tasks(std::vector<pipeline::ScanSplitContextPtr>* split_tasks) override;
 
     int64_t raw_rows_read() const override;
     int64_t num_rows_read() const override;
@@ -79,6 +86,7 @@ private:
 
     std::unique_ptr<starrocks::FileScanner> _scanner;
     starrocks::ScannerCounter _counter;
+    std::vector<pipeline::ScanSplitContextPtr> _split_tasks;
 
     // Profile information
     RuntimeProfile::Counter* _scanner_total_timer = nullptr;
@@ -93,6 +101,11 @@ private:
     // =========================
     Status _create_scanner();
 
+    // Whether the scan range is a single large uncompressed csv file range, whose records can be located
+    // from any offset by the row delimiter.
+    bool _could_split() const;
+    void _generate_split_tasks();
+
     void _init_counter();
 
     void _update_counter();
@@ -517,6 +517,11 @@ Status HiveDataSource::_init_scanner(RuntimeState* state) {
     scanner_params.path = native_file_path;
     scanner_params.file_size = _scan_range.file_length;
     scanner_params.modification_time = _scan_range.modification_time;
+    if (hdfs_scan_node.__isset.qualified_table_name) {
+        scanner_params.table_name = hdfs_scan_node.qualified_table_name;
+    } else if (hdfs_scan_node.__isset.table_name) {
+        scanner_params.table_name = hdfs_scan_node.table_name;
+    }
     scanner_params.tuple_desc = _tuple_desc;
     scanner_params.materialize_slots = _materialize_slots;
     scanner_params.materialize_index_in_chunk = _materialize_index_in_chunk;
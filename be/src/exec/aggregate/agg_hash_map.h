@@ -27,9 +27,11 @@
 #include "common/compiler_util.h"
 #include "exec/aggregate/agg_hash_set.h"
 #include "exec/aggregate/agg_profile.h"
+#include "exprs/jit/jit_key_serializer.h"
 #include "gutil/casts.h"
 #include "gutil/strings/fastmem.h"
 #include "runtime/mem_pool.h"
+#include "runtime/memory/mem_arena.h"
 #include "util/fixed_hash_map.h"
 #include "util/hash_util.hpp"
 #include "util/phmap/phmap.h"
@@ -41,47 +43,51 @@ const constexpr int32_t prefetch_threhold = 8192;
 
 using AggDataPtr = uint8_t*;
 
+// Hash maps of aggregations allocate buckets from the arena of the fragment instance, see use_arena.
+template <class K, class V, class Hash, class Eq = phmap::priv::hash_default_eq<K>>
+using AggFlatHashMap = phmap::flat_hash_map<K, V, Hash, Eq, ArenaAllocator<phmap::priv::Pair<const K, V>>>;
+template <class K, class V, class Hash, class Eq = phmap::priv::hash_default_eq<K>, size_t N = 4>
+using AggParallelFlatHashMap =
+        phmap::parallel_flat_hash_map<K, V, Hash, Eq, ArenaAllocator<phmap::priv::Pair<const K, V>>, N>;
+
 // =====================
 // one level agg hash map
 template <PhmapSeed seed>
 using Int8AggHashMap = SmallFixedSizeHashMap<int8_t, AggDataPtr, seed>;
 template <PhmapSeed seed>
-using Int16AggHashMap = phmap::flat_hash_map<int16_t, AggDataPtr, StdHashWithSeed<int16_t, seed>>;
+using Int16AggHashMap = AggFlatHashMap<int16_t, AggDataPtr, StdHashWithSeed<int16_t, seed>>;
 template <PhmapSeed seed>
-using Int32AggHashMap = phmap::flat_hash_map<int32_t, AggDataPtr, StdHashWithSeed<int32_t, seed>>;
+using Int32AggHashMap = AggFlatHashMap<int32_t, AggDataPtr, StdHashWithSeed<int32_t, seed>>;
 template <PhmapSeed seed>
-using Int64AggHashMap = phmap::flat_hash_map<int64_t, AggDataPtr, StdHashWithSeed<int64_t, seed>>;
+using Int64AggHashMap = AggFlatHashMap<int64_t, AggDataPtr, StdHashWithSeed<int64_t, seed>>;
 template <PhmapSeed seed>
-using Int128AggHashMap = phmap::flat_hash_map<int128_t, AggDataPtr, Hash128WithSeed<seed>>;
+using Int128AggHashMap = AggFlatHashMap<int128_t, AggDataPtr, Hash128WithSeed<seed>>;
 template <PhmapSeed seed>
-using DateAggHashMap = phmap::flat_hash_map<DateValue, AggDataPtr, StdHashWithSeed<DateValue, seed>>;
+using DateAggHashMap = AggFlatHashMap<DateValue, AggDataPtr, StdHashWithSeed<DateValue, seed>>;
 template <PhmapSeed seed>
-using TimeStampAggHashMap = phmap::flat_hash_map<TimestampValue, AggDataPtr, StdHashWithSeed<TimestampValue, seed>>;
+using TimeStampAggHashMap = AggFlatHashMap<TimestampValue, AggDataPtr, StdHashWithSeed<TimestampValue, seed>>;
 template <PhmapSeed seed>
-using SliceAggHashMap = phmap::flat_hash_map<Slice, AggDataPtr, SliceHashWithSeed<seed>, SliceEqual>;
+using SliceAggHashMap = AggFlatHashMap<Slice, AggDataPtr, SliceHashWithSeed<seed>, SliceEqual>;
 
 // ==================
 // one level fixed size slice hash map
 template <PhmapSeed seed>
-using FixedSize4SliceAggHashMap = phmap::flat_hash_map<SliceKey4, AggDataPtr, FixedSizeSliceKeyHash<SliceKey4, seed>>;
+using FixedSize4SliceAggHashMap = AggFlatHashMap<SliceKey4, AggDataPtr, FixedSizeSliceKeyHash<SliceKey4, seed>>;
 template <PhmapSeed seed>
-using FixedSize8SliceAggHashMap = phmap::flat_hash_map<SliceKey8, AggDataPtr, FixedSizeSliceKeyHash<SliceKey8, seed>>;
+using FixedSize8SliceAggHashMap = AggFlatHashMap<SliceKey8, AggDataPtr, FixedSizeSliceKeyHash<SliceKey8, seed>>;
 template <PhmapSeed seed>
-using FixedSize16SliceAggHashMap =
-        phmap::flat_hash_map<SliceKey16, AggDataPtr, FixedSizeSliceKeyHash<SliceKey16, seed>>;
+using FixedSize16SliceAggHashMap = AggFlatHashMap<SliceKey16, AggDataPtr, FixedSizeSliceKeyHash<SliceKey16, seed>>;
 
 // =====================
 // two level agg hash map
 template <PhmapSeed seed>
-using Int32AggTwoLevelHashMap = phmap::parallel_flat_hash_map<int32_t, AggDataPtr, StdHashWithSeed<int32_t, seed>>;
+using Int32AggTwoLevelHashMap = AggParallelFlatHashMap<int32_t, AggDataPtr, StdHashWithSeed<int32_t, seed>>;
 
 // The SliceAggTwoLevelHashMap will have 2 ^ 4 = 16 sub map,
 // The 16 is same as PartitionedAggregationNode::PARTITION_FANOUT
 static constexpr uint8_t PHMAPN = 4;
 template <PhmapSeed seed>
-using SliceAggTwoLevelHashMap =
-        phmap::parallel_flat_hash_map<Slice, AggDataPtr, SliceHashWithSeed<seed>, SliceEqual,
-                                      phmap::priv::Allocator<phmap::priv::Pair<const Slice, AggDataPtr>>, PHMAPN>;
+using SliceAggTwoLevelHashMap = AggParallelFlatHashMap<Slice, AggDataPtr, SliceHashWithSeed<seed>, SliceEqual, PHMAPN>;
 
 // This is just an empirical value based on benchmark, and you can tweak it if more proper value is found.
 static constexpr size_t AGG_HASH_MAP_DEFAULT_PREFETCH_DIST = 16;
@@ -110,6 +116,8 @@ struct AggHashMapWithKey {
     using HashMapType = HashMap;
     HashMap hash_map;
     AggStatistics* agg_stat;
+    // serialize multi-column keys by a jit function for the key schema, only used by serialized keys.
+    bool enable_jit_key_serialize = false;
 
     ////// Common Methods ////////
     template <typename Func>
@@ -689,8 +697,16 @@ struct AggHashMapWithSerializedKey : public AggHashMapWithKey<HashMap, AggHashMa
             buffer = mem_pool->allocate(max_one_row_size * _chunk_size + SLICE_MEMEQUAL_OVERFLOW_PADDING);
         }
 
-        for (const auto& key_column : key_columns) {
-            key_column->serialize_batch(buffer, slice_sizes, chunk_size, max_one_row_size);
+        const JITKeySerializer* serializer = nullptr;
+        if (this->enable_jit_key_serialize && key_columns.size() > 1) {
+            serializer = JITKeySerializer::prepare(key_columns, &key_serializer);
+        }
+        if (serializer != nullptr) {
+            serializer->serialize(key_columns, 0, chunk_size, buffer, max_one_row_size, slice_sizes.data());
+        } else {
+            for (const auto& key_column : key_columns) {
+                key_column->serialize_batch(buffer, slice_sizes, chunk_size, max_one_row_size);
+            }
         }
 
         for (size_t i = 0; i < chunk_size; ++i) {
@@ -757,6 +773,7 @@ struct AggHashMapWithSerializedKey : public AggHashMapWithKey<HashMap, AggHashMa
     std::unique_ptr<MemPool> mem_pool;
     uint8_t* buffer;
     ResultVector results;
+    std::shared_ptr<JITKeySerializer> key_serializer;
 
     int32_t _chunk_size;
 };
@@ -175,12 +175,22 @@ void AggHashMapVariant::init(RuntimeState* state, Type type, AggStatistics* agg_
         APPLY_FOR_AGG_VARIANT_ALL(M)
 #undef M
     }
+    bool enable_jit_key_serialize = JITKeySerializer::is_enabled(state);
+    auto arena = state->instance_arena();
+    std::visit(
+            [&](auto& hash_map_with_key) {
+                hash_map_with_key->enable_jit_key_serialize = enable_jit_key_serialize;
+                use_arena(&hash_map_with_key->hash_map, arena);
+            },
+            hash_map_with_key);
 }
 
 #define CONVERT_TO_TWO_LEVEL_MAP(DST, SRC)                                                                            \
     if (_type == AggHashMapVariant::Type::SRC) {                                                                      \
         auto dst = std::make_unique<detail::AggHashMapVariantTypeTraits<Type::DST>::HashMapWithKeyType>(              \
                 state->chunk_size(), _agg_stat);                                                                      \
+        dst->enable_jit_key_serialize = JITKeySerializer::is_enabled(state);                                          \
+        use_arena(&dst->hash_map, state->instance_arena());                                                           \
         std::visit(                                                                                                   \
                 [&](auto& hash_map_with_key) {                                                                        \
                     if constexpr (std::is_same_v<typename decltype(hash_map_with_key->hash_map)::key_type,            \
@@ -250,12 +260,15 @@ void AggHashSetVariant::init(RuntimeState* state, Type type, AggStatistics* agg_
         APPLY_FOR_AGG_VARIANT_ALL(M)
 #undef M
     }
+    auto arena = state->instance_arena();
+    std::visit([&](auto& hash_set_with_key) { use_arena(&hash_set_with_key->hash_set, arena); }, hash_set_with_key);
 }
 
 #define CONVERT_TO_TWO_LEVEL_SET(DST, SRC)                                                                            \
     if (_type == AggHashSetVariant::Type::SRC) {                                                                      \
         auto dst = std::make_unique<detail::AggHashSetVariantTypeTraits<Type::DST>::HashSetWithKeyType>(              \
                 state->chunk_size());                                                                                 \
+        use_arena(&dst->hash_set, state->instance_arena());                                                           \
         std::visit(                                                                                                   \
                 [&](auto& hash_set_with_key) {                                                                        \
                     if constexpr (std::is_same_v<typename decltype(hash_set_with_key->hash_set)::key_type,            \
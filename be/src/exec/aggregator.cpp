@@ -31,6 +31,7 @@
 #include "gen_cpp/PlanNodes_types.h"
 #include "runtime/current_thread.h"
 #include "runtime/descriptors.h"
+#include "runtime/memory/mem_arena.h"
 #include "types/logical_type.h"
 #include "udf/java/utils.h"
 #include "util/runtime_profile.h"
@@ -613,6 +614,13 @@ void Aggregator::close(RuntimeState* state) {
             _mem_pool->free_all();
         }
 
+        if (_agg_stat != nullptr && !_group_by_expr_ctxs.empty()) {
+            // the arena is shared by all hash tables of the fragment instance.
+            if (auto arena = state->instance_arena(); arena != nullptr) {
+                auto* counter = ADD_COUNTER(_runtime_profile, "HashTableArenaReservedBytes", TUnit::BYTES);
+                COUNTER_SET(counter, static_cast<int64_t>(arena->total_reserved_bytes()));
+            }
+        }
         if (_is_only_group_by_columns) {
             _hash_set_variant.reset();
         } else {
@@ -256,7 +256,8 @@ Status CSVScanner::_init_reader() {
             RETURN_IF_ERROR(_curr_reader->next_record(&dummy));
         }
 
-        if (_parse_options.skip_header) {
+        // The header is only at the beginning of the file, a range split from the middle of the file has no header.
+        if (_parse_options.skip_header && _scan_range.ranges[_curr_file_index].start_offset == 0) {
             for (int64_t i = 0; i < _parse_options.skip_header; i++) {
                 CSVReader::Record dummy;
                 RETURN_IF_ERROR(_curr_reader->next_record(&dummy));
@@ -610,7 +610,8 @@ Status eager_prune_eval_conjuncts(const std::vector<ExprContext*>& ctxs, Chunk*
     int zero_count = 0;
 
     for (auto* ctx : ctxs) {
-        ASSIGN_OR_RETURN(ColumnPtr column, ctx->evaluate(chunk))
+        // the rows filtered by the previous conjuncts but not pruned yet are skipped if they are the majority.
+        ASSIGN_OR_RETURN(ColumnPtr column, ctx->evaluate(chunk, raw_filter->data()))
         size_t true_count = ColumnHelper::count_true_with_notnull(column);
 
         if (true_count == column->size()) {
@@ -674,7 +675,9 @@ Status ExecNode::eval_conjuncts(const std::vector<ExprContext*>& ctxs, Chunk* ch
     Filter* raw_filter = filter.get();
 
     for (auto* ctx : ctxs) {
-        ASSIGN_OR_RETURN(ColumnPtr column, ctx->evaluate(chunk))
+        // the chunk is compacted once after all conjuncts, the rows filtered by the previous conjuncts are skipped
+        // if they are the majority.
+        ASSIGN_OR_RETURN(ColumnPtr column, ctx->evaluate(chunk, raw_filter->data()))
         size_t true_count = ColumnHelper::count_true_with_notnull(column);
 
         if (true_count == column->size()) {
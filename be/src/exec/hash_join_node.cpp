@@ -182,6 +182,7 @@ Status HashJoinNode::prepare(RuntimeState* state) {
 
     HashTableParam param;
     _init_hash_table_param(&param);
+    param.arena = state->instance_arena();
     _ht.create(param);
 
     _output_probe_column_count = _ht.get_output_probe_column_count();
@@ -14,15 +14,24 @@
 
 #include "exec/hdfs_scanner.h"
 
+#include "block_cache/table_cache_metrics.h"
 #include "column/column_helper.h"
 #include "exec/exec_node.h"
 #include "fs/hdfs/fs_hdfs.h"
 #include "io/compressed_input_stream.h"
+#include "io/io_latency_model.h"
 #include "io/shared_buffered_input_stream.h"
 #include "util/compression/stream_compression.h"
+#include "util/hash_util.hpp"
 
 namespace starrocks {
 
+std::string build_file_meta_blob_key(const std::string& filename, int64_t mtime, int64_t file_size,
+                                     std::string_view kind) {
+    uint64_t hash_value = HashUtil::hash64(filename.data(), filename.size(), 0);
+    return fmt::format("meta_{}_{:016x}_{}_{}", kind, hash_value, mtime, file_size);
+}
+
 class CountedSeekableInputStream : public io::SeekableInputStreamWrapper {
 public:
     explicit CountedSeekableInputStream(const std::shared_ptr<io::SeekableInputStream>& stream, HdfsScanStats* stats)
@@ -221,9 +230,19 @@ Status HdfsScanner::open_random_access_file() {
     input_stream = std::make_shared<CountedSeekableInputStream>(input_stream, &_fs_stats);
 
     _shared_buffered_input_stream = std::make_shared<io::SharedBufferedInputStream>(input_stream, filename, file_size);
-    const io::SharedBufferedInputStream::CoalesceOptions options = {
+    io::SharedBufferedInputStream::CoalesceOptions options = {
             .max_dist_size = config::io_coalesce_read_max_distance_size,
             .max_buffer_size = config::io_coalesce_read_max_buffer_size};
+    if (config::io_coalesce_adaptive_distance_enable) {
+        // the reads of the same storage share one latency model, which is distinguished by the scheme of path.
+        const std::string& path = _scanner_params.path;
+        size_t pos = path.find("://");
+        auto* model = io::IOLatencyModel::get(pos == std::string::npos ? "local" : path.substr(0, pos));
+        options.max_dist_size = model->coalesce_distance(options.max_dist_size,
+                                                         config::io_coalesce_adaptive_min_distance_size,
+                                                         options.max_buffer_size / 2);
+        _shared_buffered_input_stream->set_latency_model(model);
+    }
     _shared_buffered_input_stream->set_coalesce_options(options);
     input_stream = _shared_buffered_input_stream;
 
@@ -374,6 +393,14 @@ void HdfsScanner::update_counter() {
             _runtime_state->update_num_datacache_write_time_ns(stats.write_cache_ns);
             _runtime_state->update_num_datacache_count(1);
         }
+
+        // the bytes read from remote storage are the misses of datacache
+        int64_t miss_bytes = 0;
+        if (_shared_buffered_input_stream) {
+            miss_bytes = _shared_buffered_input_stream->shared_io_bytes() +
+                         _shared_buffered_input_stream->direct_io_bytes();
+        }
+        TableCacheMetrics::instance()->update(_scanner_params.table_name, stats.read_cache_bytes, miss_bytes);
     }
     if (_shared_buffered_input_stream) {
         COUNTER_UPDATE(profile->shared_buffered_shared_io_count, _shared_buffered_input_stream->shared_io_count());
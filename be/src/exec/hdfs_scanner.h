@@ -39,6 +39,11 @@ struct HdfsSplitContext : public pipeline::ScanSplitContext {
 };
 using HdfsSplitContextPtr = std::unique_ptr<HdfsSplitContext>;
 
+// Key of the raw file metadata persisted in block cache, such as parquet footer and orc file tail.
+// `kind` distinguishes different metadata of the same file.
+std::string build_file_meta_blob_key(const std::string& filename, int64_t mtime, int64_t file_size,
+                                     std::string_view kind);
+
 struct HdfsScanStats {
     int64_t raw_rows_read = 0;
     int64_t rows_read = 0;
@@ -66,6 +71,8 @@ struct HdfsScanStats {
     int64_t footer_cache_read_count = 0;
     int64_t footer_cache_write_count = 0;
     int64_t footer_cache_write_bytes = 0;
+    int64_t footer_disk_cache_read_count = 0;
+    int64_t footer_disk_cache_write_count = 0;
     int64_t column_reader_init_ns = 0;
     // dict filter
     int64_t group_chunk_read_ns = 0;
@@ -81,6 +88,10 @@ struct HdfsScanStats {
     // page index
     int64_t rows_before_page_index = 0;
     int64_t page_index_ns = 0;
+    // row group skipped by dict page and bloom filter
+    int64_t dict_page_skip_groups = 0;
+    int64_t bloom_filter_skip_groups = 0;
+    int64_t bloom_filter_ns = 0;
 
     // late materialize round-by-round
     int64_t group_min_round_cost = 0;
@@ -175,6 +186,9 @@ struct HdfsScannerParams {
     // The file last modification time
     int64_t modification_time = 0;
 
+    // catalog.db.table of the table to scan, used to label the table level metrics
+    std::string table_name;
+
     const TupleDescriptor* tuple_desc = nullptr;
 
     // columns read from file
@@ -16,6 +16,8 @@
 
 #include <utility>
 
+#include "block_cache/block_cache.h"
+#include "common/config.h"
 #include "exec/exec_node.h"
 #include "exec/iceberg/iceberg_delete_builder.h"
 #include "formats/orc/orc_chunk_reader.h"
@@ -457,6 +459,28 @@ Status HdfsOrcScanner::do_open(RuntimeState* runtime_state) {
     }
     ORCHdfsFileStream* orc_hdfs_file_stream = _input_stream.get();
 
+    // The file tail (postscript and footer) persisted in disk cache survives restart, so it's read before
+    // going to the remote storage.
+    BlockCache* cache = nullptr;
+#ifdef WITH_STARCACHE
+    if (_scanner_ctx.use_file_metacache && config::datacache_enable && config::datacache_persist_file_metadata &&
+        _scanner_ctx.split_context == nullptr) {
+        cache = BlockCache::instance();
+    }
+#endif
+    std::string file_tail_key;
+    std::string file_tail;
+    if (cache != nullptr) {
+        SCOPED_RAW_TIMER(&_app_stats.footer_cache_read_ns);
+        file_tail_key = build_file_meta_blob_key(_file->filename(), _scanner_params.modification_time,
+                                                 _scanner_params.file_size, "orc_file_tail");
+        auto res = cache->read_blob(file_tail_key);
+        if (res.ok()) {
+            file_tail = std::move(res).value();
+            _app_stats.footer_disk_cache_read_count += 1;
+        }
+    }
+
     // create orc reader on this input stream.
     SCOPED_RAW_TIMER(&_app_stats.reader_init_ns);
     std::unique_ptr<orc::Reader> reader;
@@ -467,8 +491,18 @@ Status HdfsOrcScanner::do_open(RuntimeState* runtime_state) {
         if (_scanner_ctx.split_context != nullptr) {
             auto* split_context = down_cast<const SplitContext*>(_scanner_ctx.split_context);
             options.setSerializedFileTail(*(split_context->footer.get()));
+        } else if (!file_tail.empty()) {
+            options.setSerializedFileTail(file_tail);
         }
         reader = orc::createReader(std::move(_input_stream), options);
+        if (cache != nullptr && file_tail.empty()) {
+            Status st = cache->write_blob(file_tail_key, reader->getSerializedFileTail());
+            if (st.ok()) {
+                _app_stats.footer_disk_cache_write_count += 1;
+            } else if (!st.is_already_exist() && !st.is_cancelled()) {
+                LOG(WARNING) << "write orc file tail to disk cache failed, file: " << _file->filename() << ", " << st;
+            }
+        }
     } catch (std::exception& e) {
         bool is_not_found = (errno == ENOENT);
         auto s = strings::Substitute("HdfsOrcScanner::do_open failed. reason = $0", e.what());
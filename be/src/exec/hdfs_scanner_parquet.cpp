@@ -60,6 +60,8 @@ void HdfsParquetScanner::do_update_counter(HdfsScanProfile* profile) {
     RuntimeProfile::Counter* footer_cache_write_bytes = nullptr;
     RuntimeProfile::Counter* footer_cache_read_counter = nullptr;
     RuntimeProfile::Counter* footer_cache_read_timer = nullptr;
+    RuntimeProfile::Counter* footer_disk_cache_read_counter = nullptr;
+    RuntimeProfile::Counter* footer_disk_cache_write_counter = nullptr;
     RuntimeProfile::Counter* column_reader_init_timer = nullptr;
 
     // dict filter
@@ -80,6 +82,10 @@ void HdfsParquetScanner::do_update_counter(HdfsScanProfile* profile) {
     // page index
     RuntimeProfile::Counter* rows_before_page_index = nullptr;
     RuntimeProfile::Counter* page_index_timer = nullptr;
+    // dict page and bloom filter
+    RuntimeProfile::Counter* dict_page_skip_groups = nullptr;
+    RuntimeProfile::Counter* bloom_filter_skip_groups = nullptr;
+    RuntimeProfile::Counter* bloom_filter_timer = nullptr;
 
     RuntimeProfile* root = profile->runtime_profile;
     ADD_COUNTER(root, kParquetProfileSectionPrefix, TUnit::NONE);
@@ -94,6 +100,10 @@ void HdfsParquetScanner::do_update_counter(HdfsScanProfile* profile) {
     footer_cache_read_counter =
             ADD_CHILD_COUNTER(root, "FooterCacheReadCount", TUnit::UNIT, kParquetProfileSectionPrefix);
     footer_cache_read_timer = ADD_CHILD_TIMER(root, "FooterCacheReadTimer", kParquetProfileSectionPrefix);
+    footer_disk_cache_read_counter =
+            ADD_CHILD_COUNTER(root, "FooterDiskCacheReadCount", TUnit::UNIT, kParquetProfileSectionPrefix);
+    footer_disk_cache_write_counter =
+            ADD_CHILD_COUNTER(root, "FooterDiskCacheWriteCount", TUnit::UNIT, kParquetProfileSectionPrefix);
 
     level_decode_timer = ADD_CHILD_TIMER(root, "LevelDecodeTime", kParquetProfileSectionPrefix);
     value_decode_timer = ADD_CHILD_TIMER(root, "ValueDecodeTime", kParquetProfileSectionPrefix);
@@ -118,6 +128,10 @@ void HdfsParquetScanner::do_update_counter(HdfsScanProfile* profile) {
             kParquetProfileSectionPrefix);
     rows_before_page_index = ADD_CHILD_COUNTER(root, "RowsBeforePageIndex", TUnit::UNIT, kParquetProfileSectionPrefix);
     page_index_timer = ADD_CHILD_TIMER(root, "PageIndexTime", kParquetProfileSectionPrefix);
+    dict_page_skip_groups = ADD_CHILD_COUNTER(root, "DictPageSkipGroups", TUnit::UNIT, kParquetProfileSectionPrefix);
+    bloom_filter_skip_groups =
+            ADD_CHILD_COUNTER(root, "BloomFilterSkipGroups", TUnit::UNIT, kParquetProfileSectionPrefix);
+    bloom_filter_timer = ADD_CHILD_TIMER(root, "BloomFilterTime", kParquetProfileSectionPrefix);
 
     COUNTER_UPDATE(request_bytes_read, _app_stats.request_bytes_read);
     COUNTER_UPDATE(request_bytes_read_uncompressed, _app_stats.request_bytes_read_uncompressed);
@@ -129,6 +143,8 @@ void HdfsParquetScanner::do_update_counter(HdfsScanProfile* profile) {
     COUNTER_UPDATE(footer_cache_write_bytes, _app_stats.footer_cache_write_bytes);
     COUNTER_UPDATE(footer_cache_read_counter, _app_stats.footer_cache_read_count);
     COUNTER_UPDATE(footer_cache_read_timer, _app_stats.footer_cache_read_ns);
+    COUNTER_UPDATE(footer_disk_cache_read_counter, _app_stats.footer_disk_cache_read_count);
+    COUNTER_UPDATE(footer_disk_cache_write_counter, _app_stats.footer_disk_cache_write_count);
     COUNTER_UPDATE(column_reader_init_timer, _app_stats.column_reader_init_ns);
     COUNTER_UPDATE(group_chunk_read_timer, _app_stats.group_chunk_read_ns);
     COUNTER_UPDATE(group_dict_filter_timer, _app_stats.group_dict_filter_ns);
@@ -142,6 +158,9 @@ void HdfsParquetScanner::do_update_counter(HdfsScanProfile* profile) {
     do_update_iceberg_v2_counter(root, kParquetProfileSectionPrefix);
     COUNTER_UPDATE(rows_before_page_index, _app_stats.rows_before_page_index);
     COUNTER_UPDATE(page_index_timer, _app_stats.page_index_ns);
+    COUNTER_UPDATE(dict_page_skip_groups, _app_stats.dict_page_skip_groups);
+    COUNTER_UPDATE(bloom_filter_skip_groups, _app_stats.bloom_filter_skip_groups);
+    COUNTER_UPDATE(bloom_filter_timer, _app_stats.bloom_filter_ns);
 }
 
 Status HdfsParquetScanner::do_open(RuntimeState* runtime_state) {
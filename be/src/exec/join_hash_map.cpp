@@ -22,6 +22,7 @@
 #include "column/vectorized_fwd.h"
 #include "common/statusor.h"
 #include "exec/hash_join_node.h"
+#include "exprs/jit/jit_key_serializer.h"
 #include "serde/column_array_serde.h"
 #include "simd/simd.h"
 
@@ -74,6 +75,7 @@ void HashTableProbeState::consider_probe_time_locality() {
 }
 
 void SerializedJoinBuildFunc::prepare(RuntimeState* state, JoinHashTableItems* table_items) {
+    table_items->enable_jit_key_serialize = JITKeySerializer::is_enabled(state);
     table_items->bucket_size = JoinHashMapHelper::calc_bucket_size(table_items->row_count + 1);
     table_items->first.resize(table_items->bucket_size, 0);
     table_items->next.resize(table_items->row_count + 1, 0);
@@ -110,6 +112,14 @@ void SerializedJoinBuildFunc::construct_hash_table(RuntimeState* state, JoinHash
     }
     uint8_t* ptr = table_items->build_pool->allocate(serialize_size);
 
+    std::shared_ptr<JITKeySerializer> key_serializer;
+    const JITKeySerializer* serializer = nullptr;
+    Buffer<uint32_t> sizes;
+    if (table_items->enable_jit_key_serialize && data_columns.size() > 1) {
+        serializer = JITKeySerializer::prepare(data_columns, &key_serializer);
+        sizes.resize(state->chunk_size());
+    }
+
     // serialize and build hash table
     uint32_t quo = row_count / state->chunk_size();
     uint32_t rem = row_count % state->chunk_size();
@@ -117,28 +127,47 @@ void SerializedJoinBuildFunc::construct_hash_table(RuntimeState* state, JoinHash
     if (!null_columns.empty()) {
         for (size_t i = 0; i < quo; i++) {
             _build_nullable_columns(table_items, probe_state, data_columns, null_columns, 1 + state->chunk_size() * i,
-                                    state->chunk_size(), &ptr);
+                                    state->chunk_size(), &ptr, serializer, &sizes);
         }
         _build_nullable_columns(table_items, probe_state, data_columns, null_columns, 1 + state->chunk_size() * quo,
-                                rem, &ptr);
+                                rem, &ptr, serializer, &sizes);
     } else {
         for (size_t i = 0; i < quo; i++) {
             _build_columns(table_items, probe_state, data_columns, 1 + state->chunk_size() * i, state->chunk_size(),
-                           &ptr);
+                           &ptr, serializer, &sizes);
         }
-        _build_columns(table_items, probe_state, data_columns, 1 + state->chunk_size() * quo, rem, &ptr);
+        _build_columns(table_items, probe_state, data_columns, 1 + state->chunk_size() * quo, rem, &ptr, serializer,
+                       &sizes);
     }
     table_items->calculate_ht_info(serialize_size);
 }
 
-void SerializedJoinBuildFunc::_build_columns(JoinHashTableItems* table_items, HashTableProbeState* probe_state,
-                                             const Columns& data_columns, uint32_t start, uint32_t count,
-                                             uint8_t** ptr) {
+void SerializedJoinBuildFunc::_jit_serialize_keys(JoinHashTableItems* table_items, const JITKeySerializer* serializer,
+                                                  const Columns& data_columns, uint32_t start, uint32_t count,
+                                                  uint8_t** ptr, Buffer<uint32_t>* sizes) {
+    serializer->serialize(data_columns, start, count, *ptr, 0, sizes->data());
     for (size_t i = 0; i < count; i++) {
-        table_items->build_slice[start + i] = JoinHashMapHelper::get_hash_key(data_columns, start + i, *ptr);
-        probe_state->buckets[i] = JoinHashMapHelper::calc_bucket_num<Slice>(table_items->build_slice[start + i],
-                                                                            table_items->bucket_size);
-        *ptr += table_items->build_slice[start + i].size;
+        table_items->build_slice[start + i] = {*ptr, (*sizes)[i]};
+        *ptr += (*sizes)[i];
+    }
+}
+
+void SerializedJoinBuildFunc::_build_columns(JoinHashTableItems* table_items, HashTableProbeState* probe_state,
+                                             const Columns& data_columns, uint32_t start, uint32_t count, uint8_t** ptr,
+                                             const JITKeySerializer* serializer, Buffer<uint32_t>* sizes) {
+    if (serializer != nullptr) {
+        _jit_serialize_keys(table_items, serializer, data_columns, start, count, ptr, sizes);
+        for (size_t i = 0; i < count; i++) {
+            probe_state->buckets[i] = JoinHashMapHelper::calc_bucket_num<Slice>(table_items->build_slice[start + i],
+                                                                                table_items->bucket_size);
+        }
+    } else {
+        for (size_t i = 0; i < count; i++) {
+            table_items->build_slice[start + i] = JoinHashMapHelper::get_hash_key(data_columns, start + i, *ptr);
+            probe_state->buckets[i] = JoinHashMapHelper::calc_bucket_num<Slice>(table_items->build_slice[start + i],
+                                                                                table_items->bucket_size);
+            *ptr += table_items->build_slice[start + i].size;
+        }
     }
 
     for (size_t i = 0; i < count; i++) {
@@ -149,7 +178,8 @@ void SerializedJoinBuildFunc::_build_columns(JoinHashTableItems* table_items, Ha
 
 void SerializedJoinBuildFunc::_build_nullable_columns(JoinHashTableItems* table_items, HashTableProbeState* probe_state,
                                                       const Columns& data_columns, const NullColumns& null_columns,
-                                                      uint32_t start, uint32_t count, uint8_t** ptr) {
+                                                      uint32_t start, uint32_t count, uint8_t** ptr,
+                                                      const JITKeySerializer* serializer, Buffer<uint32_t>* sizes) {
     for (uint32_t i = 0; i < count; i++) {
         probe_state->is_nulls[i] = null_columns[0]->get_data()[start + i];
     }
@@ -159,12 +189,22 @@ void SerializedJoinBuildFunc::_build_nullable_columns(JoinHashTableItems* table_
         }
     }
 
-    for (size_t i = 0; i < count; i++) {
-        if (probe_state->is_nulls[i] == 0) {
-            table_items->build_slice[start + i] = JoinHashMapHelper::get_hash_key(data_columns, start + i, *ptr);
-            probe_state->buckets[i] = JoinHashMapHelper::calc_bucket_num<Slice>(table_items->build_slice[start + i],
-                                                                                table_items->bucket_size);
-            *ptr += table_items->build_slice[start + i].size;
+    if (serializer != nullptr) {
+        _jit_serialize_keys(table_items, serializer, data_columns, start, count, ptr, sizes);
+        for (size_t i = 0; i < count; i++) {
+            if (probe_state->is_nulls[i] == 0) {
+                probe_state->buckets[i] = JoinHashMapHelper::calc_bucket_num<Slice>(
+                        table_items->build_slice[start + i], table_items->bucket_size);
+            }
+        }
+    } else {
+        for (size_t i = 0; i < count; i++) {
+            if (probe_state->is_nulls[i] == 0) {
+                table_items->build_slice[start + i] = JoinHashMapHelper::get_hash_key(data_columns, start + i, *ptr);
+                probe_state->buckets[i] = JoinHashMapHelper::calc_bucket_num<Slice>(
+                        table_items->build_slice[start + i], table_items->bucket_size);
+                *ptr += table_items->build_slice[start + i].size;
+            }
         }
     }
 
@@ -207,8 +247,15 @@ void SerializedJoinProbeFunc::lookup_init(const JoinHashTableItems& table_items,
     }
     uint8_t* ptr = probe_state->probe_pool->allocate(serialize_size);
 
+    const JITKeySerializer* serializer = nullptr;
+    if (table_items.enable_jit_key_serialize && data_columns.size() > 1) {
+        serializer = JITKeySerializer::prepare(data_columns, &probe_state->key_serializer);
+    }
+
     // serialize and init search
-    if (!null_columns.empty()) {
+    if (serializer != nullptr) {
+        _jit_probe_columns(table_items, probe_state, serializer, data_columns, null_columns, ptr);
+    } else if (!null_columns.empty()) {
         _probe_nullable_column(table_items, probe_state, data_columns, null_columns, ptr);
     } else {
         _probe_column(table_items, probe_state, data_columns, ptr);
@@ -216,6 +263,50 @@ void SerializedJoinProbeFunc::lookup_init(const JoinHashTableItems& table_items,
     probe_state->consider_probe_time_locality();
 }
 
+void SerializedJoinProbeFunc::_jit_probe_columns(const JoinHashTableItems& table_items,
+                                                 HashTableProbeState* probe_state, const JITKeySerializer* serializer,
+                                                 const Columns& data_columns, const NullColumns& null_columns,
+                                                 uint8_t* ptr) {
+    uint32_t row_count = probe_state->probe_row_count;
+    auto* sizes = probe_state->probe_slice_sizes.data();
+    // keys of null rows are serialized too but never referenced.
+    serializer->serialize(data_columns, 0, row_count, ptr, 0, sizes);
+    for (uint32_t i = 0; i < row_count; i++) {
+        probe_state->probe_slice[i] = {ptr, sizes[i]};
+        ptr += sizes[i];
+    }
+
+    if (null_columns.empty()) {
+        for (uint32_t i = 0; i < row_count; i++) {
+            probe_state->buckets[i] =
+                    JoinHashMapHelper::calc_bucket_num<Slice>(probe_state->probe_slice[i], table_items.bucket_size);
+        }
+        for (uint32_t i = 0; i < row_count; i++) {
+            probe_state->next[i] = table_items.first[probe_state->buckets[i]];
+        }
+        return;
+    }
+
+    for (uint32_t i = 0; i < row_count; i++) {
+        probe_state->is_nulls[i] = null_columns[0]->get_data()[i];
+    }
+    for (uint32_t i = 1; i < null_columns.size(); i++) {
+        for (uint32_t j = 0; j < row_count; j++) {
+            probe_state->is_nulls[j] |= null_columns[i]->get_data()[j];
+        }
+    }
+    probe_state->null_array = &null_columns[0]->get_data();
+    for (uint32_t i = 0; i < row_count; i++) {
+        if (probe_state->is_nulls[i] == 0) {
+            probe_state->buckets[i] =
+                    JoinHashMapHelper::calc_bucket_num<Slice>(probe_state->probe_slice[i], table_items.bucket_size);
+            probe_state->next[i] = table_items.first[probe_state->buckets[i]];
+        } else {
+            probe_state->next[i] = 0;
+        }
+    }
+}
+
 void SerializedJoinProbeFunc::_probe_column(const JoinHashTableItems& table_items, HashTableProbeState* probe_state,
                                             const Columns& data_columns, uint8_t* ptr) {
     uint32_t row_count = probe_state->probe_row_count;
@@ -350,6 +441,8 @@ void JoinHashTable::create(const HashTableParam& param) {
         _table_items->right_to_nullable = true;
     }
     _table_items->join_keys = param.join_keys;
+    use_arena(&_table_items->first, param.arena);
+    use_arena(&_table_items->next, param.arena);
 
     _init_probe_column(param);
     _init_build_column(param);
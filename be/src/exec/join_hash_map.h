@@ -28,6 +28,7 @@
 #include "column/column_hash.h"
 #include "column/column_helper.h"
 #include "column/vectorized_fwd.h"
+#include "runtime/memory/mem_arena.h"
 #include "simd/simd.h"
 #include "util/phmap/phmap.h"
 
@@ -37,6 +38,7 @@
 namespace starrocks {
 
 class ColumnRef;
+class JITKeySerializer;
 
 #define APPLY_FOR_JOIN_VARIANTS(M) \
     M(empty)                       \
@@ -110,8 +112,9 @@ struct JoinHashTableItems {
     // the list of keys in a bucket.
     // A paper (https://dare.uva.nl/search?identifier=5ccbb60a-38b8-4eeb-858a-e7735dd37487) talks
     // about the bucket-chained hash table of this kind.
-    Buffer<uint32_t> first;
-    Buffer<uint32_t> next;
+    // They are allocated from the arena of the fragment instance if HashTableParam.arena is set.
+    ArenaBuffer<uint32_t> first;
+    ArenaBuffer<uint32_t> next;
     Buffer<Slice> build_slice;
     ColumnPtr build_key_column = nullptr;
     uint32_t bucket_size = 0;
@@ -137,7 +140,7 @@ struct JoinHashTableItems {
 
     void calculate_ht_info(size_t key_bytes) {
         if (used_buckets == 0) { // to avoid redo
-            used_buckets = SIMD::count_nonzero(first);
+            used_buckets = first.size() - SIMD::count_zero(first.data(), first.size());
             keys_per_bucket = used_buckets == 0 ? 0 : row_count * 1.0 / used_buckets;
             size_t probe_bytes = key_bytes + row_count * sizeof(uint32_t);
             // cache miss is serious when
@@ -155,6 +158,8 @@ struct JoinHashTableItems {
 
     std::unique_ptr<MemPool> build_pool = nullptr;
     std::vector<JoinKeyDesc> join_keys;
+    // serialize multi-column keys by a jit function for the key schema.
+    bool enable_jit_key_serialize = false;
 };
 
 struct HashTableProbeState {
@@ -193,6 +198,9 @@ struct HashTableProbeState {
     uint32_t cur_row_match_count = 0;
 
     std::unique_ptr<MemPool> probe_pool = nullptr;
+    // the serializer of probe keys and the serialized size of each row, if probe keys are serialized by jit.
+    std::shared_ptr<JITKeySerializer> key_serializer;
+    Buffer<uint32_t> probe_slice_sizes;
 
     RuntimeProfile::Counter* search_ht_timer = nullptr;
     RuntimeProfile::Counter* output_probe_column_timer = nullptr;
@@ -255,6 +263,8 @@ struct HashTableProbeState {
               cur_build_index(rhs.cur_build_index),
               cur_row_match_count(rhs.cur_row_match_count),
               probe_pool(rhs.probe_pool == nullptr ? nullptr : std::make_unique<MemPool>()),
+              key_serializer(rhs.key_serializer),
+              probe_slice_sizes(rhs.probe_slice_sizes),
               search_ht_timer(rhs.search_ht_timer),
               output_probe_column_timer(rhs.output_probe_column_timer) {}
 
@@ -289,6 +299,8 @@ struct HashTableParam {
     RuntimeProfile::Counter* output_build_column_timer = nullptr;
     RuntimeProfile::Counter* output_probe_column_timer = nullptr;
     bool mor_reader_mode = false;
+    // arena of the buckets, nullptr means the global allocator.
+    std::shared_ptr<MemArena> arena = nullptr;
 };
 
 template <class T>
@@ -437,11 +449,19 @@ public:
 
 private:
     static void _build_columns(JoinHashTableItems* table_items, HashTableProbeState* probe_state,
-                               const Columns& data_columns, uint32_t start, uint32_t count, uint8_t** ptr);
+                               const Columns& data_columns, uint32_t start, uint32_t count, uint8_t** ptr,
+                               const JITKeySerializer* serializer, Buffer<uint32_t>* sizes);
 
     static void _build_nullable_columns(JoinHashTableItems* table_items, HashTableProbeState* probe_state,
                                         const Columns& data_columns, const NullColumns& null_columns, uint32_t start,
-                                        uint32_t count, uint8_t** ptr);
+                                        uint32_t count, uint8_t** ptr, const JITKeySerializer* serializer,
+                                        Buffer<uint32_t>* sizes);
+
+    // Serialize keys of rows [start, start + count) by the jit function into `build_slice`, keys of null rows are
+    // serialized too but never referenced.
+    static void _jit_serialize_keys(JoinHashTableItems* table_items, const JITKeySerializer* serializer,
+                                    const Columns& data_columns, uint32_t start, uint32_t count, uint8_t** ptr,
+                                    Buffer<uint32_t>* sizes);
 };
 
 template <LogicalType LT>
@@ -503,6 +523,7 @@ public:
         probe_state->probe_pool = std::make_unique<MemPool>();
         probe_state->probe_slice.resize(state->chunk_size());
         probe_state->is_nulls.resize(state->chunk_size());
+        probe_state->probe_slice_sizes.resize(state->chunk_size());
     }
 
     static void lookup_init(const JoinHashTableItems& table_items, HashTableProbeState* probe_state);
@@ -514,6 +535,10 @@ private:
                               const Columns& data_columns, uint8_t* ptr);
     static void _probe_nullable_column(const JoinHashTableItems& table_items, HashTableProbeState* probe_state,
                                        const Columns& data_columns, const NullColumns& null_columns, uint8_t* ptr);
+    // Serialize keys by the jit function, then init search as `_probe_column` or `_probe_nullable_column` does.
+    static void _jit_probe_columns(const JoinHashTableItems& table_items, HashTableProbeState* probe_state,
+                                   const JITKeySerializer* serializer, const Columns& data_columns,
+                                   const NullColumns& null_columns, uint8_t* ptr);
 };
 
 // When hash table is empty, specific its implemention.
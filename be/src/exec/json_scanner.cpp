@@ -25,6 +25,7 @@
 #include "column/adaptive_nullable_column.h"
 #include "column/chunk.h"
 #include "column/column_helper.h"
+#include "common/config.h"
 #include "exec/json_parser.h"
 #include "exprs/cast_expr.h"
 #include "exprs/column_ref.h"
@@ -675,9 +676,93 @@ Status JsonReader::_construct_row_with_jsonpath(simdjson::ondemand::object* row,
     return Status::OK();
 }
 
+void JsonReader::_compile_json_paths(Chunk* chunk) {
+    _json_paths_compiled = true;
+    _flat_json_paths.clear();
+    if (!config::enable_json_load_flat_path_projection) {
+        return;
+    }
+
+    size_t jsonpath_size = _scanner->_json_paths.size();
+    for (size_t i = 0; i < _slot_descs.size() && i < jsonpath_size; i++) {
+        if (_slot_descs[i] == nullptr) {
+            continue;
+        }
+        const auto& path = _scanner->_json_paths[i];
+        // Only "$.key" is flat, "$", "$.a.b", "$.a[0]" and "$.*" are extracted by JsonFunctions.
+        if (path.size() != 2 || path[0].key != "$" || !path[1].is_valid || path[1].idx != -1 ||
+            path[1].key.empty() || path[1].key == "*") {
+            _flat_json_paths.clear();
+            return;
+        }
+        int column_index = chunk->get_index_by_slot_id(_slot_descs[i]->id());
+        if (!_flat_json_paths.emplace(path[1].key, FlatJsonPathItem{_slot_descs[i], column_index}).second) {
+            // the same key is mapped to several columns.
+            _flat_json_paths.clear();
+            return;
+        }
+    }
+}
+
+Status JsonReader::_construct_row_with_flat_jsonpath(simdjson::ondemand::object* row, Chunk* chunk) {
+    _parsed_columns.assign(chunk->num_columns(), false);
+
+    try {
+        size_t num_found = 0;
+        for (auto field : *row) {
+            std::string_view key = field.unescaped_key();
+            auto itr = _flat_json_paths.find(key);
+            if (itr == _flat_json_paths.end() || _parsed_columns[itr->second.column_index]) {
+                // the value of unused field is skipped by simdjson without being parsed.
+                continue;
+            }
+
+            int column_index = itr->second.column_index;
+            SlotDescriptor* slot_desc = itr->second.slot_desc;
+            _parsed_columns[column_index] = true;
+            auto& column = chunk->get_column_by_index(column_index);
+            simdjson::ondemand::value val = field.value();
+            RETURN_IF_ERROR(_construct_column(val, column.get(), slot_desc->type(), slot_desc->col_name()));
+
+            if (++num_found == _flat_json_paths.size()) {
+                // all needed fields are found, the rest of the object is skipped when the parser advances.
+                break;
+            }
+        }
+    } catch (simdjson::simdjson_error& e) {
+        auto err_msg = strings::Substitute("construct row with flat jsonpath failed, error: $0",
+                                           simdjson::error_message(e.error()));
+        return Status::DataQualityError(err_msg);
+    }
+
+    // append null to the column without data.
+    for (int i = 0; i < chunk->num_columns(); i++) {
+        if (!_parsed_columns[i]) {
+            auto& column = chunk->get_column_by_index(i);
+            if (UNLIKELY(i == _op_col_index)) {
+                // special treatment for __op column, fill default value '0' rather than null
+                if (column->is_binary()) {
+                    std::ignore = column->append_strings(std::vector{Slice{"0"}});
+                } else {
+                    column->append_datum(Datum((uint8_t)0));
+                }
+            } else {
+                column->append_nulls(1);
+            }
+        }
+    }
+    return Status::OK();
+}
+
 Status JsonReader::_construct_row(simdjson::ondemand::object* row, Chunk* chunk) {
     if (_scanner->_json_paths.empty()) return _construct_row_without_jsonpath(row, chunk);
 
+    if (UNLIKELY(!_json_paths_compiled)) {
+        _compile_json_paths(chunk);
+    }
+    if (!_flat_json_paths.empty()) {
+        return _construct_row_with_flat_jsonpath(row, chunk);
+    }
     return _construct_row_with_jsonpath(row, chunk);
 }
 
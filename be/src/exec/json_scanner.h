@@ -116,6 +116,12 @@ private:
 
     Status _construct_row_without_jsonpath(simdjson::ondemand::object* row, Chunk* chunk);
     Status _construct_row_with_jsonpath(simdjson::ondemand::object* row, Chunk* chunk);
+    // Construct row for jsonpaths which are all top-level keys, e.g. ["$.k1", "$.k2"], by iterating
+    // the json object once and skipping the rest of it as soon as all keys are found.
+    Status _construct_row_with_flat_jsonpath(simdjson::ondemand::object* row, Chunk* chunk);
+
+    // Compile jsonpaths into _flat_json_paths if all of them are top-level keys.
+    void _compile_json_paths(Chunk* chunk);
 
     Status _construct_column(simdjson::ondemand::value& value, Column* column, const TypeDescriptor& type_desc,
                              const std::string& col_name);
@@ -150,6 +156,15 @@ private:
     // record the "__op" column's index
     int _op_col_index;
 
+    struct FlatJsonPathItem {
+        SlotDescriptor* slot_desc;
+        int column_index;
+    };
+    bool _json_paths_compiled = false;
+    // key of top-level jsonpath -> slot and chunk column index, empty if any jsonpath is not a top-level key.
+    // Attention: the key is the string_view of the key of _scanner->_json_paths.
+    std::unordered_map<std::string_view, FlatJsonPathItem> _flat_json_paths;
+
     ByteBufferPtr _file_stream_buffer;
 
     std::unique_ptr<char[]> _file_broker_buffer = nullptr;
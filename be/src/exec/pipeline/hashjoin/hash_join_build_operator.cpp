@@ -18,6 +18,7 @@
 
 #include "exec/pipeline/query_context.h"
 #include "runtime/current_thread.h"
+#include "runtime/memory/mem_arena.h"
 #include "runtime/runtime_filter_worker.h"
 #include "util/race_detect.h"
 namespace starrocks::pipeline {
@@ -54,6 +55,11 @@ Status HashJoinBuildOperator::prepare(RuntimeState* state) {
 void HashJoinBuildOperator::close(RuntimeState* state) {
     COUNTER_SET(_join_builder->build_metrics().hash_table_memory_usage,
                 _join_builder->hash_join_builder()->hash_table_mem_usage());
+    // the arena is shared by all hash tables of the fragment instance.
+    if (auto arena = state->instance_arena(); arena != nullptr) {
+        auto* counter = ADD_COUNTER(_unique_metrics, "HashTableArenaReservedBytes", TUnit::BYTES);
+        COUNTER_SET(counter, static_cast<int64_t>(arena->total_reserved_bytes()));
+    }
     _join_builder->unref(state);
 
     Operator::close(state);
@@ -23,6 +23,7 @@
 #include "exprs/runtime_filter_bank.h"
 #include "gutil/strings/substitute.h"
 #include "runtime/mem_tracker.h"
+#include "util/perf_event_counters.h"
 #include "util/runtime_profile.h"
 
 namespace starrocks {
@@ -308,6 +309,9 @@ protected:
     RuntimeProfile::Counter* _conjuncts_timer = nullptr;
     RuntimeProfile::Counter* _conjuncts_input_counter = nullptr;
     RuntimeProfile::Counter* _conjuncts_output_counter = nullptr;
+    // cpu cycles, cache misses, page faults etc. of push_chunk/pull_chunk/set_finishing,
+    // nullptr unless config::enable_operator_perf_event_counters is set.
+    std::unique_ptr<PerfEventProfileCounters> _perf_event_counters;
 
     // only used in spillable operator to record peak revocable memory bytes,
     // each operator should initialize it before use
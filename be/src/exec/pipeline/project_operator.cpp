@@ -108,6 +108,14 @@ Status ProjectOperatorFactory::prepare(RuntimeState* state) {
     RETURN_IF_ERROR(Expr::open(_common_sub_expr_ctxs, state));
     RETURN_IF_ERROR(Expr::open(_expr_ctxs, state));
 
+    // reuse the subexpressions evaluated by the conjuncts of the previous operators.
+    for (auto* ctx : _common_sub_expr_ctxs) {
+        ctx->rewrite_common_exprs(state->obj_pool());
+    }
+    for (auto* ctx : _expr_ctxs) {
+        ctx->rewrite_common_exprs(state->obj_pool());
+    }
+
     return Status::OK();
 }
 
@@ -168,6 +168,11 @@ Status OlapScanContext::parse_conjuncts(RuntimeState* state, const std::vector<E
 
     WARN_IF_ERROR(_jit_rewriter.rewrite(_not_push_down_conjuncts, &_obj_pool, state->is_jit_enabled()), "");
 
+    // the subexpressions also occurring in the projections are evaluated once.
+    for (auto* ctx : _not_push_down_conjuncts) {
+        ctx->rewrite_common_exprs(&_obj_pool);
+    }
+
     return Status::OK();
 }
 
@@ -15,7 +15,9 @@
 #include "exec/pipeline/select_operator.h"
 
 #include "column/chunk.h"
+#include "exprs/compound_predicate.h"
 #include "exprs/expr.h"
+#include "exprs/expr_context.h"
 #include "runtime/runtime_state.h"
 
 namespace starrocks::pipeline {
@@ -99,11 +101,64 @@ Status SelectOperator::reset_state(starrocks::RuntimeState* state, const std::ve
 
 Status SelectOperatorFactory::prepare(RuntimeState* state) {
     RETURN_IF_ERROR(OperatorFactory::prepare(state));
+    _fuse_compilable_conjuncts(state);
     RETURN_IF_ERROR(Expr::prepare(_conjunct_ctxs, state));
     RETURN_IF_ERROR(Expr::open(_conjunct_ctxs, state));
+    for (auto* ctx : _conjunct_ctxs) {
+        ctx->rewrite_common_exprs(state->obj_pool());
+    }
     return Status::OK();
 }
 
+// Compilable conjuncts are chained by AND into one expression, so they are compiled into a single jit function
+// which reads the input columns once and produces the filter directly, instead of materializing one boolean
+// column per conjunct. The fused conjunct is evaluated first, the uncompilable ones only see its survivors.
+void SelectOperatorFactory::_fuse_compilable_conjuncts(RuntimeState* state) {
+    if (!state->is_jit_enabled()) {
+        return;
+    }
+    std::vector<ExprContext*> uncompilable_ctxs;
+    Expr* fused = nullptr;
+    size_t num_fused = 0;
+    auto* pool = state->obj_pool();
+    for (auto* ctx : _conjunct_ctxs) {
+        Expr* root = ctx->root();
+        if (!root->is_compilable(state) || root->is_constant()) {
+            uncompilable_ctxs.emplace_back(ctx);
+            continue;
+        }
+        if (fused == nullptr) {
+            fused = root;
+        } else {
+            TExprNode node;
+            node.__set_node_type(TExprNodeType::COMPOUND_PRED);
+            node.__set_opcode(TExprOpcode::COMPOUND_AND);
+            node.__set_type(TypeDescriptor(TYPE_BOOLEAN).to_thrift());
+            node.__set_is_nullable(fused->is_nullable() || root->is_nullable());
+            node.__set_num_children(2);
+            auto* and_expr = pool->add(VectorizedCompoundPredicateFactory::from_thrift(node));
+            and_expr->add_child(fused);
+            and_expr->add_child(root);
+            fused = and_expr;
+        }
+        num_fused++;
+    }
+    if (num_fused < 2 || !fused->should_compile(state)) {
+        return;
+    }
+
+    bool replaced = false;
+    auto st = fused->replace_compilable_exprs(&fused, pool, state, replaced);
+    if (!st.ok() || !replaced) {
+        // The original conjuncts are not changed, evaluate them one by one.
+        return;
+    }
+    _conjunct_ctxs.clear();
+    _conjunct_ctxs.emplace_back(pool->add(new ExprContext(fused)));
+    _conjunct_ctxs.insert(_conjunct_ctxs.end(), uncompilable_ctxs.begin(), uncompilable_ctxs.end());
+    VLOG_QUERY << "JIT: fuse " << num_fused << " conjuncts of select operator " << _plan_node_id;
+}
+
 void SelectOperatorFactory::close(RuntimeState* state) {
     Expr::close(_conjunct_ctxs, state);
     OperatorFactory::close(state);
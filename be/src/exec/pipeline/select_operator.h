@@ -72,6 +72,8 @@ public:
     void close(RuntimeState* state) override;
 
 private:
+    void _fuse_compilable_conjuncts(RuntimeState* state);
+
     std::vector<ExprContext*> _conjunct_ctxs;
 };
 
@@ -0,0 +1,126 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exprs/cached_expr.h"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+
+#include "column/chunk.h"
+#include "exprs/column_ref.h"
+#include "exprs/function_call_expr.h"
+#include "exprs/literal.h"
+#include "runtime/runtime_state.h"
+
+namespace starrocks {
+
+CachedExpr* CachedExpr::create(ObjectPool* pool, Expr* expr, std::string fingerprint, RuntimeState* state) {
+    TExprNode node;
+    // a wrapper like CloneExpr, so it's never rewritten again by Expr::replace_common_exprs().
+    node.node_type = TExprNodeType::CLONE_EXPR;
+    node.opcode = TExprOpcode::INVALID_OPCODE;
+    node.is_nullable = expr->is_nullable();
+    node.type = expr->type().to_thrift();
+    node.output_scale = expr->output_scale();
+    node.is_monotonic = expr->is_monotonic();
+    auto* cached_expr = pool->add(new CachedExpr(node, std::move(fingerprint), state));
+    cached_expr->add_child(expr);
+    expr->get_slot_ids(&cached_expr->_slot_ids);
+    std::sort(cached_expr->_slot_ids.begin(), cached_expr->_slot_ids.end());
+    auto last = std::unique(cached_expr->_slot_ids.begin(), cached_expr->_slot_ids.end());
+    cached_expr->_slot_ids.erase(last, cached_expr->_slot_ids.end());
+    return cached_expr;
+}
+
+CachedExpr::CachedExpr(const TExprNode& node, std::string fingerprint, RuntimeState* state)
+        : Expr(node), _fingerprint(std::move(fingerprint)), _state(state) {}
+
+CachedExpr::CachedExpr(const CachedExpr& other)
+        : Expr(other), _fingerprint(other._fingerprint), _state(other._state), _slot_ids(other._slot_ids) {}
+
+StatusOr<ColumnPtr> CachedExpr::evaluate_checked(ExprContext* context, Chunk* ptr) {
+    if (ptr == nullptr || ptr->is_empty() || !_is_common()) {
+        return _children[0]->evaluate_checked(context, ptr);
+    }
+    // the cached column is shared like the result of a slot ref, the chunk copies it on write.
+    if (auto column = ptr->get_cached_expr_column(_fingerprint, _slot_ids); column != nullptr) {
+        return column;
+    }
+    ASSIGN_OR_RETURN(auto column, _children[0]->evaluate_checked(context, ptr));
+    ptr->cache_expr_column(_fingerprint, _slot_ids, column);
+    return column;
+}
+
+StatusOr<ColumnPtr> CachedExpr::evaluate_with_filter(ExprContext* context, Chunk* ptr, uint8_t* filter) {
+    if (ptr != nullptr && _is_common()) {
+        return evaluate_checked(context, ptr);
+    }
+    return Expr::evaluate_with_filter(context, ptr, filter);
+}
+
+bool CachedExpr::_is_common() {
+    int64_t version = _state->common_exprs_version();
+    if (_checked_version.load(std::memory_order_acquire) != version) {
+        _common.store(_state->common_expr_count(_fingerprint) > 1, std::memory_order_relaxed);
+        _checked_version.store(version, std::memory_order_release);
+    }
+    return _common.load(std::memory_order_relaxed);
+}
+
+std::string CachedExpr::fingerprint(Expr* expr) {
+    std::string children;
+    for (auto* child : expr->children()) {
+        auto child_fingerprint = fingerprint(child);
+        if (child_fingerprint.empty()) {
+            return "";
+        }
+        children += child_fingerprint;
+        children += ',';
+    }
+
+    auto type = expr->type().debug_string();
+    switch (expr->node_type()) {
+    case TExprNodeType::SLOT_REF: {
+        auto* column_ref = dynamic_cast<ColumnRef*>(expr);
+        return column_ref == nullptr ? "" : fmt::format("slot:{}:{}", column_ref->slot_id(), type);
+    }
+    case TExprNodeType::CAST_EXPR:
+        return fmt::format("cast:{}({})", type, children);
+    case TExprNodeType::FUNCTION_CALL: {
+        auto* call = dynamic_cast<VectorizedFunctionCallExpr*>(expr);
+        if (call == nullptr || call->is_returning_random_value() ||
+            expr->fn().binary_type != TFunctionBinaryType::BUILTIN) {
+            return "";
+        }
+        return fmt::format("fn:{}:{}:{}({})", expr->fn().fid, expr->fn().name.function_name, type, children);
+    }
+    default:
+        break;
+    }
+
+    auto* literal = dynamic_cast<VectorizedLiteral*>(expr);
+    if (literal == nullptr) {
+        return "";
+    }
+    auto value = literal->evaluate_checked(nullptr, nullptr);
+    if (!value.ok()) {
+        return "";
+    }
+    auto item = value.value()->debug_item(0);
+    // the size separates the value from the following fingerprints.
+    return fmt::format("lit:{}:{}:{}", type, item.size(), item);
+}
+
+} // namespace starrocks
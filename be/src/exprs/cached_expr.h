@@ -0,0 +1,68 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+#include "common/object_pool.h"
+#include "exprs/expr.h"
+
+namespace starrocks {
+
+// Evaluate a subexpression once per chunk when it occurs more than once in the expression trees of a fragment
+// instance, e.g. json_query(payload, '$.a') of both a conjunct and a projection. The result column is cached in
+// the chunk by the fingerprint of the subexpression, so the following occurrences reuse it, including the ones
+// of the following operators as long as the chunk is passed along. A cached column is only reused while the input
+// columns of the subexpression stay the same. It's shared by the occurrences like the column of a slot ref, so the
+// exprs modifying their inputs in place are still guarded by CloneExpr.
+class CachedExpr final : public Expr {
+public:
+    static CachedExpr* create(ObjectPool* pool, Expr* expr, std::string fingerprint, RuntimeState* state);
+
+    CachedExpr(const TExprNode& node, std::string fingerprint, RuntimeState* state);
+    CachedExpr(const CachedExpr& other);
+
+    ~CachedExpr() override = default;
+
+    Expr* clone(ObjectPool* pool) const override { return pool->add(new CachedExpr(*this)); }
+
+    StatusOr<ColumnPtr> evaluate_checked(ExprContext* context, Chunk* ptr) override;
+
+    // A common subexpression is evaluated on all rows, so the result is shared by the other occurrences.
+    StatusOr<ColumnPtr> evaluate_with_filter(ExprContext* context, Chunk* ptr, uint8_t* filter) override;
+
+    // Fingerprint identifying the result of `expr` on a chunk, empty if it's not known, i.e. the tree contains
+    // exprs other than slot refs, literals, casts and deterministic builtin functions.
+    static std::string fingerprint(Expr* expr);
+
+    const std::string& fingerprint() const { return _fingerprint; }
+
+private:
+    // Whether the subexpression occurs more than once in the fragment instance, checked again whenever
+    // an expression tree is rewritten, since the scan conjuncts may be rewritten after the evaluation started.
+    bool _is_common();
+
+    const std::string _fingerprint;
+    RuntimeState* _state;
+    // slots read by the subexpression, the cached column is dropped once any of them is changed.
+    std::vector<SlotId> _slot_ids;
+    // RuntimeState::common_exprs_version() when `_common` is decided, -1 if not decided yet.
+    std::atomic<int64_t> _checked_version{-1};
+    std::atomic<bool> _common{false};
+};
+
+} // namespace starrocks
@@ -14,9 +14,16 @@
 
 #include "exprs/compound_predicate.h"
 
+#include <map>
+
+#include "column/column_viewer.h"
 #include "common/object_pool.h"
 #include "exprs/binary_function.h"
+#include "exprs/column_ref.h"
+#include "exprs/function_call_expr.h"
 #include "exprs/jit/ir_helper.h"
+#include "exprs/like_predicate.h"
+#include "exprs/literal.h"
 #include "exprs/predicate.h"
 #include "exprs/unary_function.h"
 #include "runtime/runtime_state.h"
@@ -123,7 +130,28 @@ DEFINE_BINARY_FUNCTION_WITH_IMPL(OrImpl, l_value, r_value) {
 class VectorizedOrCompoundPredicate final : public Predicate {
 public:
     DEFINE_COMPOUND_CONSTRUCT(VectorizedOrCompoundPredicate);
+
+    // the batched patterns refer to the children of the copied expr, prepare the copy to batch again.
+    VectorizedOrCompoundPredicate(const VectorizedOrCompoundPredicate& other) : Predicate(other) {}
+
+    Status prepare(RuntimeState* state, ExprContext* context) override {
+        // only the outermost OR of a chain batches the patterns of all its leaves.
+        for (auto* child : _children) {
+            if (auto* or_child = dynamic_cast<VectorizedOrCompoundPredicate*>(child); or_child != nullptr) {
+                or_child->_is_nested = true;
+            }
+        }
+        RETURN_IF_ERROR(Expr::prepare(state, context));
+        if (!_is_nested) {
+            _batch_pattern_predicates();
+        }
+        return Status::OK();
+    }
+
     StatusOr<ColumnPtr> evaluate_checked(ExprContext* context, Chunk* ptr) override {
+        if (!_pattern_groups.empty()) {
+            return _evaluate_batched(context, ptr);
+        }
         ASSIGN_OR_RETURN(auto l, _children[0]->evaluate_checked(context, ptr));
 
         int l_trues = ColumnHelper::count_true_with_notnull(l);
@@ -181,6 +209,123 @@ public:
             << ", rhs_is_constant=" << _children[1]->is_constant() << ", expr (" << expr_debug_string << ") )";
         return out.str();
     }
+
+private:
+    // LIKE and REGEXP predicates with constant patterns on the same column, matched by one hyperscan database.
+    struct PatternGroup {
+        Expr* value;
+        std::shared_ptr<LikeMultiPatternMatcher> matcher;
+    };
+
+    static void _collect_leaves(Expr* expr, std::vector<Expr*>* leaves) {
+        if (dynamic_cast<VectorizedOrCompoundPredicate*>(expr) != nullptr) {
+            for (auto* child : expr->children()) {
+                _collect_leaves(child, leaves);
+            }
+        } else {
+            leaves->emplace_back(expr);
+        }
+    }
+
+    // The regex of a LIKE or REGEXP predicate on a column with a constant pattern, or empty if it isn't or the
+    // pattern is matched by a string search, which is faster than hyperscan.
+    static std::string _pattern_regex(Expr* leaf) {
+        auto* call = dynamic_cast<VectorizedFunctionCallExpr*>(leaf);
+        if (call == nullptr || call->get_function_desc() == nullptr || leaf->children().size() != 2) {
+            return "";
+        }
+        const auto& name = call->get_function_desc()->name;
+        auto* pattern_expr = dynamic_cast<VectorizedLiteral*>(leaf->get_child(1));
+        if ((name != "LIKE" && name != "REGEXP") || !leaf->get_child(0)->is_slotref() || pattern_expr == nullptr) {
+            return "";
+        }
+        auto pattern_column = pattern_expr->evaluate_checked(nullptr, nullptr);
+        if (!pattern_column.ok()) {
+            return "";
+        }
+        ColumnViewer<TYPE_VARCHAR> viewer(pattern_column.value());
+        if (viewer.size() == 0 || viewer.is_null(0)) {
+            return "";
+        }
+        std::string pattern = viewer.value(0).to_string();
+        if (name == "LIKE") {
+            return LikePredicate::is_string_match_like_pattern(pattern) ? "" : LikePredicate::like_to_regex(pattern);
+        }
+        return LikePredicate::is_string_match_regex_pattern(pattern) ? "" : pattern;
+    }
+
+    void _batch_pattern_predicates() {
+        std::vector<Expr*> leaves;
+        _collect_leaves(this, &leaves);
+
+        std::map<SlotId, std::vector<std::pair<Expr*, std::string>>> slot_patterns;
+        std::vector<Expr*> other_leaves;
+        for (auto* leaf : leaves) {
+            auto regex = _pattern_regex(leaf);
+            if (regex.empty()) {
+                other_leaves.emplace_back(leaf);
+            } else {
+                auto slot_id = down_cast<ColumnRef*>(leaf->get_child(0))->slot_id();
+                slot_patterns[slot_id].emplace_back(leaf, std::move(regex));
+            }
+        }
+
+        std::vector<PatternGroup> groups;
+        for (auto& [slot_id, patterns] : slot_patterns) {
+            std::vector<std::string> regexes;
+            for (const auto& pattern : patterns) {
+                regexes.emplace_back(pattern.second);
+            }
+            // a single pattern is matched by its own predicate.
+            StatusOr<std::unique_ptr<LikeMultiPatternMatcher>> matcher = Status::NotSupported("single pattern");
+            if (patterns.size() > 1) {
+                matcher = LikeMultiPatternMatcher::create(regexes);
+            }
+            if (matcher.ok()) {
+                groups.push_back({patterns[0].first->get_child(0), std::move(matcher.value())});
+            } else {
+                for (const auto& pattern : patterns) {
+                    other_leaves.emplace_back(pattern.first);
+                }
+            }
+        }
+        if (!groups.empty()) {
+            _pattern_groups = std::move(groups);
+            _other_leaves = std::move(other_leaves);
+        }
+    }
+
+    StatusOr<ColumnPtr> _evaluate_batched(ExprContext* context, Chunk* ptr) {
+        ColumnPtr result = nullptr;
+        auto merge = [&](const ColumnPtr& column) {
+            result = result == nullptr ? column
+                                       : VectorizedLogicPredicateBinaryFunction<OrNullImpl, OrImpl>::template evaluate<
+                                                 TYPE_BOOLEAN>(result, column);
+        };
+        // all true and not null
+        auto all_true = [&]() { return ColumnHelper::count_true_with_notnull(result) == result->size(); };
+
+        for (const auto& group : _pattern_groups) {
+            ASSIGN_OR_RETURN(auto value, group.value->evaluate_checked(context, ptr));
+            ASSIGN_OR_RETURN(auto matched, group.matcher->match_any(value));
+            merge(matched);
+            if (all_true()) {
+                return result;
+            }
+        }
+        for (auto* leaf : _other_leaves) {
+            ASSIGN_OR_RETURN(auto column, leaf->evaluate_checked(context, ptr));
+            merge(column);
+            if (all_true()) {
+                return result;
+            }
+        }
+        return result;
+    }
+
+    bool _is_nested = false;
+    std::vector<PatternGroup> _pattern_groups;
+    std::vector<Expr*> _other_leaves;
 };
 
 DEFINE_UNARY_FN_WITH_IMPL(CompoundPredNot, l) {
@@ -23,7 +23,9 @@
 #include "column/type_traits.h"
 #include "column/vectorized_fwd.h"
 #include "common/object_pool.h"
+#include "exprs/jit/ir_helper.h"
 #include "gutil/casts.h"
+#include "runtime/runtime_state.h"
 #include "runtime/types.h"
 #include "simd/selector.h"
 #include "types/logical_type.h"
@@ -419,6 +421,57 @@ public:
         }
     }
 
+    bool is_compilable(RuntimeState* state) const override {
+        if (!state->can_jit_expr(CompilableExprType::CASE) || !IRHelper::support_jit(Type)) {
+            return false;
+        }
+        return std::all_of(_children.begin(), _children.end(),
+                           [](const Expr* child) { return child->type().type == Type; });
+    }
+
+    JitScore compute_jit_score(RuntimeState* state) const override {
+        JitScore jit_score = {0, 0};
+        if (!is_compilable(state)) {
+            return jit_score;
+        }
+        for (auto child : _children) {
+            auto tmp = child->compute_jit_score(state);
+            jit_score.score += tmp.score;
+            jit_score.num += tmp.num;
+        }
+        jit_score.num++;
+        jit_score.score += 0; // no benefit
+        return jit_score;
+    }
+
+    // Built as a select chain from the last child to the first one, so the row loop stays branch free.
+    StatusOr<LLVMDatum> generate_ir_impl(ExprContext* context, JITContext* jit_ctx) override {
+        if constexpr (!lt_is_number<Type>) {
+            return Status::NotSupported("JIT of coalesce only support number types");
+        } else {
+            std::vector<LLVMDatum> datums(_children.size());
+            for (size_t i = 0; i < _children.size(); i++) {
+                ASSIGN_OR_RETURN(datums[i], _children[i]->generate_ir(context, jit_ctx))
+            }
+            auto& b = jit_ctx->builder;
+            LLVMDatum result = datums.back();
+            for (int i = static_cast<int>(datums.size()) - 2; i >= 0; i--) {
+                auto* is_null = b.CreateICmpNE(datums[i].null_flag, b.getInt8(0));
+                result.value = b.CreateSelect(is_null, result.value, datums[i].value);
+                result.null_flag = b.CreateAnd(datums[i].null_flag, result.null_flag);
+            }
+            return result;
+        }
+    }
+
+    std::string jit_func_name_impl(RuntimeState* state) const override {
+        std::string name = "{coalesce(";
+        for (size_t i = 0; i < _children.size(); i++) {
+            name += (i > 0 ? ", " : "") + _children[i]->jit_func_name(state);
+        }
+        return name + ")}" + (is_constant() ? "c:" : "") + (is_nullable() ? "n:" : "") + type().debug_string();
+    }
+
 private:
     StatusOr<ColumnPtr> _evaluate_general(const Columns& columns) {
         std::vector<ColumnViewer<Type>> viewers;
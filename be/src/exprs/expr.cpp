@@ -41,7 +41,9 @@
 #include <utility>
 #include <vector>
 
+#include "column/chunk.h"
 #include "column/fixed_length_column.h"
+#include "common/config.h"
 #include "common/object_pool.h"
 #include "common/status.h"
 #include "common/statusor.h"
@@ -51,6 +53,7 @@
 #include "exprs/array_expr.h"
 #include "exprs/array_map_expr.h"
 #include "exprs/binary_predicate.h"
+#include "exprs/cached_expr.h"
 #include "exprs/case_expr.h"
 #include "exprs/cast_expr.h"
 #include "exprs/clone_expr.h"
@@ -78,6 +81,7 @@
 #include "exprs/subfield_expr.h"
 #include "gutil/strings/substitute.h"
 #include "runtime/runtime_state.h"
+#include "simd/simd.h"
 #include "types/logical_type.h"
 #include "util/failpoint/fail_point.h"
 
@@ -701,8 +705,96 @@ StatusOr<ColumnPtr> Expr::evaluate_const(ExprContext* context) {
     return _constant_column;
 }
 
+// Whether the expr reads the chunk only by the columns of its slot ids.
+static bool only_reads_slot_columns(const Expr* expr) {
+    auto node_type = expr->node_type();
+    if (node_type == TExprNodeType::DICT_EXPR || node_type == TExprNodeType::DICT_QUERY_EXPR ||
+        node_type == TExprNodeType::DICTIONARY_GET_EXPR || node_type == TExprNodeType::PLACEHOLDER_EXPR ||
+        node_type == TExprNodeType::MATCH_EXPR || node_type == TExprNodeType::LAMBDA_FUNCTION_EXPR) {
+        return false;
+    }
+    for (auto* child : expr->children()) {
+        if (!only_reads_slot_columns(child)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Whether evaluating the expr costs much more than copying its columns, i.e. it calls functions, matches patterns
+// or handles json. The other exprs, e.g. comparisons of slots and literals, are cheaper to evaluate on all rows.
+static bool is_costly_to_evaluate(const Expr* expr) {
+    auto node_type = expr->node_type();
+    if (node_type == TExprNodeType::FUNCTION_CALL || node_type == TExprNodeType::LIKE_PRED ||
+        node_type == TExprNodeType::JIT_EXPR || expr->type().type == TYPE_JSON) {
+        return true;
+    }
+    for (auto* child : expr->children()) {
+        if (is_costly_to_evaluate(child)) {
+            return true;
+        }
+    }
+    return false;
+}
+
 StatusOr<ColumnPtr> Expr::evaluate_with_filter(ExprContext* context, Chunk* ptr, uint8_t* filter) {
-    return evaluate_checked(context, ptr);
+    if (filter == nullptr || ptr == nullptr || ptr->is_empty() || is_slotref() || is_constant()) {
+        return evaluate_checked(context, ptr);
+    }
+    size_t num_rows = ptr->num_rows();
+    size_t num_selected = num_rows - SIMD::count_zero(filter, num_rows);
+    if (num_selected == 0 || num_selected > num_rows * config::selective_eval_max_selected_ratio ||
+        !only_reads_slot_columns(this) || !is_costly_to_evaluate(this)) {
+        return evaluate_checked(context, ptr);
+    }
+    std::vector<SlotId> slot_ids;
+    get_slot_ids(&slot_ids);
+    // the exprs without columns, e.g. rand(), rely on the number of rows of the chunk.
+    if (slot_ids.empty()) {
+        return evaluate_checked(context, ptr);
+    }
+    for (auto slot_id : slot_ids) {
+        if (!ptr->is_slot_exist(slot_id)) {
+            return evaluate_checked(context, ptr);
+        }
+    }
+
+    Buffer<uint32_t> selection;
+    selection.reserve(num_selected);
+    // position of each row in the selected rows, the rows filtered out take the position of a nearby one.
+    Buffer<uint32_t> positions(num_rows);
+    for (uint32_t i = 0; i < num_rows; i++) {
+        if (filter[i]) {
+            selection.push_back(i);
+        }
+        positions[i] = selection.empty() ? 0 : selection.size() - 1;
+    }
+
+    Chunk selected_chunk;
+    for (auto slot_id : slot_ids) {
+        if (selected_chunk.is_slot_exist(slot_id)) {
+            continue;
+        }
+        const auto& column = ptr->get_column_by_slot_id(slot_id);
+        ColumnPtr selected_column;
+        if (column->is_constant()) {
+            selected_column = column->clone_shared();
+            selected_column->resize(num_selected);
+        } else {
+            selected_column = column->clone_empty();
+            selected_column->append_selective(*column, selection.data(), 0, num_selected);
+        }
+        selected_chunk.append_column(std::move(selected_column), slot_id);
+    }
+
+    ASSIGN_OR_RETURN(auto selected_result, evaluate_checked(context, &selected_chunk));
+    if (selected_result->is_constant()) {
+        return selected_result;
+    }
+    DCHECK_EQ(num_selected, selected_result->size());
+    ColumnPtr result = selected_result->clone_empty();
+    result->append_selective(*selected_result, positions.data(), 0, num_rows);
+    return result;
 }
 
 ColumnRef* Expr::get_column_ref() {
@@ -807,6 +899,27 @@ Status Expr::replace_compilable_exprs(Expr** expr, ObjectPool* pool, RuntimeStat
     return Status::OK();
 }
 
+void Expr::replace_common_exprs(Expr** expr, ObjectPool* pool, RuntimeState* state) {
+    // the children of lambda functions are evaluated on the chunks of lambda arguments, and the dict exprs are
+    // rewritten by dict optimization.
+    if (_node_type == TExprNodeType::DICT_EXPR || _node_type == TExprNodeType::DICT_QUERY_EXPR ||
+        _node_type == TExprNodeType::DICTIONARY_GET_EXPR || _node_type == TExprNodeType::PLACEHOLDER_EXPR ||
+        _node_type == TExprNodeType::MATCH_EXPR || _node_type == TExprNodeType::LAMBDA_FUNCTION_EXPR ||
+        _node_type == TExprNodeType::CLONE_EXPR) {
+        return;
+    }
+    if ((_node_type == TExprNodeType::FUNCTION_CALL || _node_type == TExprNodeType::CAST_EXPR) && !is_constant()) {
+        auto fingerprint = CachedExpr::fingerprint(this);
+        if (!fingerprint.empty()) {
+            state->add_common_expr(fingerprint);
+            *expr = CachedExpr::create(pool, this, std::move(fingerprint), state);
+        }
+    }
+    for (auto& child : _children) {
+        child->replace_common_exprs(&child, pool, state);
+    }
+}
+
 JitScore Expr::compute_jit_score(RuntimeState* state) const {
     JitScore jit_score = {0, 0};
     if (!is_compilable(state)) {
@@ -208,6 +208,10 @@ public:
 
     // TODO: check error in expression and return error [[nodiscard]] Status, instead of return null column
     [[nodiscard]] virtual StatusOr<ColumnPtr> evaluate_checked(ExprContext* context, Chunk* ptr) = 0;
+    // Only the rows selected by `filter` need to be evaluated, the values of the other rows are undefined.
+    // By default, the referenced columns of the selected rows are copied and evaluated when the selected rows are
+    // sparse enough and the expr is costly, e.g. calls functions, which saves evaluating the rows filtered by the
+    // previous conjuncts without compacting the whole chunk.
     [[nodiscard]] virtual StatusOr<ColumnPtr> evaluate_with_filter(ExprContext* context, Chunk* ptr, uint8_t* filter);
 
     // TODO:(murphy) remove this unchecked evaluate
@@ -239,6 +243,10 @@ public:
     // TODO(Yueyang): The algorithm is imperfect and may further be optimized in the future.
     Status replace_compilable_exprs(Expr** expr, ObjectPool* pool, RuntimeState* state, bool& replaced);
 
+    // Wrap the casts and function calls of this expression tree by CachedExprs and count their occurrences in the
+    // fragment instance, the ones occurring more than once are evaluated once per chunk.
+    void replace_common_exprs(Expr** expr, ObjectPool* pool, RuntimeState* state);
+
     // Establishes whether the current expression should undergo compilation.
     // if adaptive, the valuable expressions should take the majority, i.e., `jit_score_ratio` of all expressions,
     // but case_when expr is especial, refer to its `compute_jit_score()`.
@@ -41,6 +41,7 @@
 #include <stdexcept>
 
 #include "column/chunk.h"
+#include "common/config.h"
 #include "common/statusor.h"
 #include "exprs/column_ref.h"
 #include "exprs/expr.h"
@@ -202,6 +203,14 @@ bool ExprContext::error_if_overflow() const {
     return _runtime_state != nullptr && _runtime_state->error_if_overflow();
 }
 
+void ExprContext::rewrite_common_exprs(ObjectPool* pool) {
+    DCHECK(_prepared);
+    if (_runtime_state == nullptr || !config::enable_common_expr_reuse || _common_exprs_rewritten.exchange(true)) {
+        return;
+    }
+    _root->replace_common_exprs(&_root, pool, _runtime_state);
+}
+
 Status ExprContext::rewrite_jit_expr(ObjectPool* pool) {
     if (_runtime_state == nullptr || !_runtime_state->is_jit_enabled()) {
         return Status::OK();
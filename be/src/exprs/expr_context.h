@@ -124,6 +124,10 @@ public:
 
     Status rewrite_jit_expr(ObjectPool* pool);
 
+    // Reuse the results of the subexpressions occurring more than once in the fragment instance, see CachedExpr.
+    // Must be called after prepare(), the contexts shared by operators are rewritten once.
+    void rewrite_common_exprs(ObjectPool* pool);
+
 private:
     friend class Expr;
     friend class OlapScanNode;
@@ -146,6 +150,7 @@ private:
     /// Variables keeping track of current state.
     bool _prepared{false};
     bool _opened{false};
+    std::atomic<bool> _common_exprs_rewritten{false};
     // In operator, the ExprContext::close method will be called concurrently
     std::atomic<bool> _closed{false};
 };
@@ -21,9 +21,11 @@
 #include "column/hash_set.h"
 #include "common/object_pool.h"
 #include "exprs/function_helper.h"
+#include "exprs/jit/ir_helper.h"
 #include "exprs/literal.h"
 #include "exprs/predicate.h"
 #include "gutil/strings/substitute.h"
+#include "runtime/runtime_state.h"
 #include "simd/simd.h"
 
 namespace starrocks {
@@ -345,6 +347,78 @@ public:
         }
     }
 
+    // Short IN lists of non-null literals are unrolled into an OR chain of equal comparisons, so the predicate
+    // can be fused with the other conjuncts into one jit function. Long lists are still probed in the hash set.
+    static constexpr size_t JIT_MAX_IN_LIST_SIZE = 16;
+
+    bool is_compilable(RuntimeState* state) const override {
+        if (!state->can_jit_expr(CompilableExprType::CMP) || !IRHelper::support_jit(Type) ||
+            _is_join_runtime_filter || _eq_null || _children.size() < 2 ||
+            _children.size() > JIT_MAX_IN_LIST_SIZE + 1 || _children[0]->type().type != Type) {
+            return false;
+        }
+        for (size_t i = 1; i < _children.size(); i++) {
+            if (_children[i]->node_type() != TExprNodeType::INT_LITERAL &&
+                _children[i]->node_type() != TExprNodeType::FLOAT_LITERAL &&
+                _children[i]->node_type() != TExprNodeType::LARGE_INT_LITERAL &&
+                _children[i]->node_type() != TExprNodeType::BOOL_LITERAL) {
+                return false;
+            }
+            if (_children[i]->type().type != Type) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    JitScore compute_jit_score(RuntimeState* state) const override {
+        JitScore jit_score = {0, 0};
+        if (!is_compilable(state)) {
+            return jit_score;
+        }
+        auto tmp = _children[0]->compute_jit_score(state);
+        jit_score.score += tmp.score;
+        jit_score.num += tmp.num + 1;
+        return jit_score;
+    }
+
+    StatusOr<LLVMDatum> generate_ir_impl(ExprContext* context, JITContext* jit_ctx) override {
+        if constexpr (!lt_is_number<Type>) {
+            return Status::NotSupported("JIT of in predicate only support number types");
+        } else {
+            ASSIGN_OR_RETURN(auto lhs, _children[0]->generate_ir(context, jit_ctx))
+            auto& b = jit_ctx->builder;
+            llvm::Value* match = b.getFalse();
+            // A null in the list makes the result null rather than false if nothing is matched.
+            llvm::Value* null_in_list = b.getFalse();
+            for (size_t i = 1; i < _children.size(); i++) {
+                ASSIGN_OR_RETURN(auto datum, _children[i]->generate_ir(context, jit_ctx))
+                llvm::Value* is_null = b.CreateICmpNE(datum.null_flag, b.getInt8(0));
+                llvm::Value* eq = nullptr;
+                if constexpr (lt_is_float<Type>) {
+                    eq = b.CreateFCmpOEQ(lhs.value, datum.value);
+                } else {
+                    eq = b.CreateICmpEQ(lhs.value, datum.value);
+                }
+                match = b.CreateOr(match, b.CreateAnd(eq, b.CreateNot(is_null)));
+                null_in_list = b.CreateOr(null_in_list, is_null);
+            }
+            LLVMDatum result(b);
+            result.value = b.CreateIntCast(_is_not_in ? b.CreateNot(match) : match, b.getInt8Ty(), false);
+            llvm::Value* unknown = b.CreateIntCast(b.CreateAnd(null_in_list, b.CreateNot(match)), b.getInt8Ty(), false);
+            result.null_flag = b.CreateOr(lhs.null_flag, unknown);
+            return result;
+        }
+    }
+
+    std::string jit_func_name_impl(RuntimeState* state) const override {
+        std::string name = "{" + _children[0]->jit_func_name(state) + (_is_not_in ? " not in (" : " in (");
+        for (size_t i = 1; i < _children.size(); i++) {
+            name += (i > 1 ? ", " : "") + _children[i]->jit_func_name(state);
+        }
+        return name + ")}" + (is_constant() ? "c:" : "") + (is_nullable() ? "n:" : "") + type().debug_string();
+    }
+
     const in_const_pred_detail::LHashSetType<Type>& hash_set() const { return _hash_set; }
 
     bool is_not_in() const { return _is_not_in; }
@@ -17,7 +17,9 @@
 #include "column/column_builder.h"
 #include "column/column_helper.h"
 #include "column/column_viewer.h"
+#include "exprs/jit/ir_helper.h"
 #include "exprs/unary_function.h"
+#include "runtime/runtime_state.h"
 #include "types/logical_type.h"
 
 namespace starrocks {
@@ -62,6 +64,36 @@ public:
         auto col = ColumnHelper::as_raw_column<NullableColumn>(column)->null_column();
         return VectorizedStrictUnaryFunction<isNullImpl>::evaluate<TYPE_NULL, TYPE_BOOLEAN>(col);
     }
+
+    // The child is evaluated by the jit function as an input column or an inlined sub expression, only its
+    // null flag is read, so IS [NOT] NULL can be fused with the comparisons of the same conjunct.
+    bool is_compilable(RuntimeState* state) const override {
+        return state->can_jit_expr(CompilableExprType::CMP) && IRHelper::support_jit(_children[0]->type().type);
+    }
+
+    JitScore compute_jit_score(RuntimeState* state) const override {
+        JitScore jit_score = {0, 0};
+        if (!is_compilable(state)) {
+            return jit_score;
+        }
+        auto tmp = _children[0]->compute_jit_score(state);
+        jit_score.score += tmp.score;
+        jit_score.num += tmp.num + 1;
+        return jit_score;
+    }
+
+    StatusOr<LLVMDatum> generate_ir_impl(ExprContext* context, JITContext* jit_ctx) override {
+        ASSIGN_OR_RETURN(auto datum, _children[0]->generate_ir(context, jit_ctx))
+        auto& b = jit_ctx->builder;
+        LLVMDatum result(b);
+        result.value = datum.null_flag;
+        return result;
+    }
+
+    std::string jit_func_name_impl(RuntimeState* state) const override {
+        return "{is_null(" + _children[0]->jit_func_name(state) + ")}" + (is_constant() ? "c:" : "") +
+               type().debug_string();
+    }
 };
 
 DEFINE_UNARY_FN_WITH_IMPL(isNotNullImpl, v) {
@@ -97,6 +129,34 @@ public:
         auto col = ColumnHelper::as_raw_column<NullableColumn>(column)->null_column();
         return VectorizedStrictUnaryFunction<isNotNullImpl>::evaluate<TYPE_NULL, TYPE_BOOLEAN>(col);
     }
+
+    bool is_compilable(RuntimeState* state) const override {
+        return state->can_jit_expr(CompilableExprType::CMP) && IRHelper::support_jit(_children[0]->type().type);
+    }
+
+    JitScore compute_jit_score(RuntimeState* state) const override {
+        JitScore jit_score = {0, 0};
+        if (!is_compilable(state)) {
+            return jit_score;
+        }
+        auto tmp = _children[0]->compute_jit_score(state);
+        jit_score.score += tmp.score;
+        jit_score.num += tmp.num + 1;
+        return jit_score;
+    }
+
+    StatusOr<LLVMDatum> generate_ir_impl(ExprContext* context, JITContext* jit_ctx) override {
+        ASSIGN_OR_RETURN(auto datum, _children[0]->generate_ir(context, jit_ctx))
+        auto& b = jit_ctx->builder;
+        LLVMDatum result(b);
+        result.value = b.CreateXor(datum.null_flag, b.getInt8(1));
+        return result;
+    }
+
+    std::string jit_func_name_impl(RuntimeState* state) const override {
+        return "{is_not_null(" + _children[0]->jit_func_name(state) + ")}" + (is_constant() ? "c:" : "") +
+               type().debug_string();
+    }
 };
 
 Expr* VectorizedIsNullPredicateFactory::from_thrift(const TExprNode& node) {
@@ -51,6 +51,24 @@ struct JITColumn {
  */
 using JITScalarFunction = void (*)(int64_t, JITColumn*);
 
+/**
+ * JITKeySerializeFunction is a function pointer to a JIT compiled function serializing multi-column keys.
+ * @param int64_t: the number of rows.
+ * @param JITColumn*: the pointer to the key columns.
+ * @param uint8_t*: the destination buffer.
+ * @param int64_t: the distance in bytes between two rows in the destination, 0 means rows are packed one by one.
+ * @param uint32_t*: the serialized size of each row.
+ */
+using JITKeySerializeFunction = void (*)(int64_t, JITColumn*, uint8_t*, int64_t, uint32_t*);
+
+/**
+ * JITKeyColumnDesc describes a fixed length key column to be serialized by JITKeySerializeFunction.
+ */
+struct JITKeyColumnDesc {
+    uint32_t type_size = 0; ///< The size of a value in bytes.
+    bool nullable = false;  ///< Whether a null flag is serialized before the value.
+};
+
 /**
  * @brief The LLVMDatum struct is utilized to store the column's values and nullity flags within LLVM IR.
  */
@@ -81,6 +99,7 @@ enum CompilableExprType : int32_t {
     LOGICAL = 32,
     DIV = 64,
     MOD = 128,
+    HASH_KEY = 256, // serialize multi-column join and group by keys
 };
 
 class IRHelper {
@@ -0,0 +1,227 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exprs/jit/jit_disk_cache.h"
+
+#include <glog/logging.h>
+#include <llvm/ADT/StringMap.h>
+#include <llvm/Config/llvm-config.h>
+#include <llvm/Support/Host.h>
+
+#include <algorithm>
+#include <cstring>
+
+#include "fs/fs.h"
+#include "gutil/strings/util.h"
+#include "util/sha.h"
+
+namespace starrocks {
+
+static std::string host_signature() {
+    std::string signature = std::string("llvm-") + LLVM_VERSION_STRING + ";" + llvm::sys::getHostCPUName().str();
+    llvm::StringMap<bool> host_features;
+    std::vector<std::string> features;
+    if (llvm::sys::getHostCPUFeatures(host_features)) {
+        for (const auto& feature : host_features) {
+            if (feature.getValue()) {
+                features.emplace_back(feature.getKey().str());
+            }
+        }
+    }
+    // the iteration order of StringMap is unspecified.
+    std::sort(features.begin(), features.end());
+    for (const auto& feature : features) {
+        signature += ";+" + feature;
+    }
+    return signature;
+}
+
+JitDiskCache::JitDiskCache(std::string dir, int64_t capacity)
+        : _dir(std::move(dir)), _signature(host_signature()), _capacity(capacity) {}
+
+Status JitDiskCache::init() {
+    auto* fs = FileSystem::Default();
+    RETURN_IF_ERROR(fs->create_dir_recursive(_dir));
+
+    std::vector<std::string> names;
+    RETURN_IF_ERROR(fs->iterate_dir(_dir, [&](std::string_view name) {
+        names.emplace_back(name);
+        return true;
+    }));
+
+    struct ObjectFile {
+        std::string key;
+        int64_t size;
+        uint64_t mtime;
+    };
+    std::vector<ObjectFile> objects;
+    for (const auto& name : names) {
+        auto path = _dir + "/" + name;
+        if (name.find(std::string(OBJECT_SUFFIX) + TMP_SUFFIX) != std::string::npos) {
+            // temporary files left by crash while writing objects.
+            (void)fs->delete_file(path);
+            continue;
+        }
+        if (!HasSuffixString(name, OBJECT_SUFFIX)) {
+            continue;
+        }
+        auto size = fs->get_file_size(path);
+        auto mtime = fs->get_file_modified_time(path);
+        if (!size.ok() || !mtime.ok()) {
+            continue;
+        }
+        objects.push_back({name.substr(0, name.size() - strlen(OBJECT_SUFFIX)), (int64_t)size.value(), mtime.value()});
+    }
+    // the most recently written objects are the most recently used.
+    std::sort(objects.begin(), objects.end(),
+              [](const ObjectFile& lhs, const ObjectFile& rhs) { return lhs.mtime < rhs.mtime; });
+
+    std::vector<std::string> evicted;
+    {
+        std::lock_guard<std::mutex> l(_mutex);
+        for (const auto& object : objects) {
+            _add_entry_locked(object.key, object.size);
+        }
+        evicted = _evict_locked();
+    }
+    _delete_files(evicted);
+    LOG(INFO) << "JIT disk cache " << _dir << " loaded " << num_objects() << " objects, usage = " << usage()
+              << ", capacity = " << _capacity;
+    return Status::OK();
+}
+
+std::string JitDiskCache::make_key(const std::string& ir) const {
+    SHA256Digest digest;
+    digest.update(_signature.data(), _signature.size());
+    // separate the signature and the ir.
+    digest.update("\n", 1);
+    digest.update(ir.data(), ir.size());
+    digest.digest();
+    return digest.hex();
+}
+
+StatusOr<std::string> JitDiskCache::lookup(const std::string& key) {
+    {
+        std::lock_guard<std::mutex> l(_mutex);
+        auto it = _entries.find(key);
+        if (it == _entries.end()) {
+            _miss_count++;
+            return Status::NotFound(key);
+        }
+        _lru.splice(_lru.begin(), _lru, it->second.lru_it);
+    }
+
+    auto read_object = [&]() -> StatusOr<std::string> {
+        ASSIGN_OR_RETURN(auto file, FileSystem::Default()->new_random_access_file(_object_path(key)));
+        return file->read_all();
+    };
+    auto object = read_object();
+    if (!object.ok() || object.value().empty()) {
+        LOG(WARNING) << "JIT disk cache read object " << key << " failed: " << object.status();
+        {
+            std::lock_guard<std::mutex> l(_mutex);
+            _remove_entry_locked(key);
+        }
+        _delete_files({key});
+        _miss_count++;
+        return Status::NotFound(key);
+    }
+    _hit_count++;
+    return object;
+}
+
+Status JitDiskCache::insert(const std::string& key, const Slice& object) {
+    auto* fs = FileSystem::Default();
+    // write to a temporary file and rename it, so a crash never leaves a partial object.
+    auto tmp_path = _object_path(key) + TMP_SUFFIX + std::to_string(_tmp_file_id++);
+    auto write_object = [&]() -> Status {
+        WritableFileOptions opts{.sync_on_close = false, .mode = FileSystem::CREATE_OR_OPEN_WITH_TRUNCATE};
+        ASSIGN_OR_RETURN(auto file, fs->new_writable_file(opts, tmp_path));
+        RETURN_IF_ERROR(file->append(object));
+        RETURN_IF_ERROR(file->close());
+        return fs->rename_file(tmp_path, _object_path(key));
+    };
+    auto st = write_object();
+    if (!st.ok()) {
+        (void)fs->delete_file(tmp_path);
+        return st;
+    }
+
+    std::vector<std::string> evicted;
+    {
+        std::lock_guard<std::mutex> l(_mutex);
+        _remove_entry_locked(key);
+        _add_entry_locked(key, object.size);
+        evicted = _evict_locked();
+    }
+    _delete_files(evicted);
+    return Status::OK();
+}
+
+void JitDiskCache::set_capacity(int64_t capacity) {
+    std::vector<std::string> evicted;
+    {
+        std::lock_guard<std::mutex> l(_mutex);
+        _capacity = capacity;
+        evicted = _evict_locked();
+    }
+    _delete_files(evicted);
+}
+
+size_t JitDiskCache::num_objects() const {
+    std::lock_guard<std::mutex> l(_mutex);
+    return _entries.size();
+}
+
+int64_t JitDiskCache::usage() const {
+    std::lock_guard<std::mutex> l(_mutex);
+    return _usage;
+}
+
+void JitDiskCache::_add_entry_locked(const std::string& key, int64_t size) {
+    _lru.push_front(key);
+    _entries[key] = {size, _lru.begin()};
+    _usage += size;
+}
+
+void JitDiskCache::_remove_entry_locked(const std::string& key) {
+    auto it = _entries.find(key);
+    if (it == _entries.end()) {
+        return;
+    }
+    _usage -= it->second.size;
+    _lru.erase(it->second.lru_it);
+    _entries.erase(it);
+}
+
+std::vector<std::string> JitDiskCache::_evict_locked() {
+    std::vector<std::string> evicted;
+    while (_usage > _capacity && !_lru.empty()) {
+        auto key = _lru.back();
+        _remove_entry_locked(key);
+        evicted.emplace_back(std::move(key));
+    }
+    return evicted;
+}
+
+void JitDiskCache::_delete_files(const std::vector<std::string>& keys) {
+    for (const auto& key : keys) {
+        auto st = FileSystem::Default()->delete_file(_object_path(key));
+        if (!st.ok() && !st.is_not_found()) {
+            LOG(WARNING) << "JIT disk cache delete object " << key << " failed: " << st;
+        }
+    }
+}
+
+} // namespace starrocks
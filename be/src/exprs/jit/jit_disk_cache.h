@@ -0,0 +1,90 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "common/status.h"
+#include "common/statusor.h"
+#include "util/slice.h"
+
+namespace starrocks {
+
+// Persist compiled JIT objects in a local directory, so BE restarts and evictions of the in-memory LRU cache
+// don't need to compile them again.
+// An object file is named by the digest of the unoptimized IR, the LLVM version and the host cpu with its
+// features, the least recently used files are removed once the total size exceeds the capacity.
+class JitDiskCache {
+public:
+    static constexpr const char* OBJECT_SUFFIX = ".o";
+    static constexpr const char* TMP_SUFFIX = ".tmp";
+
+    JitDiskCache(std::string dir, int64_t capacity);
+
+    // Create the directory if not exists and load the index of the objects persisted before.
+    Status init();
+
+    // Key of the object compiled from `ir` on this host.
+    std::string make_key(const std::string& ir) const;
+
+    // Return NotFound if there is no object of `key`.
+    StatusOr<std::string> lookup(const std::string& key);
+
+    Status insert(const std::string& key, const Slice& object);
+
+    void set_capacity(int64_t capacity);
+
+    size_t num_objects() const;
+    int64_t usage() const;
+    int64_t hit_count() const { return _hit_count; }
+    int64_t miss_count() const { return _miss_count; }
+
+private:
+    struct Entry {
+        int64_t size;
+        std::list<std::string>::iterator lru_it;
+    };
+
+    std::string _object_path(const std::string& key) const { return _dir + "/" + key + OBJECT_SUFFIX; }
+
+    void _add_entry_locked(const std::string& key, int64_t size);
+    void _remove_entry_locked(const std::string& key);
+    // Remove entries until the usage is not greater than capacity, files of them are returned to delete.
+    std::vector<std::string> _evict_locked();
+    void _delete_files(const std::vector<std::string>& keys);
+
+    const std::string _dir;
+    // LLVM version and host cpu, objects of other versions or cpus are never hit.
+    std::string _signature;
+
+    mutable std::mutex _mutex;
+    int64_t _capacity;
+    int64_t _usage = 0;
+    // the front is the most recently used.
+    std::list<std::string> _lru;
+    std::unordered_map<std::string, Entry> _entries;
+
+    std::atomic<int64_t> _hit_count{0};
+    std::atomic<int64_t> _miss_count{0};
+    std::atomic<int64_t> _tmp_file_id{0};
+};
+
+} // namespace starrocks
@@ -83,6 +83,12 @@ void JitObjectCache::notifyObjectCompiled(const llvm::Module* M, llvm::MemoryBuf
     std::unique_ptr<llvm::MemoryBuffer> obj_buffer =
             llvm::MemoryBuffer::getMemBufferCopy(Obj.getBuffer(), Obj.getBufferIdentifier());
     _obj_code = std::move(obj_buffer);
+    if (_disk_cache != nullptr && !_loaded_from_disk) {
+        auto st = _disk_cache->insert(_disk_key, Slice(_obj_code->getBufferStart(), _obj_code->getBufferSize()));
+        if (!st.ok()) {
+            LOG(WARNING) << "JIT persist func failed, func = " << _cache_key << ", error = " << st;
+        }
+    }
 }
 
 Status JitObjectCache::register_func(JITScalarFunction func) {
@@ -116,10 +122,28 @@ Status JitObjectCache::register_func(JITScalarFunction func) {
 }
 
 std::unique_ptr<llvm::MemoryBuffer> JitObjectCache::getObject(const llvm::Module* M) {
-    return nullptr;
+    if (!_loaded_from_disk) {
+        return nullptr;
+    }
+    return llvm::MemoryBuffer::getMemBufferCopy(_obj_code->getBuffer(), _obj_code->getBufferIdentifier());
+}
+
+bool JitObjectCache::load_from_disk(JitDiskCache* disk_cache, std::string disk_key) {
+    _disk_cache = disk_cache;
+    _disk_key = std::move(disk_key);
+    auto object = _disk_cache->lookup(_disk_key);
+    if (!object.ok()) {
+        return false;
+    }
+    _obj_code = llvm::MemoryBuffer::getMemBufferCopy(object.value(), _cache_key);
+    _loaded_from_disk = true;
+    return true;
 }
 
 JITEngine::~JITEngine() {
+    if (_compile_pool != nullptr) {
+        _compile_pool->shutdown();
+    }
     delete _func_cache;
 }
 
@@ -157,6 +181,23 @@ Status JITEngine::init() {
     llvm::InitializeNativeTargetAsmParser();
     llvm::InitializeNativeTargetDisassembler();
     llvm::sys::DynamicLibrary::LoadLibraryPermanently(nullptr);
+    if (!config::jit_disk_cache_path.empty()) {
+        auto disk_cache = std::make_unique<JitDiskCache>(config::jit_disk_cache_path, config::jit_disk_cache_capacity);
+        auto st = disk_cache->init();
+        if (st.ok()) {
+            _disk_cache = std::move(disk_cache);
+        } else {
+            LOG(WARNING) << "JIT disk cache init failed, compiled funcs are only cached in memory: " << st;
+        }
+    }
+    auto st = ThreadPoolBuilder("jit_compile")
+                      .set_min_threads(0)
+                      .set_max_threads(std::max(1, config::jit_compile_thread_num))
+                      .set_max_queue_size(1000)
+                      .build(&_compile_pool);
+    if (!st.ok()) {
+        LOG(WARNING) << "JIT compile pool init failed, join and group by keys are not serialized by jit: " << st;
+    }
     _initialized = true;
     _support_jit = true;
     return Status::OK();
@@ -189,6 +230,30 @@ Status JITEngine::compile_scalar_function(ExprContext* context, JitObjectCache*
     return Status::OK();
 }
 
+Status JITEngine::compile_key_serialize_function(JitObjectCache* func_cache,
+                                                 const std::vector<JITKeyColumnDesc>& key_columns) {
+    auto* instance = JITEngine::get_instance();
+    if (UNLIKELY(!instance->initialized())) {
+        return Status::JitCompileError("JIT engine is not initialized");
+    }
+
+    auto cached = instance->lookup_function(func_cache);
+    if (cached) {
+        return Status::OK();
+    }
+
+    ASSIGN_OR_RETURN(auto engine, Engine::create(*func_cache))
+    RETURN_IF_ERROR(generate_key_serialize_function_ir(*engine->module(), key_columns, func_cache));
+    RETURN_IF_ERROR(engine->optimize_and_finalize_module());
+    cached = instance->lookup_function(func_cache);
+    if (cached) {
+        return Status::OK();
+    }
+    ASSIGN_OR_RETURN(auto function, engine->get_compiled_func(func_cache->get_func_name()));
+    RETURN_IF_ERROR(func_cache->register_func(function));
+    return Status::OK();
+}
+
 std::string JITEngine::dump_module_ir(const llvm::Module& module) {
     std::string ir;
     llvm::raw_string_ostream stream(ir);
@@ -271,6 +336,95 @@ Status JITEngine::generate_scalar_function_ir(ExprContext* context, llvm::Module
     return Status::OK();
 }
 
+// The generated function writes the same bytes as Column::serialize of each key column, a nullable key is written
+// as a null flag followed by the value if it is not null.
+Status JITEngine::generate_key_serialize_function_ir(llvm::Module& module,
+                                                     const std::vector<JITKeyColumnDesc>& key_columns,
+                                                     JitObjectCache* obj) {
+    llvm::IRBuilder<> b(module.getContext());
+
+    /// Create function type.
+    auto* size_type = b.getInt64Ty();
+    // Same with JITColumn.
+    auto* data_type = llvm::StructType::get(b.getInt8PtrTy(), b.getInt8PtrTy());
+    // Same with JITKeySerializeFunction.
+    auto* func_type = llvm::FunctionType::get(b.getVoidTy(),
+                                              {size_type, data_type->getPointerTo(), b.getInt8PtrTy(), size_type,
+                                               b.getInt32Ty()->getPointerTo()},
+                                              false);
+
+    // Pseudo code: void "name"(int64_t rows_count, JITColumn* columns, uint8_t* dst, int64_t stride, uint32_t* sizes);
+    auto* func = llvm::Function::Create(func_type, llvm::Function::ExternalLinkage, obj->get_func_name(), module);
+    auto* func_args = func->args().begin();
+    llvm::Value* rows_count_arg = func_args++;
+    llvm::Value* columns_arg = func_args++;
+    llvm::Value* dst_arg = func_args++;
+    llvm::Value* stride_arg = func_args++;
+    llvm::Value* sizes_arg = func_args++;
+
+    auto* entry = llvm::BasicBlock::Create(b.getContext(), "entry", func);
+    b.SetInsertPoint(entry);
+
+    std::vector<LLVMColumn> columns(key_columns.size());
+    for (size_t i = 0; i < key_columns.size(); ++i) {
+        auto* jit_column = b.CreateLoad(data_type, b.CreateConstInBoundsGEP1_64(data_type, columns_arg, i));
+        columns[i].values = b.CreateExtractValue(jit_column, {0});
+        columns[i].null_flags = b.CreateExtractValue(jit_column, {1});
+        // Keys are copied as raw bytes, so only the width of the value matters.
+        columns[i].value_type = b.getIntNTy(key_columns[i].type_size * 8);
+    }
+    auto* packed = b.CreateICmpEQ(stride_arg, llvm::ConstantInt::get(size_type, 0));
+
+    /// Initialize loop.
+    auto* end = llvm::BasicBlock::Create(b.getContext(), "end", func);
+    auto* loop = llvm::BasicBlock::Create(b.getContext(), "loop", func);
+    b.CreateCondBr(b.CreateICmpEQ(rows_count_arg, llvm::ConstantInt::get(size_type, 0)), end, loop);
+    b.SetInsertPoint(loop);
+
+    // Pseudo code: for (int64_t counter = 0, cursor = 0; counter < rows_count; counter++, cursor += size)
+    auto* counter_phi = b.CreatePHI(size_type, 2);
+    counter_phi->addIncoming(llvm::ConstantInt::get(size_type, 0), entry);
+    auto* cursor_phi = b.CreatePHI(size_type, 2);
+    cursor_phi->addIncoming(llvm::ConstantInt::get(size_type, 0), entry);
+
+    auto* row = b.CreateInBoundsGEP(b.getInt8Ty(), dst_arg,
+                                    b.CreateSelect(packed, cursor_phi, b.CreateMul(counter_phi, stride_arg)));
+    llvm::Value* offset = llvm::ConstantInt::get(size_type, 0);
+    for (size_t i = 0; i < key_columns.size(); ++i) {
+        auto* value_type = columns[i].value_type;
+        auto* value = b.CreateAlignedLoad(value_type, b.CreateInBoundsGEP(value_type, columns[i].values, counter_phi),
+                                          llvm::MaybeAlign(1));
+        auto* value_size = llvm::ConstantInt::get(size_type, key_columns[i].type_size);
+        if (key_columns[i].nullable) {
+            auto* null_flag =
+                    b.CreateLoad(b.getInt8Ty(), b.CreateInBoundsGEP(b.getInt8Ty(), columns[i].null_flags, counter_phi));
+            b.CreateStore(null_flag, b.CreateInBoundsGEP(b.getInt8Ty(), row, offset));
+            offset = b.CreateAdd(offset, llvm::ConstantInt::get(size_type, 1));
+            // The value of a null row is written too but not counted, the next key or row overwrites it.
+            b.CreateAlignedStore(value, b.CreateInBoundsGEP(b.getInt8Ty(), row, offset), llvm::MaybeAlign(1));
+            auto* is_null = b.CreateICmpNE(null_flag, b.getInt8(0));
+            offset = b.CreateAdd(offset, b.CreateSelect(is_null, llvm::ConstantInt::get(size_type, 0), value_size));
+        } else {
+            b.CreateAlignedStore(value, b.CreateInBoundsGEP(b.getInt8Ty(), row, offset), llvm::MaybeAlign(1));
+            offset = b.CreateAdd(offset, value_size);
+        }
+    }
+    // Pseudo code: sizes[counter] = size;
+    b.CreateStore(b.CreateTrunc(offset, b.getInt32Ty()), b.CreateInBoundsGEP(b.getInt32Ty(), sizes_arg, counter_phi));
+
+    /// End of loop.
+    auto* current_block = b.GetInsertBlock();
+    auto* incremeted_counter = b.CreateAdd(counter_phi, llvm::ConstantInt::get(size_type, 1));
+    counter_phi->addIncoming(incremeted_counter, current_block);
+    cursor_phi->addIncoming(b.CreateAdd(cursor_phi, offset), current_block);
+    b.CreateCondBr(b.CreateICmpEQ(incremeted_counter, rows_count_arg), end, loop);
+
+    b.SetInsertPoint(end);
+    b.CreateRetVoid();
+
+    return Status::OK();
+}
+
 bool JITEngine::lookup_function(JitObjectCache* const obj) {
     auto* handle = _func_cache->lookup(obj->get_func_name());
     if (handle == nullptr) {
@@ -354,11 +508,13 @@ StatusOr<std::unique_ptr<llvm::orc::LLJIT>> build_JIT(llvm::orc::JITTargetMachin
     return std::move(jit);
 }
 
-JITEngine::Engine::Engine(std::unique_ptr<llvm::orc::LLJIT> lljit, std::unique_ptr<llvm::TargetMachine> target_machine)
+JITEngine::Engine::Engine(std::unique_ptr<llvm::orc::LLJIT> lljit, std::unique_ptr<llvm::TargetMachine> target_machine,
+                          JitObjectCache* object_cache)
         : _context(std::make_unique<llvm::LLVMContext>()),
           _lljit(std::move(lljit)),
           _ir_builder(std::make_unique<llvm::IRBuilder<>>(*_context)),
-          _target_machine(std::move(target_machine)) {
+          _target_machine(std::move(target_machine)),
+          _object_cache(object_cache) {
     auto module_id = "sr_module_" + std::to_string(reinterpret_cast<uintptr_t>(this));
     _module = std::make_unique<llvm::Module>(module_id, *_context);
 }
@@ -370,7 +526,7 @@ StatusOr<std::unique_ptr<JITEngine::Engine>> JITEngine::Engine::create(
     ASSIGN_OR_RETURN(auto jit, build_JIT(jtmb, object_cache));
     auto maybe_tm = jtmb.createTargetMachine();
     ASSIGN_OR_RETURN(auto target_machine, as_JIT_result(maybe_tm, "Could not create target machine: "));
-    std::unique_ptr<Engine> engine{new Engine(std::move(jit), std::move(target_machine))};
+    std::unique_ptr<Engine> engine{new Engine(std::move(jit), std::move(target_machine), &object_cache.get())};
     return engine;
 }
 
@@ -379,6 +535,21 @@ llvm::Module* JITEngine::Engine::module() const {
     return _module.get();
 }
 
+// The IR of globals and functions, unlike dump_module_ir(), it doesn't contain the module id which differs in each
+// compilation.
+static std::string dump_functions_ir(const llvm::Module& module) {
+    std::string ir;
+    llvm::raw_string_ostream stream(ir);
+    for (const auto& global : module.globals()) {
+        global.print(stream);
+        stream << "\n";
+    }
+    for (const auto& function : module) {
+        function.print(stream);
+    }
+    return stream.str();
+}
+
 static void optimize_module(llvm::Module& module, llvm::TargetIRAnalysis target_analysis) {
     // Setup an optimiser pipeline
     llvm::PassBuilder pass_builder;
@@ -423,8 +594,16 @@ Status JITEngine::Engine::optimize_and_finalize_module() {
     if (llvm::verifyModule(*_module, &errs)) {
         return Status::JitCompileError(fmt::format("Failed to generate scalar function IR, errors: {}", errs.str()));
     }
-    auto target_analysis = _target_machine->getTargetIRAnalysis();
-    optimize_module(*_module, std::move(target_analysis));
+    // the object of the same IR is loaded from the disk cache, it is compiled from the optimized module before.
+    bool loaded_from_disk = false;
+    if (auto* disk_cache = JITEngine::get_instance()->get_disk_cache(); disk_cache != nullptr) {
+        auto disk_key = disk_cache->make_key(dump_functions_ir(*_module));
+        loaded_from_disk = _object_cache->load_from_disk(disk_cache, std::move(disk_key));
+    }
+    if (!loaded_from_disk) {
+        auto target_analysis = _target_machine->getTargetIRAnalysis();
+        optimize_module(*_module, std::move(target_analysis));
+    }
 
     if (llvm::verifyModule(*_module, &errs)) {
         return Status::JitCompileError(fmt::format("Failed to optimize scalar function IR, errors: {}", errs.str()));
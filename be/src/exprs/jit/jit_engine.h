@@ -30,7 +30,9 @@
 #include "common/status.h"
 #include "exprs/expr_context.h"
 #include "exprs/jit/ir_helper.h"
+#include "exprs/jit/jit_disk_cache.h"
 #include "util/lru_cache.h"
+#include "util/threadpool.h"
 
 namespace starrocks {
 
@@ -45,6 +47,10 @@ public:
 
     std::unique_ptr<llvm::MemoryBuffer> getObject(const llvm::Module* M) override;
 
+    // Load the object persisted in the JIT disk cache by `disk_key`, return true if found, then getObject()
+    // returns it and the module needs no optimization. Otherwise the compiled object is persisted by the key.
+    bool load_from_disk(JitDiskCache* disk_cache, std::string disk_key);
+
     Status register_func(JITScalarFunction func);
 
     const std::string& get_func_name() const { return _cache_key; };
@@ -62,6 +68,9 @@ private:
     JITScalarFunction _func = nullptr;
     Cache* _lru_cache = nullptr;
     std::shared_ptr<llvm::MemoryBuffer> _obj_code = nullptr;
+    JitDiskCache* _disk_cache = nullptr;
+    std::string _disk_key;
+    bool _loaded_from_disk = false;
 };
 
 // JITEngine is a wrapper of LLVM JIT engine, based on ORCv2.
@@ -90,10 +99,19 @@ public:
     static Status compile_scalar_function(ExprContext* context, JitObjectCache* obj, Expr* expr,
                                           const std::vector<Expr*>& uncompilable_exprs);
 
+    // Generate the function serializing keys of the given schema, and register it into LRU cache.
+    static Status compile_key_serialize_function(JitObjectCache* obj, const std::vector<JITKeyColumnDesc>& key_columns);
+
     bool lookup_function(JitObjectCache* const obj);
 
     Cache* get_func_cache() const { return _func_cache; }
 
+    // nullptr if jit_disk_cache_path is not set.
+    JitDiskCache* get_disk_cache() const { return _disk_cache.get(); }
+
+    // Compiles functions off the query threads, e.g. the key serializers of hash joins and aggregations.
+    ThreadPool* compile_pool() const { return _compile_pool.get(); }
+
     static Status generate_scalar_function_ir(ExprContext* context, llvm::Module& module, Expr* expr,
                                               const std::vector<Expr*>& uncompilable_exprs, JitObjectCache* obj);
 
@@ -102,6 +120,10 @@ public:
         return _func_cache->get_memory_usage();
     }
 
+    static Status generate_key_serialize_function_ir(llvm::Module& module,
+                                                     const std::vector<JITKeyColumnDesc>& key_columns,
+                                                     JitObjectCache* obj);
+
     static std::string dump_module_ir(const llvm::Module& module);
 
 private:
@@ -123,7 +145,8 @@ private:
         StatusOr<JITScalarFunction> get_compiled_func(const std::string& function);
 
     private:
-        Engine(std::unique_ptr<llvm::orc::LLJIT> lljit, std::unique_ptr<llvm::TargetMachine> target_machine);
+        Engine(std::unique_ptr<llvm::orc::LLJIT> lljit, std::unique_ptr<llvm::TargetMachine> target_machine,
+               JitObjectCache* object_cache);
 
         std::unique_ptr<llvm::LLVMContext> _context;
         std::unique_ptr<llvm::orc::LLJIT> _lljit;
@@ -132,11 +155,14 @@ private:
 
         bool _module_finalized = false;
         std::unique_ptr<llvm::TargetMachine> _target_machine;
+        JitObjectCache* _object_cache;
     };
 
     bool _initialized = false;
     bool _support_jit = false;
     Cache* _func_cache;
+    std::unique_ptr<JitDiskCache> _disk_cache;
+    std::unique_ptr<ThreadPool> _compile_pool;
 };
 
 } // namespace starrocks
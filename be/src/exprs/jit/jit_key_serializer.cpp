@@ -0,0 +1,159 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exprs/jit/jit_key_serializer.h"
+
+#include "column/column.h"
+#include "column/column_helper.h"
+#include "column/nullable_column.h"
+#include "exprs/jit/jit_engine.h"
+#include "runtime/runtime_state.h"
+#include "util/threadpool.h"
+
+namespace starrocks {
+
+static bool is_supported_key(const Column* column, bool* nullable) {
+    *nullable = column->is_nullable();
+    if (*nullable) {
+        column = down_cast<const NullableColumn*>(column)->data_column().get();
+    }
+    if (column->is_constant() || !(column->is_numeric() || column->is_decimal() || column->is_date() ||
+                                   column->is_timestamp())) {
+        return false;
+    }
+    auto type_size = column->type_size();
+    return type_size == 1 || type_size == 2 || type_size == 4 || type_size == 8 || type_size == 16;
+}
+
+static std::vector<JITKeyColumnDesc> key_column_descs(const Columns& key_columns) {
+    std::vector<JITKeyColumnDesc> descs;
+    for (const auto& column : key_columns) {
+        JITKeyColumnDesc desc;
+        is_supported_key(column.get(), &desc.nullable);
+        desc.type_size = ColumnHelper::get_data_column(column.get())->type_size();
+        descs.emplace_back(desc);
+    }
+    return descs;
+}
+
+JITKeySerializer::JITKeySerializer(std::string name) : _name(std::move(name)) {}
+
+JITKeySerializer::~JITKeySerializer() = default;
+
+bool JITKeySerializer::is_enabled(RuntimeState* state) {
+    return state != nullptr && state->is_jit_enabled() && !state->is_adaptive_jit() &&
+           state->can_jit_expr(CompilableExprType::HASH_KEY);
+}
+
+std::string JITKeySerializer::schema_name(const Columns& key_columns) {
+    std::string name = "key_serialize{";
+    for (const auto& column : key_columns) {
+        bool nullable = false;
+        if (!is_supported_key(column.get(), &nullable)) {
+            return "";
+        }
+        auto type_size = ColumnHelper::get_data_column(column.get())->type_size();
+        name += (nullable ? "n" : "") + std::to_string(type_size) + ",";
+    }
+    return name + "}";
+}
+
+Status JITKeySerializer::_compile(const std::vector<JITKeyColumnDesc>& key_columns) {
+    auto obj_cache = std::make_unique<JitObjectCache>(_name, JITEngine::get_instance()->get_func_cache());
+    RETURN_IF_ERROR(JITEngine::compile_key_serialize_function(obj_cache.get(), key_columns));
+    _set_func(std::move(obj_cache));
+    if (!is_ready()) {
+        return Status::RuntimeError("JIT func must be not null");
+    }
+    return Status::OK();
+}
+
+bool JITKeySerializer::_lookup() {
+    auto* jit_engine = JITEngine::get_instance();
+    auto obj_cache = std::make_unique<JitObjectCache>(_name, jit_engine->get_func_cache());
+    if (!jit_engine->lookup_function(obj_cache.get())) {
+        return false;
+    }
+    _set_func(std::move(obj_cache));
+    return is_ready();
+}
+
+void JITKeySerializer::_set_func(std::unique_ptr<JitObjectCache> obj_cache) {
+    auto func = reinterpret_cast<JITKeySerializeFunction>(obj_cache->get_func());
+    if (func != nullptr) {
+        _obj_cache = std::move(obj_cache);
+        _func.store(func, std::memory_order_release);
+    }
+}
+
+StatusOr<std::shared_ptr<JITKeySerializer>> JITKeySerializer::create(const Columns& key_columns) {
+    auto name = schema_name(key_columns);
+    if (name.empty()) {
+        return Status::NotSupported("jit key serializer only supports fixed length keys");
+    }
+    if (!JITEngine::get_instance()->support_jit()) {
+        return Status::JitCompileError("JIT is not supported");
+    }
+    std::shared_ptr<JITKeySerializer> serializer(new JITKeySerializer(std::move(name)));
+    RETURN_IF_ERROR(serializer->_compile(key_column_descs(key_columns)));
+    return serializer;
+}
+
+const JITKeySerializer* JITKeySerializer::prepare(const Columns& key_columns,
+                                                 std::shared_ptr<JITKeySerializer>* serializer) {
+    auto name = schema_name(key_columns);
+    if (name.empty()) {
+        return nullptr;
+    }
+    if (*serializer == nullptr || (*serializer)->name() != name) {
+        *serializer = std::shared_ptr<JITKeySerializer>(new JITKeySerializer(std::move(name)));
+        auto* jit_engine = JITEngine::get_instance();
+        auto* compile_pool = jit_engine->compile_pool();
+        if (!jit_engine->support_jit() || compile_pool == nullptr) {
+            return nullptr;
+        }
+        // Compiled before, by this query or another one.
+        if ((*serializer)->_lookup()) {
+            return serializer->get();
+        }
+        // The task holds the serializer, so it outlives the operator if the query finishes first.
+        auto st = compile_pool->submit_func([serializer = *serializer, descs = key_column_descs(key_columns)]() {
+            auto st = serializer->_compile(descs);
+            if (!st.ok()) {
+                LOG(WARNING) << "JIT: compile key serializer " << serializer->name() << " failed: " << st;
+            }
+        });
+        if (!st.ok()) {
+            LOG(WARNING) << "JIT: submit compiling key serializer " << (*serializer)->name() << " failed: " << st;
+        }
+    }
+    return (*serializer)->is_ready() ? serializer->get() : nullptr;
+}
+
+void JITKeySerializer::serialize(const Columns& key_columns, size_t start, size_t count, uint8_t* dst,
+                                 uint32_t stride, uint32_t* sizes) const {
+    std::vector<JITColumn> columns(key_columns.size());
+    for (size_t i = 0; i < key_columns.size(); i++) {
+        const Column* data_column = ColumnHelper::get_data_column(key_columns[i].get());
+        if (key_columns[i]->is_nullable()) {
+            auto* null_column = down_cast<const NullableColumn*>(key_columns[i].get())->null_column().get();
+            columns[i].null_flags = reinterpret_cast<const int8_t*>(null_column->raw_data()) + start;
+        }
+        auto* datums = reinterpret_cast<const int8_t*>(data_column->raw_data());
+        columns[i].datums = datums + start * data_column->type_size();
+    }
+    _func.load(std::memory_order_relaxed)(count, columns.data(), dst, stride, sizes);
+}
+
+} // namespace starrocks
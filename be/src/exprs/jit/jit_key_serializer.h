@@ -0,0 +1,79 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "column/vectorized_fwd.h"
+#include "common/statusor.h"
+#include "exprs/jit/ir_helper.h"
+
+namespace starrocks {
+
+class JitObjectCache;
+class RuntimeState;
+
+// JITKeySerializer serializes multi-column join and group by keys by a function generated for the key schema,
+// which walks all key columns row by row in one pass instead of a virtual Column::serialize call per key and row.
+// The written bytes are the same as Column::serialize, so keys serialized in both ways are comparable.
+// Only fixed length keys are supported.
+class JITKeySerializer {
+public:
+    ~JITKeySerializer();
+
+    // Whether the jit key serializer is enabled by the jit level of the query. Unlike exprs, it's not enabled by
+    // the adaptive jit level, the HASH_KEY bit must be set explicitly.
+    static bool is_enabled(RuntimeState* state);
+
+    // The name of the key schema, key columns of the same types and nullability have the same name.
+    // Return an empty string if any key column is not supported.
+    static std::string schema_name(const Columns& key_columns);
+
+    // Compile or look up the serialize function for the schema of `key_columns` in the calling thread.
+    static StatusOr<std::shared_ptr<JITKeySerializer>> create(const Columns& key_columns);
+
+    // Return the serializer for the schema of `key_columns`, `*serializer` is reused if its schema is the same.
+    // The function of a new schema is compiled by the compile pool of JITEngine rather than the calling thread,
+    // and nullptr is returned until it's ready, so the keys are serialized by columns meanwhile.
+    // Return nullptr if the schema is not supported or fails to compile, a failed schema is not compiled again.
+    static const JITKeySerializer* prepare(const Columns& key_columns, std::shared_ptr<JITKeySerializer>* serializer);
+
+    const std::string& name() const { return _name; }
+
+    bool is_ready() const { return _func.load(std::memory_order_acquire) != nullptr; }
+
+    // Serialize `count` rows of keys from row `start`. If `stride` is 0, rows are packed one by one into `dst`,
+    // otherwise the i-th row is written at `dst + i * stride`. The serialized size of each row is set to `sizes`.
+    void serialize(const Columns& key_columns, size_t start, size_t count, uint8_t* dst, uint32_t stride,
+                   uint32_t* sizes) const;
+
+private:
+    explicit JITKeySerializer(std::string name);
+
+    Status _compile(const std::vector<JITKeyColumnDesc>& key_columns);
+    // Look up the function compiled before in the function cache of JITEngine.
+    bool _lookup();
+    void _set_func(std::unique_ptr<JitObjectCache> obj_cache);
+
+    const std::string _name;
+    std::unique_ptr<JitObjectCache> _obj_cache;
+    // set once the function is compiled, may be by another thread.
+    std::atomic<JITKeySerializeFunction> _func{nullptr};
+};
+
+} // namespace starrocks
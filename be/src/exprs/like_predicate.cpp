@@ -14,6 +14,7 @@
 
 #include "exprs/like_predicate.h"
 
+#include <cctype>
 #include <memory>
 
 #include "exprs/binary_function.h"
@@ -44,10 +45,15 @@ static const re2::RE2 LIKE_STARTS_WITH_RE(R"((((\\%)|(\\_)|([^%_]))+)(?:%+))", r
 static const re2::RE2 LIKE_EQUALS_RE(R"((((\\%)|(\\_)|([^%_]))+))", re2::RE2::Quiet);
 static const char* PROMPT_INFO = " so we switch to use re2.";
 
+// a too short literal filters few rows, it's not worth another pass over the column.
+static constexpr size_t PREFILTER_MIN_LITERAL_SIZE = 2;
+
+static constexpr unsigned int HS_MATCH_FLAGS = HS_FLAG_ALLOWEMPTY | HS_FLAG_DOTALL | HS_FLAG_UTF8 | HS_FLAG_SINGLEMATCH;
+
 bool LikePredicate::hs_compile_and_alloc_scratch(const std::string& pattern, LikePredicateState* state,
                                                  FunctionContext* context, const Slice& slice) {
-    if (hs_compile(pattern.c_str(), HS_FLAG_ALLOWEMPTY | HS_FLAG_DOTALL | HS_FLAG_UTF8 | HS_FLAG_SINGLEMATCH,
-                   HS_MODE_BLOCK, nullptr, &state->database, &state->compile_err) != HS_SUCCESS) {
+    if (hs_compile(pattern.c_str(), HS_MATCH_FLAGS, HS_MODE_BLOCK, nullptr, &state->database, &state->compile_err) !=
+        HS_SUCCESS) {
         std::stringstream error;
         error << "Invalid hyperscan expression: " << std::string(slice.data, slice.size) << ": "
               << state->compile_err->message << PROMPT_INFO;
@@ -139,6 +145,7 @@ Status LikePredicate::like_prepare(FunctionContext* context, FunctionContext::Fu
     } else {
         auto re_pattern = LikePredicate::template convert_like_pattern<true>(context, pattern);
         RETURN_IF_ERROR(compile_with_hyperscan_or_re2<true>(re_pattern, state, context, pattern));
+        state->prefilter_literal = extract_like_literal(pattern, state->escape_char);
     }
 
     return Status::OK();
@@ -199,6 +206,7 @@ Status LikePredicate::regex_prepare(FunctionContext* context, FunctionContext::F
         state->function = &constant_substring_fn;
     } else {
         RETURN_IF_ERROR(compile_with_hyperscan_or_re2<false>(pattern_str, state, context, pattern));
+        state->prefilter_literal = extract_regex_literal(pattern_str);
     }
 
     return Status::OK();
@@ -247,11 +255,18 @@ StatusOr<ColumnPtr> LikePredicate::match_fn_with_long_constant_pattern(FunctionC
     ColumnViewer<TYPE_VARCHAR> value_viewer(value_column);
     ColumnBuilder<TYPE_BOOLEAN> result(num_rows);
 
+    std::vector<uint8_t> candidates_buffer;
+    const uint8_t* candidates = _prefilter(state, value_column, &candidates_buffer);
+
     for (int row = 0; row < num_rows; ++row) {
         if (value_viewer.is_null(row)) {
             result.append_null();
             continue;
         }
+        if (candidates != nullptr && !candidates[row]) {
+            result.append(false);
+            continue;
+        }
 
         bool v = false;
         if constexpr (full_match) {
@@ -349,44 +364,62 @@ StatusOr<ColumnPtr> LikePredicate::constant_substring_fn(FunctionContext* contex
         size_t type_size = res->type_size();
         memset(res->mutable_raw_data(), 1, res->size() * type_size);
     } else {
-        const std::vector<uint32_t>& offsets = haystack->get_offset();
         res->resize(haystack->size());
+        search_substring(*haystack, needle, res->get_data().data());
+    }
 
-        const char* begin = haystack->get_slice(0).data;
-        const char* pos = begin;
-        const char* end = pos + haystack->get_bytes().size();
+    if (columns[0]->has_null()) {
+        return NullableColumn::create(res, res_null);
+    }
+    return res;
+}
 
-        /// Current index in the array of strings.
-        size_t i = 0;
+void LikePredicate::search_substring(const BinaryColumn& haystack, const Slice& needle, uint8_t* matched) {
+    const auto& offsets = haystack.get_offset();
+    size_t num_rows = haystack.size();
+    if (num_rows == 0) {
+        return;
+    }
 
-        auto searcher = VolnitskyUTF8(needle.data, needle.size, end - pos);
-        /// We will search for the next occurrence in all strings at once.
-        while (pos < end && end != (pos = searcher.search(pos, end - pos))) {
-            /// Determine which index it refers to.
-            while (begin + offsets[i + 1] <= pos) {
-                res->get_data()[i] = false;
-                ++i;
-            }
-            /// We check that the entry does not pass through the boundaries of strings.
-            if (pos + needle.size > begin + offsets[i + 1]) {
-                res->get_data()[i] = false;
-            } else {
-                res->get_data()[i] = true;
-            }
-            pos = begin + offsets[i + 1];
+    const char* begin = haystack.get_slice(0).data;
+    const char* pos = begin;
+    const char* end = pos + haystack.get_bytes().size();
+
+    /// Current index in the array of strings.
+    size_t i = 0;
+
+    auto searcher = VolnitskyUTF8(needle.data, needle.size, end - pos);
+    /// We will search for the next occurrence in all strings at once.
+    while (pos < end && end != (pos = searcher.search(pos, end - pos))) {
+        /// Determine which index it refers to.
+        while (begin + offsets[i + 1] <= pos) {
+            matched[i] = false;
             ++i;
         }
-
-        if (i < res->size()) {
-            size_t type_size = res->type_size();
-            memset(res->mutable_raw_data() + i * type_size, 0, (res->size() - i) * type_size);
+        /// We check that the entry does not pass through the boundaries of strings.
+        if (pos + needle.size > begin + offsets[i + 1]) {
+            matched[i] = false;
+        } else {
+            matched[i] = true;
         }
+        pos = begin + offsets[i + 1];
+        ++i;
     }
 
-    if (columns[0]->has_null()) {
-        return NullableColumn::create(res, res_null);
+    if (i < num_rows) {
+        memset(matched + i, 0, num_rows - i);
     }
-    return res;
+}
+
+const uint8_t* LikePredicate::_prefilter(const LikePredicateState* state, const ColumnPtr& value_column,
+                                         std::vector<uint8_t>* candidates) {
+    if (state->prefilter_literal.size() < PREFILTER_MIN_LITERAL_SIZE || value_column->is_constant()) {
+        return nullptr;
+    }
+    const auto* haystack = down_cast<const BinaryColumn*>(ColumnHelper::get_data_column(value_column.get()));
+    candidates->resize(haystack->size());
+    search_substring(*haystack, Slice(state->prefilter_literal), candidates->data());
+    return candidates->data();
 }
 
 // regex_match
@@ -421,11 +454,18 @@ StatusOr<ColumnPtr> LikePredicate::_predicate_const_regex(FunctionContext* conte
         }
     });
 
+    std::vector<uint8_t> candidates_buffer;
+    const uint8_t* candidates = _prefilter(state, value_column, &candidates_buffer);
+
     for (int row = 0; row < value_viewer.size(); ++row) {
         if (value_viewer.is_null(row)) {
             result->append_null();
             continue;
         }
+        if (candidates != nullptr && !candidates[row]) {
+            result->append(false);
+            continue;
+        }
 
         bool v = false;
         auto value_size = value_viewer.value(row).size;
@@ -545,10 +585,13 @@ StatusOr<ColumnPtr> LikePredicate::regex_match_partial(FunctionContext* context,
 
 template <bool fullMatch>
 std::string LikePredicate::convert_like_pattern(FunctionContext* context, const Slice& pattern) {
-    std::string re_pattern;
-    re_pattern.clear();
-
     auto state = reinterpret_cast<LikePredicateState*>(context->get_function_state(FunctionContext::THREAD_LOCAL));
+    return convert_like_pattern<fullMatch>(pattern, state->escape_char);
+}
+
+template <bool fullMatch>
+std::string LikePredicate::convert_like_pattern(const Slice& pattern, char escape_char) {
+    std::string re_pattern;
     bool is_escaped = false;
 
     if constexpr (fullMatch) {
@@ -561,7 +604,7 @@ std::string LikePredicate::convert_like_pattern(FunctionContext* context, const
         } else if (!is_escaped && pattern.data[i] == '_') {
             re_pattern.append(".");
             // check for escape char before checking for regex special chars, they might overlap
-        } else if (!is_escaped && pattern.data[i] == state->escape_char) {
+        } else if (!is_escaped && pattern.data[i] == escape_char) {
             is_escaped = true;
         } else if (pattern.data[i] == '.' || pattern.data[i] == '[' || pattern.data[i] == ']' ||
                    pattern.data[i] == '{' || pattern.data[i] == '}' || pattern.data[i] == '(' ||
@@ -580,7 +623,8 @@ std::string LikePredicate::convert_like_pattern(FunctionContext* context, const
     }
 
     if constexpr (fullMatch) {
-        re_pattern.append("$");
+        // use \z instead of $ which also matches before a trailing newline.
+        re_pattern.append("\\z");
     }
 
     return re_pattern;
@@ -602,4 +646,195 @@ void LikePredicate::remove_escape_character(std::string* search_string) {
     }
 }
 
+std::string LikePredicate::like_to_regex(const Slice& pattern, char escape_char) {
+    return convert_like_pattern<true>(pattern, escape_char);
+}
+
+bool LikePredicate::is_string_match_like_pattern(const std::string& pattern) {
+    return RE2::FullMatch(pattern, LIKE_ENDS_WITH_RE) || RE2::FullMatch(pattern, LIKE_STARTS_WITH_RE) ||
+           RE2::FullMatch(pattern, LIKE_EQUALS_RE) || RE2::FullMatch(pattern, LIKE_SUBSTRING_RE);
+}
+
+bool LikePredicate::is_string_match_regex_pattern(const std::string& pattern) {
+    return RE2::FullMatch(pattern, EQUALS_RE) || RE2::FullMatch(pattern, STARTS_WITH_RE) ||
+           RE2::FullMatch(pattern, ENDS_WITH_RE) || RE2::FullMatch(pattern, SUBSTRING_RE);
+}
+
+std::string LikePredicate::extract_like_literal(const Slice& pattern, char escape_char) {
+    std::string longest;
+    std::string current;
+    bool is_escaped = false;
+    for (size_t i = 0; i < pattern.size; ++i) {
+        char c = pattern.data[i];
+        if (!is_escaped && (c == '%' || c == '_')) {
+            if (current.size() > longest.size()) {
+                longest.swap(current);
+            }
+            current.clear();
+        } else if (!is_escaped && c == escape_char) {
+            is_escaped = true;
+        } else {
+            current.push_back(c);
+            is_escaped = false;
+        }
+    }
+    return current.size() > longest.size() ? current : longest;
+}
+
+std::string LikePredicate::extract_regex_literal(const std::string& pattern) {
+    // alternations and groups, including flags like (?i), make literals optional or case insensitive.
+    if (pattern.find_first_of("|()") != std::string::npos) {
+        return "";
+    }
+
+    std::string longest;
+    std::string current;
+    // start of the last atom in `current`, a quantifier makes it optional.
+    size_t last_atom = 0;
+    auto finish_literal = [&]() {
+        if (current.size() > longest.size()) {
+            longest = current;
+        }
+        current.clear();
+        last_atom = 0;
+    };
+    auto append_atom = [&](char c) {
+        // continuation bytes of an utf-8 character belong to the same atom.
+        if ((static_cast<uint8_t>(c) & 0xC0) != 0x80) {
+            last_atom = current.size();
+        }
+        current.push_back(c);
+    };
+
+    for (size_t i = 0; i < pattern.size(); ++i) {
+        char c = pattern[i];
+        switch (c) {
+        case '\\': {
+            if (i + 1 >= pattern.size() || isalnum(static_cast<unsigned char>(pattern[i + 1]))) {
+                // classes and escapes like \d, \b and \x41 are not known literals.
+                return "";
+            }
+            append_atom(pattern[++i]);
+            break;
+        }
+        case '*':
+        case '?':
+        case '{':
+            // the last atom may be absent.
+            current.resize(last_atom);
+            finish_literal();
+            if (c == '{') {
+                i = pattern.find('}', i);
+                if (i == std::string::npos) {
+                    return "";
+                }
+            }
+            break;
+        case '+':
+            finish_literal();
+            break;
+        case '[': {
+            finish_literal();
+            // skip the class, a ']' right after '[' or '[^' is a member of the class.
+            size_t j = i + 1;
+            if (j < pattern.size() && pattern[j] == '^') {
+                ++j;
+            }
+            if (j < pattern.size() && pattern[j] == ']') {
+                ++j;
+            }
+            while (j < pattern.size() && pattern[j] != ']') {
+                j += pattern[j] == '\\' ? 2 : 1;
+            }
+            if (j >= pattern.size()) {
+                return "";
+            }
+            i = j;
+            break;
+        }
+        case '.':
+        case '^':
+        case '$':
+            finish_literal();
+            break;
+        default:
+            append_atom(c);
+        }
+    }
+    finish_literal();
+    return longest;
+}
+
+LikeMultiPatternMatcher::~LikeMultiPatternMatcher() {
+    if (_scratch != nullptr) {
+        hs_free_scratch(_scratch);
+    }
+    if (_database != nullptr) {
+        hs_free_database(_database);
+    }
+}
+
+StatusOr<std::unique_ptr<LikeMultiPatternMatcher>> LikeMultiPatternMatcher::create(
+        const std::vector<std::string>& regexes) {
+    std::vector<const char*> expressions;
+    std::vector<unsigned int> flags(regexes.size(), HS_MATCH_FLAGS);
+    std::vector<unsigned int> ids(regexes.size());
+    for (size_t i = 0; i < regexes.size(); ++i) {
+        expressions.emplace_back(regexes[i].c_str());
+        ids[i] = i;
+    }
+
+    std::unique_ptr<LikeMultiPatternMatcher> matcher(new LikeMultiPatternMatcher());
+    hs_compile_error_t* compile_err = nullptr;
+    if (hs_compile_multi(expressions.data(), flags.data(), ids.data(), regexes.size(), HS_MODE_BLOCK, nullptr,
+                         &matcher->_database, &compile_err) != HS_SUCCESS) {
+        auto st = Status::NotSupported(fmt::format("Invalid hyperscan expressions: {}", compile_err->message));
+        hs_free_compile_error(compile_err);
+        return st;
+    }
+    if (hs_alloc_scratch(matcher->_database, &matcher->_scratch) != HS_SUCCESS) {
+        return Status::InternalError("Unable to allocate hyperscan scratch space");
+    }
+    matcher->_num_patterns = regexes.size();
+    return matcher;
+}
+
+StatusOr<ColumnPtr> LikeMultiPatternMatcher::match_any(const ColumnPtr& value_column) const {
+    hs_scratch_t* scratch = nullptr;
+    hs_error_t status;
+    if ((status = hs_clone_scratch(_scratch, &scratch)) != HS_SUCCESS) {
+        return Status::InternalError(fmt::format("unable to clone scratch space, status: {}", status));
+    }
+    DeferOp op([&] {
+        hs_error_t st;
+        if ((st = hs_free_scratch(scratch)) != HS_SUCCESS) {
+            LOG(ERROR) << "free scratch space failure. status: " << st;
+        }
+    });
+
+    ColumnViewer<TYPE_VARCHAR> value_viewer(value_column);
+    ColumnBuilder<TYPE_BOOLEAN> result(value_viewer.size());
+    static char dummy_for_empty_value = 'A';
+    for (int row = 0; row < value_viewer.size(); ++row) {
+        if (value_viewer.is_null(row)) {
+            result.append_null();
+            continue;
+        }
+        bool v = false;
+        Slice value = value_viewer.value(row);
+        [[maybe_unused]] auto st = hs_scan(
+                // hyperscan crashes on nullptr even the size is 0.
+                _database, value.size ? value.data : &dummy_for_empty_value, value.size, 0, scratch,
+                [](unsigned int id, unsigned long long from, unsigned long long to, unsigned int flags,
+                   void* ctx) -> int {
+                    *((bool*)ctx) = true;
+                    return 1;
+                },
+                &v);
+        DCHECK(st == HS_SUCCESS || st == HS_SCAN_TERMINATED) << " status: " << st;
+        result.append(v);
+    }
+    return result.build(value_column->is_constant());
+}
+
 } // namespace starrocks
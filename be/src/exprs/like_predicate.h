@@ -58,6 +58,25 @@ public:
      */
     DEFINE_VECTORIZED_FN(regex);
 
+    /// The longest literal every value matched by the LIKE pattern contains, empty if there is none.
+    static std::string extract_like_literal(const Slice& pattern, char escape_char = '\\');
+
+    /// The longest literal every value matched by the regular expression contains, empty if there is none or
+    /// the pattern is too complex to know, e.g. it has alternations or groups.
+    static std::string extract_regex_literal(const std::string& pattern);
+
+    /// Search `needle` in all strings of `haystack` at once over its bytes, matched[i] is set to 1 if the i-th
+    /// string contains `needle`, otherwise 0.
+    static void search_substring(const BinaryColumn& haystack, const Slice& needle, uint8_t* matched);
+
+    /// The regular expression that fully matches the same values as the LIKE pattern.
+    static std::string like_to_regex(const Slice& pattern, char escape_char = '\\');
+
+    /// Whether the constant pattern is matched by a string search rather than a regular expression, e.g.
+    /// LIKE 'abc%' and REGEXP '^abc'.
+    static bool is_string_match_like_pattern(const std::string& pattern);
+    static bool is_string_match_regex_pattern(const std::string& pattern);
+
 private:
     /**
      * use for:
@@ -151,6 +170,9 @@ private:
     template <bool fullMatch>
     static std::string convert_like_pattern(FunctionContext* context, const Slice& pattern);
 
+    template <bool fullMatch>
+    static std::string convert_like_pattern(const Slice& pattern, char escape_char);
+
     static void remove_escape_character(std::string* search_string);
 
 private:
@@ -158,11 +180,16 @@ private:
                                                       const ColumnViewer<TYPE_VARCHAR>& value_viewer,
                                                       const ColumnPtr& value_column);
 
+    // Rows of `value_column` containing the prefilter literal of the state, the regex runs only on them.
+    // Return nullptr if all rows should run the regex.
+    struct LikePredicateState;
+    static const uint8_t* _prefilter(const LikePredicateState* state, const ColumnPtr& value_column,
+                                     std::vector<uint8_t>* candidates);
+
     // This is used when pattern is empty string, &_DUMMY_STRING_FOR_EMPTY_PATTERN used as not null pointer
     // to avoid crash with hs_scan.
     static inline char _DUMMY_STRING_FOR_EMPTY_PATTERN = 'A';
 
-    struct LikePredicateState;
     static bool hs_compile_and_alloc_scratch(const std::string&, LikePredicateState*, FunctionContext*,
                                              const Slice& slice);
     template <bool full_match>
@@ -192,6 +219,10 @@ private:
 
         ColumnPtr _search_string_column;
 
+        /// Set if the constant pattern is matched by hyperscan or re2, every matched value contains it, so rows
+        /// without it are filtered by a substring search of the whole column before running the regex.
+        std::string prefilter_literal;
+
         // a pointer to the generated database that responsible for parsed expression.
         hs_database_t* database = nullptr;
         // a type containing error details that is returned by the compile calls on failure.
@@ -219,4 +250,28 @@ private:
         }
     };
 };
+
+// Match several constant LIKE and REGEXP patterns against the same values with one hyperscan multi-pattern
+// database, so ORed predicates on a column scan each value once.
+class LikeMultiPatternMatcher {
+public:
+    ~LikeMultiPatternMatcher();
+
+    // `regexes` are matched partially, LIKE patterns should be converted by LikePredicate::like_to_regex.
+    static StatusOr<std::unique_ptr<LikeMultiPatternMatcher>> create(const std::vector<std::string>& regexes);
+
+    // Whether any pattern matches each value, the result is null if the value is null.
+    StatusOr<ColumnPtr> match_any(const ColumnPtr& value_column) const;
+
+    size_t num_patterns() const { return _num_patterns; }
+
+private:
+    LikeMultiPatternMatcher() = default;
+
+    size_t _num_patterns = 0;
+    hs_database_t* _database = nullptr;
+    // scratch prototype, cloned by each evaluation.
+    hs_scratch_t* _scratch = nullptr;
+};
+
 } // namespace starrocks
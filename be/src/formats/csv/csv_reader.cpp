@@ -270,8 +270,9 @@ Status CSVReader::more_rows() {
                 _buff.skip(1);
                 break;
             }
-            // other character
+            // other character, jump to the next enclose or escape character.
             _buff.skip(1);
+            _buff.skip(_enclose_finder.find_first(_buff.position(), _buff.available()));
             break;
 
         case ENCLOSE_ESCAPE:
@@ -341,7 +342,9 @@ Status CSVReader::more_rows() {
                 break;
             }
 
+            // jump to the next character which may be a delimiter, escape or enclose.
             _buff.skip(1);
+            _buff.skip(_ordinary_finder.find_first(_buff.position(), _buff.available()));
             curState = ORDINARY;
             break;
 
@@ -555,17 +558,30 @@ void CSVReader::split_record(const Record& record, Fields* columns) const {
     const size_t size = record.size;
 
     if (_column_delimiter_length == 1) {
-        for (size_t i = 0; i < size; ++i, ++ptr) {
-            if (*ptr == _parse_options.column_delimiter[0]) {
-                if (_parse_options.trim_space) {
-                    std::pair<const char*, size_t> newPos = trim(value, ptr - value);
-                    columns->emplace_back(newPos.first, newPos.second);
-                } else {
-                    columns->emplace_back(value, ptr - value);
-                }
-                value = ptr + 1;
+        auto append_column = [&](const char* end) {
+            if (_parse_options.trim_space) {
+                std::pair<const char*, size_t> newPos = trim(value, end - value);
+                columns->emplace_back(newPos.first, newPos.second);
+            } else {
+                columns->emplace_back(value, end - value);
+            }
+            value = end + 1;
+        };
+        // locate delimiters of a whole block by bitmap, then slice columns in bulk.
+        size_t i = 0;
+        for (; i + CSVSpecialCharFinder::kBlockSize <= size; i += CSVSpecialCharFinder::kBlockSize) {
+            uint64_t mask = _column_delimiter_finder.bitmap(record.data + i);
+            while (mask != 0) {
+                append_column(record.data + i + __builtin_ctzll(mask));
+                mask &= mask - 1;
             }
         }
+        for (; i < size; ++i) {
+            if (record.data[i] == _parse_options.column_delimiter[0]) {
+                append_column(record.data + i);
+            }
+        }
+        ptr = record.data + size;
     } else {
         const auto* const base = ptr;
 
@@ -14,12 +14,88 @@
 
 #pragma once
 
+#ifdef __AVX2__
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 #include <queue>
 #include <unordered_set>
 
 #include "formats/csv/converter.h"
 
 namespace starrocks {
+
+// Structural index of csv data: a bitmap of the bytes equal to any of (at most) 4 special
+// characters, 64 bytes at a time. Parsers use it to jump from one delimiter, quote or escape
+// to the next one instead of stepping byte by byte.
+class CSVSpecialCharFinder {
+public:
+    static constexpr size_t kBlockSize = 64;
+
+    CSVSpecialCharFinder(char c0, char c1, char c2, char c3) : _chars{c0, c1, c2, c3} {}
+
+    // Returns the bitmap of special characters in [data, data + kBlockSize),
+    // the i-th bit is set if data[i] is special.
+    uint64_t bitmap(const char* data) const {
+#ifdef __AVX2__
+        const __m256i c0 = _mm256_set1_epi8(_chars[0]);
+        const __m256i c1 = _mm256_set1_epi8(_chars[1]);
+        const __m256i c2 = _mm256_set1_epi8(_chars[2]);
+        const __m256i c3 = _mm256_set1_epi8(_chars[3]);
+        uint64_t result = 0;
+        for (size_t i = 0; i < kBlockSize; i += 32) {
+            const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+            const __m256i m = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(v, c0), _mm256_cmpeq_epi8(v, c1)),
+                                              _mm256_or_si256(_mm256_cmpeq_epi8(v, c2), _mm256_cmpeq_epi8(v, c3)));
+            result |= static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(m))) << i;
+        }
+        return result;
+#elif defined(__SSE2__)
+        const __m128i c0 = _mm_set1_epi8(_chars[0]);
+        const __m128i c1 = _mm_set1_epi8(_chars[1]);
+        const __m128i c2 = _mm_set1_epi8(_chars[2]);
+        const __m128i c3 = _mm_set1_epi8(_chars[3]);
+        uint64_t result = 0;
+        for (size_t i = 0; i < kBlockSize; i += 16) {
+            const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+            const __m128i m = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, c0), _mm_cmpeq_epi8(v, c1)),
+                                           _mm_or_si128(_mm_cmpeq_epi8(v, c2), _mm_cmpeq_epi8(v, c3)));
+            result |= static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(m))) << i;
+        }
+        return result;
+#else
+        uint64_t result = 0;
+        for (size_t i = 0; i < kBlockSize; i++) {
+            result |= static_cast<uint64_t>(_is_special(data[i])) << i;
+        }
+        return result;
+#endif
+    }
+
+    // Returns the offset of the first special character in [data, data + size), or size if there is none.
+    size_t find_first(const char* data, size_t size) const {
+        size_t i = 0;
+        for (; i + kBlockSize <= size; i += kBlockSize) {
+            uint64_t mask = bitmap(data + i);
+            if (mask != 0) {
+                return i + __builtin_ctzll(mask);
+            }
+        }
+        for (; i < size; i++) {
+            if (_is_special(data[i])) {
+                return i;
+            }
+        }
+        return size;
+    }
+
+private:
+    bool _is_special(char c) const { return c == _chars[0] || c == _chars[1] || c == _chars[2] || c == _chars[3]; }
+
+    char _chars[4];
+};
 class CSVBuffer {
 public:
     // Does NOT take the ownership of |buff|.
@@ -167,7 +243,15 @@ public:
     using Fields = std::vector<Field>;
 
     CSVReader(const CSVParseOptions& parse_options, const size_t bufferSize = kMinBufferSize)
-            : _parse_options(parse_options), _storage(bufferSize), _buff(_storage.data(), _storage.size()) {
+            : _parse_options(parse_options),
+              _storage(bufferSize),
+              _buff(_storage.data(), _storage.size()),
+              _ordinary_finder(parse_options.row_delimiter[0], parse_options.column_delimiter[0],
+                               parse_options.escape, parse_options.enclose),
+              _enclose_finder(parse_options.enclose, parse_options.escape, parse_options.enclose,
+                              parse_options.escape),
+              _column_delimiter_finder(parse_options.column_delimiter[0], parse_options.column_delimiter[0],
+                                       parse_options.column_delimiter[0], parse_options.column_delimiter[0]) {
         _row_delimiter_length = parse_options.row_delimiter.size();
         _column_delimiter_length = parse_options.column_delimiter.size();
     }
@@ -213,6 +297,10 @@ protected:
     std::queue<CSVRow> _csv_buff;
     std::unordered_set<size_t> _escape_pos;
     std::vector<CSVColumn> _columns;
+    // characters that may change the parse state outside and inside of an enclosed column.
+    CSVSpecialCharFinder _ordinary_finder;
+    CSVSpecialCharFinder _enclose_finder;
+    CSVSpecialCharFinder _column_delimiter_finder;
 
 private:
     Status _expand_buffer();
@@ -1246,21 +1246,28 @@ Status OrcChunkReader::apply_dict_filter_eval_cache(const std::unordered_map<Slo
         }
         uint64_t column_id = _root_mapping->get_orc_type_child_mapping(pos_in_src_slot_descs).orc_type->getColumnId();
 
+        // dict filter holds result of each dict value, and the last one is result of null.
         const Filter& dict_filter = (*it.second);
-        ColumnPtr data_filter = BooleanColumn::create(size);
-        Filter& data = static_cast<BooleanColumn*>(data_filter.get())->get_data();
-        DCHECK(data.size() == size);
+        const uint8_t* code_filter = dict_filter.data();
+        uint8_t* data = filter->data();
 
         auto* batch = down_cast<orc::StringVectorBatch*>(struct_batch->fieldsColumnIdMap[column_id]);
-        for (uint32_t i = 0; i < size; i++) {
-            int64_t code = batch->codes[i];
-            DCHECK(code < dict_filter.size());
-            data[i] = dict_filter[code];
+        const int64_t* codes = batch->codes.data();
+        if (!batch->hasNulls) {
+            for (uint32_t i = 0; i < size; i++) {
+                DCHECK(codes[i] < (int64_t)dict_filter.size());
+                data[i] &= code_filter[codes[i]];
+            }
+        } else {
+            // code of null row is meaningless, don't look it up.
+            const char* not_null = batch->notNull.data();
+            const uint8_t null_value = dict_filter.back();
+            for (uint32_t i = 0; i < size; i++) {
+                data[i] &= not_null[i] ? code_filter[codes[i]] : null_value;
+            }
         }
 
-        bool all_zero = false;
-        ColumnHelper::merge_two_filters(data_filter, filter, &all_zero);
-        if (all_zero) {
+        if (SIMD::count_nonzero(*filter) == 0) {
             filter_all = true;
             break;
         }
@@ -0,0 +1,88 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "formats/parquet/bloom_filter.h"
+
+#include <algorithm>
+
+#include "gen_cpp/parquet_types.h"
+#include "gutil/strings/substitute.h"
+#include "io/seekable_input_stream.h"
+#include "util/thrift_util.h"
+
+namespace starrocks::parquet {
+
+// salts used to compute the bit to set in each word of a block.
+static constexpr uint32_t SALT[ParquetBloomFilter::BITS_SET_PER_BLOCK] = {
+        0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU, 0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U};
+
+// header is small thrift struct, in most cases it can be read in one io.
+static constexpr uint32_t HEADER_SIZE_GUESS = 32;
+
+Status ParquetBloomFilter::read(io::SeekableInputStream* stream, int64_t offset) {
+    ASSIGN_OR_RETURN(int64_t file_size, stream->get_size());
+    if (offset < 0 || offset >= file_size) {
+        return Status::Corruption(
+                strings::Substitute("invalid bloom filter offset $0, file size $1", offset, file_size));
+    }
+    uint32_t header_len = std::min<int64_t>(HEADER_SIZE_GUESS, file_size - offset);
+    std::vector<uint8_t> header_buf(header_len);
+    RETURN_IF_ERROR(stream->read_at_fully(offset, header_buf.data(), header_len));
+
+    tparquet::BloomFilterHeader header;
+    RETURN_IF_ERROR(deserialize_thrift_msg(header_buf.data(), &header_len, TProtocolType::COMPACT, &header));
+    if (!header.algorithm.__isset.BLOCK || !header.hash.__isset.XXHASH || !header.compression.__isset.UNCOMPRESSED) {
+        return Status::NotSupported("unsupported parquet bloom filter algorithm, hash or compression");
+    }
+    int32_t num_bytes = header.numBytes;
+    if (num_bytes <= 0 || static_cast<uint32_t>(num_bytes) > MAXIMUM_BYTES || num_bytes % BYTES_PER_BLOCK != 0 ||
+        offset + header_len + num_bytes > file_size) {
+        return Status::Corruption(strings::Substitute("invalid parquet bloom filter size $0", num_bytes));
+    }
+
+    _bitset.resize(num_bytes / sizeof(uint32_t));
+    _num_blocks = num_bytes / BYTES_PER_BLOCK;
+    // the bitset is stored as little endian words.
+    return stream->read_at_fully(offset + header_len, _bitset.data(), num_bytes);
+}
+
+Status ParquetBloomFilter::init(uint32_t num_bytes) {
+    if (num_bytes == 0 || num_bytes > MAXIMUM_BYTES || num_bytes % BYTES_PER_BLOCK != 0) {
+        return Status::InvalidArgument(strings::Substitute("invalid parquet bloom filter size $0", num_bytes));
+    }
+    _bitset.assign(num_bytes / sizeof(uint32_t), 0);
+    _num_blocks = num_bytes / BYTES_PER_BLOCK;
+    return Status::OK();
+}
+
+void ParquetBloomFilter::insert_hash(uint64_t hash) {
+    uint32_t* block = _bitset.data() + _block_index(hash) * BITS_SET_PER_BLOCK;
+    auto key = static_cast<uint32_t>(hash);
+    for (uint32_t i = 0; i < BITS_SET_PER_BLOCK; ++i) {
+        block[i] |= 1U << ((key * SALT[i]) >> 27);
+    }
+}
+
+bool ParquetBloomFilter::test_hash(uint64_t hash) const {
+    const uint32_t* block = _bitset.data() + _block_index(hash) * BITS_SET_PER_BLOCK;
+    auto key = static_cast<uint32_t>(hash);
+    for (uint32_t i = 0; i < BITS_SET_PER_BLOCK; ++i) {
+        if ((block[i] & (1U << ((key * SALT[i]) >> 27))) == 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace starrocks::parquet
@@ -0,0 +1,68 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "common/status.h"
+#include "util/hash_util.hpp"
+
+namespace starrocks::io {
+class SeekableInputStream;
+} // namespace starrocks::io
+
+namespace starrocks::parquet {
+
+// Split Block Bloom Filter defined by parquet format. More details refer to:
+// https://github.com/apache/parquet-format/blob/master/BloomFilter.md
+//
+// It is not compatible with BlockSplitBloomFilter in storage, which uses murmur3
+// and a different block index, so parquet files need this one.
+class ParquetBloomFilter {
+public:
+    static constexpr uint32_t BYTES_PER_BLOCK = 32;
+    static constexpr uint32_t BITS_SET_PER_BLOCK = 8;
+    // same as parquet-mr and arrow
+    static constexpr uint32_t MAXIMUM_BYTES = 128 * 1024 * 1024;
+
+    ParquetBloomFilter() = default;
+
+    // Read header and bitset of the bloom filter stored at `offset` of `stream`.
+    Status read(io::SeekableInputStream* stream, int64_t offset);
+
+    // Init an empty bloom filter with `num_bytes` bitset, used to build filter in test.
+    Status init(uint32_t num_bytes);
+
+    // `hash` is the xxhash64 of a plain encoded value.
+    void insert_hash(uint64_t hash);
+    bool test_hash(uint64_t hash) const;
+
+    // hash of plain encoded value, numbers are little endian and byte arrays have no length prefix.
+    static uint64_t hash(const void* data, size_t size) { return HashUtil::xx_hash64(data, size, 0); }
+
+    uint32_t num_bytes() const { return _bitset.size() * sizeof(uint32_t); }
+    const uint32_t* bitset() const { return _bitset.data(); }
+
+private:
+    uint32_t _block_index(uint64_t hash) const {
+        return static_cast<uint32_t>(((hash >> 32) * _num_blocks) >> 32);
+    }
+
+    std::vector<uint32_t> _bitset;
+    uint32_t _num_blocks = 0;
+};
+
+} // namespace starrocks::parquet
@@ -35,8 +35,6 @@
 #include "formats/parquet/scalar_column_reader.h"
 #include "gen_cpp/Descriptors_types.h"
 #include "gen_cpp/parquet_types.h"
-#include "simd/batch_run_counter.h"
-#include "storage/column_or_predicate.h"
 #include "storage/column_predicate.h"
 
 namespace starrocks::parquet {
@@ -75,67 +73,38 @@ Status ColumnDictFilterContext::rewrite_conjunct_ctxs_to_predicate(StoredColumnR
         return Status::OK();
     }
 
-    // ---------
-    // get dict codes according to dict values pos.
-    std::vector<int32_t> dict_codes;
-    BatchRunCounter<32> batch_run(filter.data(), 0, filter.size() - 1);
-    BatchCount batch = batch_run.next_batch();
-    int index = 0;
-    while (batch.length > 0) {
-        if (batch.AllSet()) {
-            for (int32_t i = 0; i < batch.length; i++) {
-                dict_codes.emplace_back(index + i);
-            }
-        } else if (batch.NoneSet()) {
-            // do nothing
-        } else {
-            for (int32_t i = 0; i < batch.length; i++) {
-                if (filter[index + i]) {
-                    dict_codes.emplace_back(index + i);
-                }
-            }
-        }
-        index += batch.length;
-        batch = batch_run.next_batch();
-    }
-
-    bool null_is_ok = filter[filter.size() - 1] == 1;
+    // the last one is the result of null.
+    null_is_ok = filter.back() == 1;
+    filter.pop_back();
+    dict_code_filter = std::move(filter);
+    return Status::OK();
+}
 
-    // eq predicate is faster than in predicate
-    // TODO: improve not eq and not in
-    if (dict_codes.size() == 0) {
-        predicate = nullptr;
-    } else if (dict_codes.size() == 1) {
-        predicate = obj_pool.add(
-                new_column_eq_predicate(get_type_info(kDictCodeFieldType), slot_id, std::to_string(dict_codes[0])));
-    } else {
-        std::vector<std::string> str_codes;
-        str_codes.reserve(dict_codes.size());
-        for (int code : dict_codes) {
-            str_codes.emplace_back(std::to_string(code));
+void ColumnDictFilterContext::evaluate_and(const Column* dict_codes, uint8_t* filter) const {
+    const size_t size = dict_codes->size();
+    const Column* data_column = dict_codes;
+    const uint8_t* nulls = nullptr;
+    if (dict_codes->is_nullable()) {
+        const auto* nullable_column = down_cast<const NullableColumn*>(dict_codes);
+        data_column = nullable_column->data_column().get();
+        if (nullable_column->has_null()) {
+            nulls = nullable_column->null_column()->get_data().data();
         }
-        predicate = obj_pool.add(new_column_in_predicate(get_type_info(kDictCodeFieldType), slot_id, str_codes));
     }
+    const int32_t* codes = down_cast<const FixedLengthColumn<int32_t>*>(data_column)->get_data().data();
+    const uint8_t* code_filter = dict_code_filter.data();
 
-    // deal with if NULL works or not.
-    if (null_is_ok) {
-        ColumnPredicate* result = nullptr;
-        ColumnPredicate* is_null_pred =
-                obj_pool.add(new_column_null_predicate(get_type_info(kDictCodeFieldType), slot_id, true));
-
-        if (predicate != nullptr) {
-            ColumnOrPredicate* or_pred =
-                    obj_pool.add(new ColumnOrPredicate(get_type_info(kDictCodeFieldType), slot_id));
-            or_pred->add_child(predicate);
-            or_pred->add_child(is_null_pred);
-            result = or_pred;
-        } else {
-            result = is_null_pred;
+    if (nulls == nullptr) {
+        for (size_t i = 0; i < size; i++) {
+            filter[i] &= code_filter[codes[i]];
+        }
+    } else {
+        const uint8_t null_value = null_is_ok;
+        for (size_t i = 0; i < size; i++) {
+            // code of null row is meaningless, don't look it up.
+            filter[i] &= nulls[i] ? null_value : code_filter[codes[i]];
         }
-        predicate = result;
     }
-
-    return Status::OK();
 }
 
 void ColumnReader::get_subfield_pos_with_pruned_type(const ParquetField& field, const TypeDescriptor& col_type,
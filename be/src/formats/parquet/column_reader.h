@@ -43,6 +43,7 @@ namespace starrocks {
 class RandomAccessFile;
 struct HdfsScanStats;
 class ColumnPredicate;
+class Expr;
 class ExprContext;
 class NullableColumn;
 class TIcebergSchemaField;
@@ -61,6 +62,8 @@ struct ColumnReaderOptions {
     int chunk_size = 0;
     HdfsScanStats* stats = nullptr;
     RandomAccessFile* file = nullptr;
+    // set when io of the row group is coalesced, small reads outside column chunks go through it too.
+    io::SharedBufferedInputStream* sb_stream = nullptr;
     const tparquet::RowGroup* row_group_meta = nullptr;
     uint64_t first_row_index = 0;
 };
@@ -72,16 +75,21 @@ struct ColumnDictFilterContext {
     constexpr static const LogicalType kDictCodeFieldType = TYPE_INT;
     // conjunct ctxs for each dict filter column
     std::vector<ExprContext*> conjunct_ctxs;
-    // preds transformed from `_conjunct_ctxs` for each dict filter column
-    ColumnPredicate* predicate;
+    // result of `conjunct_ctxs` evaluated on each dict value, indexed by dict code
+    Filter dict_code_filter;
+    // result of `conjunct_ctxs` evaluated on null
+    bool null_is_ok = false;
     // is output column ? if just used for filter, decode is no need
     bool is_decode_needed;
     SlotId slot_id;
     std::vector<std::string> sub_field_path;
-    ObjectPool obj_pool;
 
 public:
+    // Evaluate conjuncts once per dict value, so rows can be filtered by looking up their dict codes.
     Status rewrite_conjunct_ctxs_to_predicate(StoredColumnReader* reader, bool* is_group_filtered);
+
+    // AND `filter` with the result of looking up `dict_codes` in `dict_code_filter`.
+    void evaluate_and(const Column* dict_codes, uint8_t* filter) const;
 };
 
 class ColumnReader {
@@ -124,6 +132,19 @@ public:
         return Status::OK();
     }
 
+    // Evaluate `ctxs` on the dictionary page if all data pages are dict encoded, `is_group_filtered`
+    // is set if no dict value passes, so the row group can be skipped before reading any data page.
+    virtual Status filter_group_with_dict(const std::vector<ExprContext*>& ctxs, const SlotId slot_id,
+                                          bool* is_group_filtered) {
+        return Status::OK();
+    }
+
+    // Probe the bloom filter of column chunk with literals of eq/in conjuncts in `ctxs`,
+    // `is_group_filtered` is set if none of literals of some conjunct exists in the row group.
+    virtual Status filter_group_with_bloom_filter(const std::vector<ExprContext*>& ctxs, bool* is_group_filtered) {
+        return Status::OK();
+    }
+
     virtual void set_can_lazy_decode(bool can_lazy_decode) {}
 
     virtual Status filter_dict_column(const ColumnPtr& column, Filter* filter,
@@ -20,6 +20,8 @@
 #include <unordered_map>
 #include <utility>
 
+#include "formats/parquet/encoding_byte_stream_split.h"
+#include "formats/parquet/encoding_delta.h"
 #include "formats/parquet/encoding_dict.h"
 #include "formats/parquet/encoding_plain.h"
 #include "formats/parquet/types.h"
@@ -72,6 +74,66 @@ struct TypeEncodingTraits<tparquet::Type::FIXED_LEN_BYTE_ARRAY, tparquet::Encodi
     }
 };
 
+template <tparquet::Type::type type>
+struct TypeEncodingTraits<type, tparquet::Encoding::DELTA_BINARY_PACKED> {
+    static Status create_decoder(std::unique_ptr<Decoder>* decoder) {
+        *decoder = std::make_unique<DeltaBinaryPackedDecoder<typename PhysicalTypeTraits<type>::CppType>>();
+        return Status::OK();
+    }
+    static Status create_encoder(std::unique_ptr<Encoder>* encoder) {
+        *encoder = std::make_unique<DeltaBinaryPackedEncoder<typename PhysicalTypeTraits<type>::CppType>>();
+        return Status::OK();
+    }
+};
+
+template <tparquet::Type::type type>
+struct TypeEncodingTraits<type, tparquet::Encoding::DELTA_LENGTH_BYTE_ARRAY> {
+    static Status create_decoder(std::unique_ptr<Decoder>* decoder) {
+        *decoder = std::make_unique<DeltaLengthByteArrayDecoder>();
+        return Status::OK();
+    }
+    static Status create_encoder(std::unique_ptr<Encoder>* encoder) {
+        *encoder = std::make_unique<DeltaLengthByteArrayEncoder>();
+        return Status::OK();
+    }
+};
+
+template <tparquet::Type::type type>
+struct TypeEncodingTraits<type, tparquet::Encoding::DELTA_BYTE_ARRAY> {
+    static Status create_decoder(std::unique_ptr<Decoder>* decoder) {
+        *decoder = std::make_unique<DeltaByteArrayDecoder>();
+        return Status::OK();
+    }
+    static Status create_encoder(std::unique_ptr<Encoder>* encoder) {
+        *encoder = std::make_unique<DeltaByteArrayEncoder>();
+        return Status::OK();
+    }
+};
+
+template <>
+struct TypeEncodingTraits<tparquet::Type::FIXED_LEN_BYTE_ARRAY, tparquet::Encoding::DELTA_BYTE_ARRAY> {
+    static Status create_decoder(std::unique_ptr<Decoder>* decoder) {
+        *decoder = std::make_unique<DeltaByteArrayDecoder>(true);
+        return Status::OK();
+    }
+    static Status create_encoder(std::unique_ptr<Encoder>* encoder) {
+        *encoder = std::make_unique<DeltaByteArrayEncoder>();
+        return Status::OK();
+    }
+};
+
+template <tparquet::Type::type type>
+struct TypeEncodingTraits<type, tparquet::Encoding::BYTE_STREAM_SPLIT> {
+    static Status create_decoder(std::unique_ptr<Decoder>* decoder) {
+        *decoder = std::make_unique<ByteStreamSplitDecoder<typename PhysicalTypeTraits<type>::CppType>>();
+        return Status::OK();
+    }
+    static Status create_encoder(std::unique_ptr<Encoder>* encoder) {
+        *encoder = std::make_unique<ByteStreamSplitEncoder<typename PhysicalTypeTraits<type>::CppType>>();
+        return Status::OK();
+    }
+};
+
 template <tparquet::Type::type type_arg, tparquet::Encoding::type encoding_arg>
 struct EncodingTraits : TypeEncodingTraits<type_arg, encoding_arg> {
     static constexpr tparquet::Type::type type = type_arg;
@@ -108,10 +170,14 @@ EncodingInfoResolver::EncodingInfoResolver() {
     // INT32
     _add_map<tparquet::Type::INT32, tparquet::Encoding::PLAIN>();
     _add_map<tparquet::Type::INT32, tparquet::Encoding::RLE_DICTIONARY>();
+    _add_map<tparquet::Type::INT32, tparquet::Encoding::DELTA_BINARY_PACKED>();
+    _add_map<tparquet::Type::INT32, tparquet::Encoding::BYTE_STREAM_SPLIT>();
 
     // INT64
     _add_map<tparquet::Type::INT64, tparquet::Encoding::PLAIN>();
     _add_map<tparquet::Type::INT64, tparquet::Encoding::RLE_DICTIONARY>();
+    _add_map<tparquet::Type::INT64, tparquet::Encoding::DELTA_BINARY_PACKED>();
+    _add_map<tparquet::Type::INT64, tparquet::Encoding::BYTE_STREAM_SPLIT>();
 
     // INT96
     _add_map<tparquet::Type::INT96, tparquet::Encoding::PLAIN>();
@@ -120,18 +186,23 @@ EncodingInfoResolver::EncodingInfoResolver() {
     // FLOAT
     _add_map<tparquet::Type::FLOAT, tparquet::Encoding::PLAIN>();
     _add_map<tparquet::Type::FLOAT, tparquet::Encoding::RLE_DICTIONARY>();
+    _add_map<tparquet::Type::FLOAT, tparquet::Encoding::BYTE_STREAM_SPLIT>();
 
     // DOUBLE
     _add_map<tparquet::Type::DOUBLE, tparquet::Encoding::PLAIN>();
     _add_map<tparquet::Type::DOUBLE, tparquet::Encoding::RLE_DICTIONARY>();
+    _add_map<tparquet::Type::DOUBLE, tparquet::Encoding::BYTE_STREAM_SPLIT>();
 
     // BYTE_ARRAY encoding
     _add_map<tparquet::Type::BYTE_ARRAY, tparquet::Encoding::PLAIN>();
     _add_map<tparquet::Type::BYTE_ARRAY, tparquet::Encoding::RLE_DICTIONARY>();
+    _add_map<tparquet::Type::BYTE_ARRAY, tparquet::Encoding::DELTA_LENGTH_BYTE_ARRAY>();
+    _add_map<tparquet::Type::BYTE_ARRAY, tparquet::Encoding::DELTA_BYTE_ARRAY>();
 
     // FIXED_LEN_BYTE_ARRAY encoding
     _add_map<tparquet::Type::FIXED_LEN_BYTE_ARRAY, tparquet::Encoding::PLAIN>();
     _add_map<tparquet::Type::FIXED_LEN_BYTE_ARRAY, tparquet::Encoding::RLE_DICTIONARY>();
+    _add_map<tparquet::Type::FIXED_LEN_BYTE_ARRAY, tparquet::Encoding::DELTA_BYTE_ARRAY>();
 }
 
 EncodingInfoResolver::~EncodingInfoResolver() {
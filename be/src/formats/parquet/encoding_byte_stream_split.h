@@ -0,0 +1,177 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include <vector>
+
+#include "column/column.h"
+#include "common/status.h"
+#include "formats/parquet/encoding.h"
+#include "gutil/strings/substitute.h"
+#include "util/faststring.h"
+#include "util/slice.h"
+
+namespace starrocks::parquet {
+
+// BYTE_STREAM_SPLIT encoding scatters the K bytes of each value into K streams, the i-th stream
+// holds the i-th byte of all values. More details refer to:
+// https://github.com/apache/parquet-format/blob/master/Encodings.md#byte-stream-split-byte_stream_split--9
+//
+// Gather `num_values` values starting from `src`, the streams are `stride` bytes apart.
+template <size_t K>
+inline void byte_stream_split_decode(const uint8_t* src, size_t stride, size_t num_values, uint8_t* dst) {
+    size_t i = 0;
+#ifdef __SSE2__
+    if constexpr (K == 4) {
+        for (; i + 16 <= num_values; i += 16) {
+            __m128i s0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+            __m128i s1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + stride + i));
+            __m128i s2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 2 * stride + i));
+            __m128i s3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 3 * stride + i));
+            __m128i b01_lo = _mm_unpacklo_epi8(s0, s1);
+            __m128i b01_hi = _mm_unpackhi_epi8(s0, s1);
+            __m128i b23_lo = _mm_unpacklo_epi8(s2, s3);
+            __m128i b23_hi = _mm_unpackhi_epi8(s2, s3);
+            auto* out = reinterpret_cast<__m128i*>(dst + i * K);
+            _mm_storeu_si128(out, _mm_unpacklo_epi16(b01_lo, b23_lo));
+            _mm_storeu_si128(out + 1, _mm_unpackhi_epi16(b01_lo, b23_lo));
+            _mm_storeu_si128(out + 2, _mm_unpacklo_epi16(b01_hi, b23_hi));
+            _mm_storeu_si128(out + 3, _mm_unpackhi_epi16(b01_hi, b23_hi));
+        }
+    } else if constexpr (K == 8) {
+        for (; i + 16 <= num_values; i += 16) {
+            __m128i s[8];
+            for (size_t k = 0; k < 8; ++k) {
+                s[k] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + k * stride + i));
+            }
+            // 2 bytes of values [0, 8) and [8, 16)
+            __m128i b2[8];
+            for (size_t k = 0; k < 4; ++k) {
+                b2[2 * k] = _mm_unpacklo_epi8(s[2 * k], s[2 * k + 1]);
+                b2[2 * k + 1] = _mm_unpackhi_epi8(s[2 * k], s[2 * k + 1]);
+            }
+            // 4 bytes of values [0, 4), [4, 8), [8, 12) and [12, 16)
+            __m128i b4_lo[4];
+            __m128i b4_hi[4];
+            for (size_t k = 0; k < 2; ++k) {
+                b4_lo[2 * k] = _mm_unpacklo_epi16(b2[k], b2[k + 2]);
+                b4_lo[2 * k + 1] = _mm_unpackhi_epi16(b2[k], b2[k + 2]);
+                b4_hi[2 * k] = _mm_unpacklo_epi16(b2[k + 4], b2[k + 6]);
+                b4_hi[2 * k + 1] = _mm_unpackhi_epi16(b2[k + 4], b2[k + 6]);
+            }
+            auto* out = reinterpret_cast<__m128i*>(dst + i * K);
+            for (size_t k = 0; k < 4; ++k) {
+                _mm_storeu_si128(out + 2 * k, _mm_unpacklo_epi32(b4_lo[k], b4_hi[k]));
+                _mm_storeu_si128(out + 2 * k + 1, _mm_unpackhi_epi32(b4_lo[k], b4_hi[k]));
+            }
+        }
+    }
+#endif
+    for (; i < num_values; ++i) {
+        for (size_t k = 0; k < K; ++k) {
+            dst[i * K + k] = src[k * stride + i];
+        }
+    }
+}
+
+template <typename T>
+class ByteStreamSplitEncoder final : public Encoder {
+public:
+    ByteStreamSplitEncoder() = default;
+    ~ByteStreamSplitEncoder() override = default;
+
+    Status append(const uint8_t* vals, size_t count) override {
+        _values.append(vals, count * sizeof(T));
+        return Status::OK();
+    }
+
+    Slice build() override {
+        size_t num_values = _values.size() / sizeof(T);
+        _buffer.resize(_values.size());
+        for (size_t i = 0; i < num_values; ++i) {
+            for (size_t k = 0; k < sizeof(T); ++k) {
+                _buffer[k * num_values + i] = _values[i * sizeof(T) + k];
+            }
+        }
+        return {_buffer.data(), _buffer.size()};
+    }
+
+private:
+    faststring _values;
+    faststring _buffer;
+};
+
+template <typename T>
+class ByteStreamSplitDecoder final : public Decoder {
+public:
+    ByteStreamSplitDecoder() = default;
+    ~ByteStreamSplitDecoder() override = default;
+
+    Status set_data(const Slice& data) override {
+        if (UNLIKELY(data.size % sizeof(T) != 0)) {
+            return Status::Corruption(strings::Substitute(
+                    "byte stream split data size $0 is not a multiple of value size $1", data.size, sizeof(T)));
+        }
+        _data = data;
+        _num_values = data.size / sizeof(T);
+        _index = 0;
+        return Status::OK();
+    }
+
+    Status next_batch(size_t count, ColumnContentType content_type, Column* dst) override {
+        RETURN_IF_ERROR(_check_remaining(count));
+        size_t original_size = dst->size();
+        dst->resize(original_size + count);
+        _decode(count, dst->mutable_raw_data() + original_size * sizeof(T));
+        return Status::OK();
+    }
+
+    Status skip(size_t values_to_skip) override {
+        RETURN_IF_ERROR(_check_remaining(values_to_skip));
+        _index += values_to_skip;
+        return Status::OK();
+    }
+
+    Status next_batch(size_t count, uint8_t* dst) override {
+        RETURN_IF_ERROR(_check_remaining(count));
+        _decode(count, dst);
+        return Status::OK();
+    }
+
+private:
+    Status _check_remaining(size_t count) const {
+        if (UNLIKELY(_index + count > _num_values)) {
+            return Status::InternalError(strings::Substitute(
+                    "going to read out-of-bounds data, index=$0,count=$1,size=$2", _index, count, _num_values));
+        }
+        return Status::OK();
+    }
+
+    void _decode(size_t count, uint8_t* dst) {
+        const auto* src = reinterpret_cast<const uint8_t*>(_data.data) + _index;
+        byte_stream_split_decode<sizeof(T)>(src, _num_values, count, dst);
+        _index += count;
+    }
+
+    Slice _data;
+    size_t _num_values = 0;
+    size_t _index = 0;
+};
+
+} // namespace starrocks::parquet
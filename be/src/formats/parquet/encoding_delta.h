@@ -0,0 +1,540 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "column/column.h"
+#include "common/status.h"
+#include "formats/parquet/encoding.h"
+#include "gutil/strings/substitute.h"
+#include "util/bit_stream_utils.h"
+#include "util/bit_stream_utils.inline.h"
+#include "util/bit_util.h"
+#include "util/coding.h"
+#include "util/faststring.h"
+#include "util/raw_container.h"
+#include "util/slice.h"
+
+namespace starrocks::parquet {
+
+// DELTA_BINARY_PACKED encoding, more details refer to:
+// https://github.com/apache/parquet-format/blob/master/Encodings.md#delta-encoding-delta_binary_packed--5
+//
+// <block size in values> <number of miniblocks in a block> <total value count> <first value>
+// followed by blocks of
+// <min delta> <list of bitwidths of miniblocks> <miniblocks>
+template <typename T>
+class DeltaBinaryPackedEncoder final : public Encoder {
+public:
+    static_assert(std::is_same_v<T, int32_t> || std::is_same_v<T, int64_t>);
+    using UT = std::make_unsigned_t<T>;
+
+    DeltaBinaryPackedEncoder() = default;
+    ~DeltaBinaryPackedEncoder() override = default;
+
+    Status append(const uint8_t* vals, size_t count) override {
+        const T* values = reinterpret_cast<const T*>(vals);
+        _values.insert(_values.end(), values, values + count);
+        return Status::OK();
+    }
+
+    Slice build() override {
+        _buffer.clear();
+        put_varint64(&_buffer, kValuesPerBlock);
+        put_varint64(&_buffer, kMiniblocksPerBlock);
+        put_varint64(&_buffer, _values.size());
+        put_varint64(&_buffer, _values.empty() ? 0 : zigzag_encode(_values[0]));
+
+        T deltas[kValuesPerBlock];
+        for (size_t start = 1; start < _values.size(); start += kValuesPerBlock) {
+            size_t num_deltas = std::min<size_t>(kValuesPerBlock, _values.size() - start);
+            T min_delta = std::numeric_limits<T>::max();
+            for (size_t i = 0; i < num_deltas; ++i) {
+                UT delta = static_cast<UT>(_values[start + i]) - static_cast<UT>(_values[start + i - 1]);
+                deltas[i] = static_cast<T>(delta);
+                min_delta = std::min(min_delta, deltas[i]);
+            }
+            put_varint64(&_buffer, zigzag_encode(min_delta));
+
+            uint8_t bit_widths[kMiniblocksPerBlock] = {0};
+            for (size_t i = 0; i < num_deltas; ++i) {
+                UT adjusted = static_cast<UT>(deltas[i]) - static_cast<UT>(min_delta);
+                int bit_width = adjusted == 0 ? 0 : BitUtil::Log2FloorNonZero64(adjusted) + 1;
+                auto& width = bit_widths[i / kValuesPerMiniblock];
+                width = std::max<uint8_t>(width, bit_width);
+            }
+            _buffer.append(bit_widths, kMiniblocksPerBlock);
+
+            // the last miniblock is padded to the full size
+            for (size_t begin = 0; begin < num_deltas; begin += kValuesPerMiniblock) {
+                int bit_width = bit_widths[begin / kValuesPerMiniblock];
+                if (bit_width == 0) {
+                    continue;
+                }
+                faststring packed;
+                BitWriter bit_writer(&packed);
+                for (size_t i = begin; i < begin + kValuesPerMiniblock; ++i) {
+                    UT adjusted = i < num_deltas ? static_cast<UT>(deltas[i]) - static_cast<UT>(min_delta) : 0;
+                    bit_writer.PutValue(adjusted, bit_width);
+                }
+                bit_writer.Flush();
+                _buffer.append(packed.data(), packed.size());
+            }
+        }
+        return {_buffer.data(), _buffer.size()};
+    }
+
+private:
+    static constexpr size_t kValuesPerBlock = 128;
+    static constexpr size_t kMiniblocksPerBlock = 4;
+    static constexpr size_t kValuesPerMiniblock = kValuesPerBlock / kMiniblocksPerBlock;
+
+    static uint64_t zigzag_encode(int64_t v) { return (static_cast<uint64_t>(v) << 1) ^ (v >> 63); }
+
+    std::vector<T> _values;
+    faststring _buffer;
+};
+
+template <typename T>
+class DeltaBinaryPackedDecoder final : public Decoder {
+public:
+    static_assert(std::is_same_v<T, int32_t> || std::is_same_v<T, int64_t>);
+    using UT = std::make_unsigned_t<T>;
+
+    DeltaBinaryPackedDecoder() = default;
+    ~DeltaBinaryPackedDecoder() override = default;
+
+    Status set_data(const Slice& data) override {
+        _bit_reader.reset(reinterpret_cast<const uint8_t*>(data.data), data.size);
+        return _init_header();
+    }
+
+    Status next_batch(size_t count, ColumnContentType content_type, Column* dst) override {
+        RETURN_IF_ERROR(_check_remaining(count));
+        size_t original_size = dst->size();
+        dst->resize(original_size + count);
+        T* values = reinterpret_cast<T*>(dst->mutable_raw_data()) + original_size;
+        return _decode(count, values);
+    }
+
+    Status skip(size_t values_to_skip) override {
+        RETURN_IF_ERROR(_check_remaining(values_to_skip));
+        // deltas must be accumulated even if the values are skipped
+        raw::stl_vector_resize_uninitialized(&_skip_buffer, std::min(values_to_skip, _values_per_miniblock));
+        while (values_to_skip > 0) {
+            size_t n = std::min(values_to_skip, _skip_buffer.size());
+            RETURN_IF_ERROR(_decode(n, _skip_buffer.data()));
+            values_to_skip -= n;
+        }
+        return Status::OK();
+    }
+
+    Status next_batch(size_t count, uint8_t* dst) override {
+        RETURN_IF_ERROR(_check_remaining(count));
+        return _decode(count, reinterpret_cast<T*>(dst));
+    }
+
+    // Number of values encoded in the page.
+    size_t total_values_count() const { return _total_values_count; }
+
+    // Pointer to the byte after the encoded data, only valid after all values are decoded.
+    const uint8_t* data_end() const { return _bit_reader.buffer_pos(); }
+
+private:
+    Status _check_remaining(size_t count) const {
+        if (UNLIKELY(count > _values_remaining)) {
+            return Status::InternalError(strings::Substitute("going to read out-of-bounds data, count=$0,remaining=$1",
+                                                             count, _values_remaining));
+        }
+        return Status::OK();
+    }
+
+    Status _init_header() {
+        uint32_t values_per_block = 0;
+        uint32_t num_miniblocks = 0;
+        uint64_t first_value = 0;
+        if (!_bit_reader.get_lleb_128(&values_per_block) || !_bit_reader.get_lleb_128(&num_miniblocks) ||
+            !_bit_reader.get_lleb_128(&_total_values_count) || !_bit_reader.get_lleb_128(&first_value)) {
+            return Status::Corruption("fail to read delta binary packed header");
+        }
+        if (values_per_block == 0 || num_miniblocks == 0 || values_per_block % num_miniblocks != 0 ||
+            (values_per_block / num_miniblocks) % 32 != 0) {
+            return Status::Corruption(strings::Substitute(
+                    "invalid delta binary packed header, block size=$0, miniblocks=$1", values_per_block,
+                    num_miniblocks));
+        }
+        _num_miniblocks = num_miniblocks;
+        _values_per_miniblock = values_per_block / num_miniblocks;
+        _bit_widths.resize(_num_miniblocks);
+        _miniblock_index = _num_miniblocks;
+        _values_remaining = _total_values_count;
+        _deltas_remaining = _total_values_count > 0 ? _total_values_count - 1 : 0;
+
+        // the first value is served as a decoded miniblock with only one value
+        raw::stl_vector_resize_uninitialized(&_buffer, std::max<size_t>(_values_per_miniblock, 1));
+        _last_value = static_cast<UT>((first_value >> 1) ^ (~(first_value & 1) + 1));
+        _buffer[0] = _last_value;
+        _buffer_size = _total_values_count > 0 ? 1 : 0;
+        _buffer_offset = 0;
+        return Status::OK();
+    }
+
+    Status _init_block() {
+        uint64_t min_delta = 0;
+        if (!_bit_reader.get_lleb_128(&min_delta)) {
+            return Status::Corruption("fail to read min delta of delta binary packed block");
+        }
+        _min_delta = static_cast<UT>((min_delta >> 1) ^ (~(min_delta & 1) + 1));
+        for (size_t i = 0; i < _num_miniblocks; ++i) {
+            if (!_bit_reader.get_bytes(1, &_bit_widths[i])) {
+                return Status::Corruption("fail to read bit widths of delta binary packed block");
+            }
+        }
+        _miniblock_index = 0;
+        return Status::OK();
+    }
+
+    // Unpack the next miniblock into _buffer and turn the deltas into values.
+    Status _next_miniblock() {
+        if (_miniblock_index == _num_miniblocks) {
+            RETURN_IF_ERROR(_init_block());
+        }
+        int bit_width = _bit_widths[_miniblock_index++];
+        if (UNLIKELY(bit_width > static_cast<int>(sizeof(T) * 8))) {
+            return Status::Corruption(strings::Substitute("invalid bit width $0 of delta binary packed miniblock",
+                                                          bit_width));
+        }
+        size_t num_values = std::min(_values_per_miniblock, _deltas_remaining);
+        // miniblocks are padded to the full size, and the unpacking won't drop trailing bits because
+        // the miniblock size is a multiple of 32.
+        int num_unpacked = _bit_reader.unpack_batch(bit_width, _values_per_miniblock, _buffer.data());
+        if (UNLIKELY(static_cast<size_t>(num_unpacked) < num_values)) {
+            return Status::Corruption("delta binary packed miniblock is truncated");
+        }
+
+        UT* __restrict__ values = _buffer.data();
+        UT min_delta = _min_delta;
+        for (size_t i = 0; i < num_values; ++i) {
+            values[i] += min_delta;
+        }
+        UT last_value = _last_value;
+        for (size_t i = 0; i < num_values; ++i) {
+            last_value += values[i];
+            values[i] = last_value;
+        }
+        _last_value = last_value;
+
+        _deltas_remaining -= num_values;
+        _buffer_size = num_values;
+        _buffer_offset = 0;
+        return Status::OK();
+    }
+
+    Status _decode(size_t count, T* dst) {
+        while (count > 0) {
+            if (_buffer_offset == _buffer_size) {
+                RETURN_IF_ERROR(_next_miniblock());
+            }
+            size_t n = std::min(count, _buffer_size - _buffer_offset);
+            memcpy(dst, _buffer.data() + _buffer_offset, n * sizeof(T));
+            dst += n;
+            count -= n;
+            _buffer_offset += n;
+            _values_remaining -= n;
+        }
+        return Status::OK();
+    }
+
+    BatchedBitReader _bit_reader;
+
+    size_t _num_miniblocks = 0;
+    size_t _values_per_miniblock = 0;
+    uint64_t _total_values_count = 0;
+    size_t _values_remaining = 0;
+    size_t _deltas_remaining = 0;
+
+    // current block
+    UT _min_delta = 0;
+    std::vector<uint8_t> _bit_widths;
+    size_t _miniblock_index = 0;
+
+    // decoded values of current miniblock
+    UT _last_value = 0;
+    std::vector<UT> _buffer;
+    size_t _buffer_size = 0;
+    size_t _buffer_offset = 0;
+
+    std::vector<T> _skip_buffer;
+};
+
+// DELTA_LENGTH_BYTE_ARRAY encoding, the lengths are encoded by DELTA_BINARY_PACKED encoding,
+// followed by the concatenated data of all values.
+class DeltaLengthByteArrayEncoder final : public Encoder {
+public:
+    DeltaLengthByteArrayEncoder() = default;
+    ~DeltaLengthByteArrayEncoder() override = default;
+
+    Status append(const uint8_t* vals, size_t count) override {
+        const auto* slices = reinterpret_cast<const Slice*>(vals);
+        for (size_t i = 0; i < count; ++i) {
+            auto length = static_cast<int32_t>(slices[i].size);
+            RETURN_IF_ERROR(_length_encoder.append(reinterpret_cast<const uint8_t*>(&length), 1));
+            _data.append(slices[i].data, slices[i].size);
+        }
+        return Status::OK();
+    }
+
+    Slice build() override {
+        Slice lengths = _length_encoder.build();
+        _buffer.clear();
+        _buffer.append(lengths.data, lengths.size);
+        _buffer.append(_data.data(), _data.size());
+        return {_buffer.data(), _buffer.size()};
+    }
+
+private:
+    DeltaBinaryPackedEncoder<int32_t> _length_encoder;
+    faststring _data;
+    faststring _buffer;
+};
+
+class DeltaLengthByteArrayDecoder final : public Decoder {
+public:
+    DeltaLengthByteArrayDecoder() = default;
+    ~DeltaLengthByteArrayDecoder() override = default;
+
+    Status set_data(const Slice& data) override {
+        // decode all lengths up front to locate the start of the values
+        RETURN_IF_ERROR(_length_decoder.set_data(data));
+        size_t num_values = _length_decoder.total_values_count();
+        raw::stl_vector_resize_uninitialized(&_lengths, num_values);
+        RETURN_IF_ERROR(_length_decoder.next_batch(num_values, reinterpret_cast<uint8_t*>(_lengths.data())));
+
+        const char* data_begin = reinterpret_cast<const char*>(_length_decoder.data_end());
+        size_t data_size = data.data + data.size - data_begin;
+        size_t total_length = 0;
+        for (int32_t length : _lengths) {
+            if (UNLIKELY(length < 0)) {
+                return Status::Corruption(strings::Substitute("invalid negative length $0 of byte array", length));
+            }
+            total_length += length;
+        }
+        if (UNLIKELY(total_length > data_size)) {
+            return Status::Corruption(strings::Substitute("byte array data is truncated, expect=$0, actual=$1",
+                                                          total_length, data_size));
+        }
+        _data = Slice(data_begin, total_length);
+        _offset = 0;
+        _index = 0;
+        return Status::OK();
+    }
+
+    Status next_batch(size_t count, ColumnContentType content_type, Column* dst) override {
+        raw::stl_vector_resize_uninitialized(&_slices, count);
+        RETURN_IF_ERROR(next_batch(count, reinterpret_cast<uint8_t*>(_slices.data())));
+        // values are adjacent in the page
+        if (UNLIKELY(!dst->append_continuous_strings(_slices))) {
+            return Status::InternalError("DeltaLengthByteArrayDecoder append strings to column failed");
+        }
+        return Status::OK();
+    }
+
+    Status skip(size_t values_to_skip) override {
+        RETURN_IF_ERROR(_check_remaining(values_to_skip));
+        for (size_t i = 0; i < values_to_skip; ++i) {
+            _offset += _lengths[_index++];
+        }
+        return Status::OK();
+    }
+
+    Status next_batch(size_t count, uint8_t* dst) override {
+        RETURN_IF_ERROR(_check_remaining(count));
+        auto* slices = reinterpret_cast<Slice*>(dst);
+        for (size_t i = 0; i < count; ++i) {
+            size_t length = _lengths[_index++];
+            slices[i] = Slice(_data.data + _offset, length);
+            _offset += length;
+        }
+        return Status::OK();
+    }
+
+private:
+    Status _check_remaining(size_t count) const {
+        if (UNLIKELY(_index + count > _lengths.size())) {
+            return Status::InternalError(strings::Substitute(
+                    "going to read out-of-bounds data, index=$0,count=$1,size=$2", _index, count, _lengths.size()));
+        }
+        return Status::OK();
+    }
+
+    DeltaBinaryPackedDecoder<int32_t> _length_decoder;
+    std::vector<int32_t> _lengths;
+    std::vector<Slice> _slices;
+    Slice _data;
+    size_t _offset = 0;
+    size_t _index = 0;
+};
+
+// DELTA_BYTE_ARRAY encoding, also known as incremental encoding. The prefix lengths are encoded by
+// DELTA_BINARY_PACKED encoding, followed by the suffixes encoded by DELTA_LENGTH_BYTE_ARRAY encoding.
+class DeltaByteArrayEncoder final : public Encoder {
+public:
+    DeltaByteArrayEncoder() = default;
+    ~DeltaByteArrayEncoder() override = default;
+
+    Status append(const uint8_t* vals, size_t count) override {
+        const auto* slices = reinterpret_cast<const Slice*>(vals);
+        for (size_t i = 0; i < count; ++i) {
+            const Slice& value = slices[i];
+            size_t max_prefix = std::min(value.size, _last_value.size());
+            size_t prefix = 0;
+            while (prefix < max_prefix && value.data[prefix] == _last_value[prefix]) {
+                prefix++;
+            }
+            Slice suffix(value.data + prefix, value.size - prefix);
+            auto prefix_length = static_cast<int32_t>(prefix);
+            RETURN_IF_ERROR(_prefix_encoder.append(reinterpret_cast<const uint8_t*>(&prefix_length), 1));
+            RETURN_IF_ERROR(_suffix_encoder.append(reinterpret_cast<const uint8_t*>(&suffix), 1));
+            _last_value.assign(value.data, value.size);
+        }
+        return Status::OK();
+    }
+
+    Slice build() override {
+        Slice prefixes = _prefix_encoder.build();
+        Slice suffixes = _suffix_encoder.build();
+        _buffer.clear();
+        _buffer.append(prefixes.data, prefixes.size);
+        _buffer.append(suffixes.data, suffixes.size);
+        return {_buffer.data(), _buffer.size()};
+    }
+
+private:
+    DeltaBinaryPackedEncoder<int32_t> _prefix_encoder;
+    DeltaLengthByteArrayEncoder _suffix_encoder;
+    std::string _last_value;
+    faststring _buffer;
+};
+
+// Values of FIXED_LEN_BYTE_ARRAY are all `type_length` bytes, and are appended to columns as fixed length strings.
+class DeltaByteArrayDecoder final : public Decoder {
+public:
+    explicit DeltaByteArrayDecoder(bool fixed_length = false) : _fixed_length(fixed_length) {}
+    ~DeltaByteArrayDecoder() override = default;
+
+    void set_type_length(int32_t type_length) override { _type_length = type_length; }
+
+    Status set_data(const Slice& data) override {
+        RETURN_IF_ERROR(_prefix_decoder.set_data(data));
+        size_t num_values = _prefix_decoder.total_values_count();
+        raw::stl_vector_resize_uninitialized(&_prefix_lengths, num_values);
+        RETURN_IF_ERROR(
+                _prefix_decoder.next_batch(num_values, reinterpret_cast<uint8_t*>(_prefix_lengths.data())));
+
+        const char* suffix_begin = reinterpret_cast<const char*>(_prefix_decoder.data_end());
+        RETURN_IF_ERROR(_suffix_decoder.set_data(Slice(suffix_begin, data.data + data.size - suffix_begin)));
+        _last_value.clear();
+        _index = 0;
+        return Status::OK();
+    }
+
+    Status next_batch(size_t count, ColumnContentType content_type, Column* dst) override {
+        RETURN_IF_ERROR(_decode(count));
+        // values are rebuilt into a continuous buffer
+        bool ret = _fixed_length ? dst->append_continuous_fixed_length_strings(_buffer.data(), count, _type_length)
+                                 : dst->append_continuous_strings(_values);
+        if (UNLIKELY(!ret)) {
+            return Status::InternalError("DeltaByteArrayDecoder append strings to column failed");
+        }
+        return Status::OK();
+    }
+
+    Status skip(size_t values_to_skip) override {
+        // values must be rebuilt even if they are skipped, because the next value depends on the previous one
+        return _decode(values_to_skip);
+    }
+
+    // The returned slices are valid until the next call.
+    Status next_batch(size_t count, uint8_t* dst) override {
+        RETURN_IF_ERROR(_decode(count));
+        memcpy(dst, _values.data(), count * sizeof(Slice));
+        return Status::OK();
+    }
+
+private:
+    Status _decode(size_t count) {
+        if (UNLIKELY(_index + count > _prefix_lengths.size())) {
+            return Status::InternalError(strings::Substitute(
+                    "going to read out-of-bounds data, index=$0,count=$1,size=$2", _index, count,
+                    _prefix_lengths.size()));
+        }
+        raw::stl_vector_resize_uninitialized(&_suffixes, count);
+        RETURN_IF_ERROR(_suffix_decoder.next_batch(count, reinterpret_cast<uint8_t*>(_suffixes.data())));
+
+        // compute the total size first so that the values can be rebuilt without reallocation
+        const int32_t* prefix_lengths = _prefix_lengths.data() + _index;
+        size_t last_length = _last_value.size();
+        size_t total_length = 0;
+        for (size_t i = 0; i < count; ++i) {
+            if (UNLIKELY(prefix_lengths[i] < 0 || static_cast<size_t>(prefix_lengths[i]) > last_length)) {
+                return Status::Corruption(strings::Substitute("invalid prefix length $0, previous value length=$1",
+                                                              prefix_lengths[i], last_length));
+            }
+            last_length = prefix_lengths[i] + _suffixes[i].size;
+            if (UNLIKELY(_fixed_length && last_length != _type_length)) {
+                return Status::Corruption(strings::Substitute("invalid value length $0 of fixed length $1",
+                                                              last_length, _type_length));
+            }
+            total_length += last_length;
+        }
+
+        raw::stl_vector_resize_uninitialized(&_buffer, total_length);
+        raw::stl_vector_resize_uninitialized(&_values, count);
+        char* pos = _buffer.data();
+        const char* last_value = _last_value.data();
+        for (size_t i = 0; i < count; ++i) {
+            size_t prefix_length = prefix_lengths[i];
+            memcpy(pos, last_value, prefix_length);
+            memcpy(pos + prefix_length, _suffixes[i].data, _suffixes[i].size);
+            _values[i] = Slice(pos, prefix_length + _suffixes[i].size);
+            last_value = pos;
+            pos += _values[i].size;
+        }
+        if (count > 0) {
+            _last_value.assign(_values[count - 1].data, _values[count - 1].size);
+        }
+        _index += count;
+        return Status::OK();
+    }
+
+    DeltaBinaryPackedDecoder<int32_t> _prefix_decoder;
+    DeltaLengthByteArrayDecoder _suffix_decoder;
+    std::vector<int32_t> _prefix_lengths;
+    size_t _index = 0;
+    const bool _fixed_length;
+    size_t _type_length = 0;
+
+    std::string _last_value;
+    std::vector<Slice> _suffixes;
+    std::vector<char> _buffer;
+    std::vector<Slice> _values;
+};
+
+} // namespace starrocks::parquet
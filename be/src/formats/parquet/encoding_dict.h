@@ -95,6 +95,19 @@ public:
         return Status::OK();
     }
 
+    Status get_dict_values(Column* column) override {
+        FixedLengthColumn<T>* data_column /* = nullptr */;
+        if (column->is_nullable()) {
+            auto nullable_column = down_cast<NullableColumn*>(column);
+            nullable_column->null_column()->append_default(_dict.size());
+            data_column = down_cast<FixedLengthColumn<T>*>(nullable_column->data_column().get());
+        } else {
+            data_column = down_cast<FixedLengthColumn<T>*>(column);
+        }
+        data_column->append_numbers(_dict.data(), _dict.size() * SIZE_OF_TYPE);
+        return Status::OK();
+    }
+
     Status set_data(const Slice& data) override {
         if (data.size > 0) {
             uint8_t bit_width = *data.data;
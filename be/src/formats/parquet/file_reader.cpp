@@ -193,17 +193,16 @@ FileMetaData* FileReader::get_file_metadata() {
     return _file_metadata.get();
 }
 
-Status FileReader::_parse_footer(FileMetaDataPtr* file_metadata_ptr, int64_t* file_metadata_size) {
-    std::vector<char> footer_buffer;
+Status FileReader::_read_footer(std::vector<char>* footer_buffer) {
     ASSIGN_OR_RETURN(uint32_t footer_read_size, _get_footer_read_size());
-    footer_buffer.resize(footer_read_size);
+    footer_buffer->resize(footer_read_size);
 
     {
         SCOPED_RAW_TIMER(&_scanner_ctx->stats->footer_read_ns);
-        RETURN_IF_ERROR(_file->read_at_fully(_file_size - footer_read_size, footer_buffer.data(), footer_read_size));
+        RETURN_IF_ERROR(_file->read_at_fully(_file_size - footer_read_size, footer_buffer->data(), footer_read_size));
     }
 
-    ASSIGN_OR_RETURN(uint32_t metadata_length, _parse_metadata_length(footer_buffer));
+    ASSIGN_OR_RETURN(uint32_t metadata_length, _parse_metadata_length(*footer_buffer));
 
     _scanner_ctx->stats->request_bytes_read += metadata_length + PARQUET_FOOTER_SIZE;
     _scanner_ctx->stats->request_bytes_read_uncompressed += metadata_length + PARQUET_FOOTER_SIZE;
@@ -211,10 +210,48 @@ Status FileReader::_parse_footer(FileMetaDataPtr* file_metadata_ptr, int64_t* fi
     if (footer_read_size < (metadata_length + PARQUET_FOOTER_SIZE)) {
         // footer_buffer's size is not enough to read the whole metadata, we need to re-read for larger size
         size_t re_read_size = metadata_length + PARQUET_FOOTER_SIZE;
-        footer_buffer.resize(re_read_size);
+        footer_buffer->resize(re_read_size);
         {
             SCOPED_RAW_TIMER(&_scanner_ctx->stats->footer_read_ns);
-            RETURN_IF_ERROR(_file->read_at_fully(_file_size - re_read_size, footer_buffer.data(), re_read_size));
+            RETURN_IF_ERROR(_file->read_at_fully(_file_size - re_read_size, footer_buffer->data(), re_read_size));
+        }
+    }
+    return Status::OK();
+}
+
+Status FileReader::_parse_footer(FileMetaDataPtr* file_metadata_ptr, int64_t* file_metadata_size) {
+    std::vector<char> footer_buffer;
+    // The raw footer persisted in disk cache survives restart, read it before going to the remote storage.
+    bool use_disk_cache = _cache != nullptr && config::datacache_persist_file_metadata;
+    bool hit_disk_cache = false;
+    std::string footer_blob_key;
+    if (use_disk_cache) {
+        SCOPED_RAW_TIMER(&_scanner_ctx->stats->footer_cache_read_ns);
+        footer_blob_key = build_file_meta_blob_key(_file->filename(), _file_mtime, _file_size, "parquet_footer");
+        auto res = _cache->read_blob(footer_blob_key);
+        if (res.ok()) {
+            footer_buffer.assign(res.value().begin(), res.value().end());
+            hit_disk_cache = true;
+            _scanner_ctx->stats->footer_disk_cache_read_count += 1;
+        }
+    }
+    if (!hit_disk_cache) {
+        RETURN_IF_ERROR(_read_footer(&footer_buffer));
+    }
+
+    ASSIGN_OR_RETURN(uint32_t metadata_length, _parse_metadata_length(footer_buffer));
+    if (footer_buffer.size() < metadata_length + PARQUET_FOOTER_SIZE) {
+        return Status::Corruption(strings::Substitute("Parquet footer size $0 is smaller than metadata length $1",
+                                                      footer_buffer.size(), metadata_length));
+    }
+    if (use_disk_cache && !hit_disk_cache) {
+        size_t blob_size = metadata_length + PARQUET_FOOTER_SIZE;
+        std::string_view blob(footer_buffer.data() + footer_buffer.size() - blob_size, blob_size);
+        Status st = _cache->write_blob(footer_blob_key, blob);
+        if (st.ok()) {
+            _scanner_ctx->stats->footer_disk_cache_write_count += 1;
+        } else if (!st.is_already_exist() && !st.is_cancelled()) {
+            LOG(WARNING) << "write parquet footer to disk cache failed, file: " << _file->filename() << ", " << st;
         }
     }
 
@@ -93,6 +93,9 @@ private:
 
     Status _parse_footer(FileMetaDataPtr* file_metadata, int64_t* file_metadata_size);
 
+    // read the raw footer from the end of file, which ends with metadata and PARQUET_FOOTER_SIZE bytes.
+    Status _read_footer(std::vector<char>* footer_buffer);
+
     void _prepare_read_columns();
 
     Status _init_group_readers();
@@ -58,6 +58,9 @@ Status GroupReader::init() {
 
 Status GroupReader::prepare() {
     RETURN_IF_ERROR(_rewrite_conjunct_ctxs_to_predicates(&_is_group_filtered));
+    if (!_is_group_filtered) {
+        RETURN_IF_ERROR(_filter_group_with_dict_and_bloom_filter(&_is_group_filtered));
+    }
     _init_read_chunk();
     _range = SparseRange<uint64_t>(_row_group_first_row, _row_group_first_row + _row_group_metadata->num_rows);
     if (config::parquet_page_index_enable) {
@@ -254,6 +257,7 @@ Status GroupReader::_init_column_readers() {
     opts.chunk_size = _param.chunk_size;
     opts.stats = _param.stats;
     opts.file = _param.file;
+    opts.sb_stream = _param.sb_stream;
     opts.row_group_meta = _row_group_metadata;
     opts.first_row_index = _row_group_first_row;
     for (const auto& column : _param.read_cols) {
@@ -419,6 +423,43 @@ Status GroupReader::_rewrite_conjunct_ctxs_to_predicates(bool* is_group_filtered
     return Status::OK();
 }
 
+Status GroupReader::_filter_group_with_dict_and_bloom_filter(bool* is_group_filtered) {
+    // dict and bloom filter are only used to prune row group, the row group is read as usual if they are broken.
+    for (const auto& column : _param.read_cols) {
+        SlotId slot_id = column.slot_id();
+        const auto it = _param.conjunct_ctxs_by_slot.find(slot_id);
+        if (it == _param.conjunct_ctxs_by_slot.end()) {
+            continue;
+        }
+        const auto& column_reader = _column_readers[slot_id];
+        if (config::parquet_dict_page_filter_enable) {
+            SCOPED_RAW_TIMER(&_param.stats->group_dict_filter_ns);
+            auto st = column_reader->filter_group_with_dict(it->second, slot_id, is_group_filtered);
+            if (!st.ok()) {
+                LOG(WARNING) << "Failed to filter row group with dict, file: " << _param.file->filename()
+                             << ", column: " << column.slot_desc->col_name() << ", error: " << st;
+                *is_group_filtered = false;
+            } else if (*is_group_filtered) {
+                _param.stats->dict_page_skip_groups += 1;
+                return Status::OK();
+            }
+        }
+        if (config::parquet_bloom_filter_enable) {
+            SCOPED_RAW_TIMER(&_param.stats->bloom_filter_ns);
+            auto st = column_reader->filter_group_with_bloom_filter(it->second, is_group_filtered);
+            if (!st.ok()) {
+                LOG(WARNING) << "Failed to filter row group with bloom filter, file: " << _param.file->filename()
+                             << ", column: " << column.slot_desc->col_name() << ", error: " << st;
+                *is_group_filtered = false;
+            } else if (*is_group_filtered) {
+                _param.stats->bloom_filter_skip_groups += 1;
+                return Status::OK();
+            }
+        }
+    }
+    return Status::OK();
+}
+
 StatusOr<bool> GroupReader::_filter_chunk_with_dict_filter(ChunkPtr* chunk, Filter* filter) {
     if (_dict_column_indices.size() == 0) {
         return false;
@@ -14,10 +14,20 @@
 
 #include "formats/parquet/scalar_column_reader.h"
 
+#include <algorithm>
+
+#include "column/chunk.h"
+#include "exec/exec_node.h"
+#include "exprs/expr.h"
+#include "exprs/expr_context.h"
+#include "formats/parquet/bloom_filter.h"
 #include "formats/parquet/stored_column_reader_with_index.h"
+#include "fs/fs.h"
 #include "gutil/casts.h"
 #include "io/shared_buffered_input_stream.h"
+#include "runtime/time_types.h"
 #include "simd/simd.h"
+#include "types/date_value.h"
 #include "utils.h"
 
 namespace starrocks::parquet {
@@ -74,6 +84,142 @@ bool ScalarColumnReader::try_to_use_dict_filter(ExprContext* ctx, bool is_decode
     }
 }
 
+Status ScalarColumnReader::filter_group_with_dict(const std::vector<ExprContext*>& ctxs, const SlotId slot_id,
+                                                  bool* is_group_filtered) {
+    // string column is handled by dict filter context, which also rewrites conjuncts to dict code predicates.
+    if (_dict_filter_ctx != nullptr || _col_type->is_string_type() || !_column_all_pages_dict_encoded()) {
+        return Status::OK();
+    }
+
+    ColumnPtr dict_value_column = ColumnHelper::create_column(*_col_type, true);
+    ColumnPtr src_column = _converter->need_convert ? _converter->create_src_column() : dict_value_column;
+    auto st = _reader->get_dict_values(src_column.get());
+    if (st.is_not_supported()) {
+        return Status::OK();
+    }
+    RETURN_IF_ERROR(st);
+    if (_converter->need_convert) {
+        RETURN_IF_ERROR(_converter->convert(src_column, dict_value_column.get()));
+    }
+    // append a null value to check if null is ok or not.
+    dict_value_column->append_default();
+
+    ChunkPtr dict_value_chunk = std::make_shared<Chunk>();
+    dict_value_chunk->append_column(dict_value_column, slot_id);
+    Filter filter(dict_value_column->size(), 1);
+    ASSIGN_OR_RETURN(size_t dict_values_after_filter,
+                     ExecNode::eval_conjuncts_into_filter(ctxs, dict_value_chunk.get(), &filter));
+    if (dict_values_after_filter == 0) {
+        *is_group_filtered = true;
+    }
+    return Status::OK();
+}
+
+Status ScalarColumnReader::filter_group_with_bloom_filter(const std::vector<ExprContext*>& ctxs,
+                                                          bool* is_group_filtered) {
+    const tparquet::ColumnMetaData& column_metadata = _chunk_metadata->meta_data;
+    // dictionary is exact, no need to probe bloom filter if all pages are dict encoded.
+    if (!column_metadata.__isset.bloom_filter_offset || _column_all_pages_dict_encoded()) {
+        return Status::OK();
+    }
+
+    std::vector<std::vector<uint64_t>> hashes_of_conjuncts;
+    for (ExprContext* ctx : ctxs) {
+        std::vector<uint64_t> hashes;
+        if (_collect_bloom_filter_hashes(ctx->root(), &hashes)) {
+            hashes_of_conjuncts.emplace_back(std::move(hashes));
+        }
+    }
+    if (hashes_of_conjuncts.empty()) {
+        return Status::OK();
+    }
+
+    io::SeekableInputStream* stream = _opts.sb_stream;
+    if (stream == nullptr) {
+        stream = _opts.file->stream().get();
+    }
+    ParquetBloomFilter bloom_filter;
+    auto st = bloom_filter.read(stream, column_metadata.bloom_filter_offset);
+    if (st.is_not_supported()) {
+        return Status::OK();
+    }
+    RETURN_IF_ERROR(st);
+    for (const auto& hashes : hashes_of_conjuncts) {
+        if (std::none_of(hashes.begin(), hashes.end(),
+                         [&bloom_filter](uint64_t hash) { return bloom_filter.test_hash(hash); })) {
+            *is_group_filtered = true;
+            return Status::OK();
+        }
+    }
+    return Status::OK();
+}
+
+bool ScalarColumnReader::_collect_bloom_filter_hashes(const Expr* expr, std::vector<uint64_t>* hashes) const {
+    bool is_eq = expr->node_type() == TExprNodeType::BINARY_PRED && expr->op() == TExprOpcode::EQ;
+    bool is_in = expr->node_type() == TExprNodeType::IN_PRED && expr->op() == TExprOpcode::FILTER_IN;
+    if ((!is_eq && !is_in) || expr->get_num_children() < 2 || !expr->get_child(0)->is_slotref()) {
+        return false;
+    }
+
+    const LogicalType ltype = _col_type->type;
+    const tparquet::Type::type physical_type = _field->physical_type;
+    // only types whose plain encoding can be built from the literal directly.
+    bool supported = ((ltype == TYPE_INT || ltype == TYPE_DATE) && physical_type == tparquet::Type::INT32) ||
+                     (ltype == TYPE_BIGINT && physical_type == tparquet::Type::INT64) ||
+                     ((ltype == TYPE_VARCHAR || ltype == TYPE_VARBINARY) &&
+                      physical_type == tparquet::Type::BYTE_ARRAY);
+    if (!supported) {
+        return false;
+    }
+
+    for (int i = 1; i < expr->get_num_children(); i++) {
+        Expr* child = expr->get_child(i);
+        // null never equals to any value.
+        if (child->node_type() == TExprNodeType::NULL_LITERAL) {
+            continue;
+        }
+        if (child->node_type() != TExprNodeType::INT_LITERAL && child->node_type() != TExprNodeType::DATE_LITERAL &&
+            child->node_type() != TExprNodeType::STRING_LITERAL) {
+            return false;
+        }
+        if (child->type().type != ltype) {
+            return false;
+        }
+        auto res = child->evaluate_checked(nullptr, nullptr);
+        if (!res.ok()) {
+            return false;
+        }
+        const ColumnPtr& literal = res.value();
+        if (literal->only_null()) {
+            continue;
+        }
+        const Datum datum = literal->get(0);
+        switch (ltype) {
+        case TYPE_INT: {
+            int32_t value = datum.get_int32();
+            hashes->emplace_back(ParquetBloomFilter::hash(&value, sizeof(value)));
+            break;
+        }
+        case TYPE_DATE: {
+            int32_t value = datum.get_date().julian() - date::UNIX_EPOCH_JULIAN;
+            hashes->emplace_back(ParquetBloomFilter::hash(&value, sizeof(value)));
+            break;
+        }
+        case TYPE_BIGINT: {
+            int64_t value = datum.get_int64();
+            hashes->emplace_back(ParquetBloomFilter::hash(&value, sizeof(value)));
+            break;
+        }
+        default: {
+            const Slice& value = datum.get_slice();
+            hashes->emplace_back(ParquetBloomFilter::hash(value.data, value.size));
+            break;
+        }
+        }
+    }
+    return true;
+}
+
 Status ScalarColumnReader::fill_dst_column(ColumnPtr& dst, const ColumnPtr& src) {
     if (!_need_lazy_decode) {
         dst->swap_column(*src);
@@ -53,6 +53,11 @@ public:
         return _dict_filter_ctx->rewrite_conjunct_ctxs_to_predicate(_reader.get(), is_group_filtered);
     }
 
+    Status filter_group_with_dict(const std::vector<ExprContext*>& ctxs, const SlotId slot_id,
+                                  bool* is_group_filtered) override;
+
+    Status filter_group_with_bloom_filter(const std::vector<ExprContext*>& ctxs, bool* is_group_filtered) override;
+
     void set_can_lazy_decode(bool can_lazy_decode) override {
         _can_lazy_decode = can_lazy_decode && _col_type->is_string_type() && _column_all_pages_dict_encoded();
     }
@@ -60,7 +65,8 @@ public:
     Status filter_dict_column(const ColumnPtr& column, Filter* filter, const std::vector<std::string>& sub_field_path,
                               const size_t& layer) override {
         DCHECK_EQ(sub_field_path.size(), layer);
-        return _dict_filter_ctx->predicate->evaluate_and(column.get(), filter->data());
+        _dict_filter_ctx->evaluate_and(column.get(), filter->data());
+        return Status::OK();
     }
 
     Status fill_dst_column(ColumnPtr& dst, const ColumnPtr& src) override;
@@ -95,6 +101,9 @@ private:
     // Returns true if all of the data pages in the column chunk are dict encoded
     bool _column_all_pages_dict_encoded();
 
+    // Collect hashes of plain encoded literals if `expr` is `slot = literal` or `slot in (literals)`.
+    bool _collect_bloom_filter_hashes(const Expr* expr, std::vector<uint64_t>* hashes) const;
+
     const ColumnReaderOptions& _opts;
 
     std::unique_ptr<StoredColumnReader> _reader;
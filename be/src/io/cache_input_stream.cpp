@@ -257,6 +257,9 @@ Status CacheInputStream::_populate_to_cache(const int64_t offset, const int64_t
             _stats.write_cache_bytes += write_size;
             _stats.write_mem_cache_bytes += options.stats.write_mem_bytes;
             _stats.write_disk_cache_bytes += options.stats.write_disk_bytes;
+        } else if (r.is_cancelled()) {
+            _stats.skip_write_cache_count += 1;
+            _stats.skip_write_cache_bytes += write_size;
         } else if (!r.is_already_exist() && !r.is_resource_busy()) {
             _stats.write_cache_fail_count += 1;
             _stats.write_cache_fail_bytes += write_size;
@@ -0,0 +1,88 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "io/io_latency_model.h"
+
+#include <algorithm>
+#include <memory>
+#include <unordered_map>
+
+namespace starrocks::io {
+
+IOLatencyModel* IOLatencyModel::get(const std::string& name) {
+    static std::mutex mutex;
+    static std::unordered_map<std::string, std::unique_ptr<IOLatencyModel>> models;
+    std::lock_guard l(mutex);
+    auto& model = models[name];
+    if (model == nullptr) {
+        model = std::make_unique<IOLatencyModel>();
+    }
+    return model.get();
+}
+
+void IOLatencyModel::update(int64_t bytes, int64_t elapsed_ns) {
+    if (bytes <= 0 || elapsed_ns <= 0) {
+        return;
+    }
+    auto x = static_cast<double>(bytes);
+    auto y = static_cast<double>(elapsed_ns);
+    std::lock_guard l(_mutex);
+    _sw = _sw * DECAY + 1;
+    _sx = _sx * DECAY + x;
+    _sy = _sy * DECAY + y;
+    _sxx = _sxx * DECAY + x * x;
+    _sxy = _sxy * DECAY + x * y;
+    _num_samples++;
+}
+
+bool IOLatencyModel::estimate(double* latency_ns, double* bytes_per_ns) const {
+    std::lock_guard l(_mutex);
+    if (_num_samples < MIN_SAMPLES) {
+        return false;
+    }
+    // least squares of y = latency + x * slope
+    double var = _sw * _sxx - _sx * _sx;
+    // all the reads are of the same size, the latency and bandwidth can't be told apart.
+    if (var <= 1e-6 * _sw * _sxx) {
+        return false;
+    }
+    double slope = (_sw * _sxy - _sx * _sy) / var;
+    double latency = (_sy - slope * _sx) / _sw;
+    if (slope <= 0 || latency <= 0) {
+        return false;
+    }
+    *latency_ns = latency;
+    *bytes_per_ns = 1 / slope;
+    return true;
+}
+
+int64_t IOLatencyModel::coalesce_distance(int64_t default_size, int64_t min_size, int64_t max_size) const {
+    double latency_ns = 0;
+    double bytes_per_ns = 0;
+    if (!estimate(&latency_ns, &bytes_per_ns)) {
+        return default_size;
+    }
+    double distance = latency_ns * bytes_per_ns;
+    if (distance >= static_cast<double>(max_size)) {
+        return std::max(min_size, max_size);
+    }
+    return std::max(min_size, static_cast<int64_t>(distance));
+}
+
+int64_t IOLatencyModel::num_samples() const {
+    std::lock_guard l(_mutex);
+    return _num_samples;
+}
+
+} // namespace starrocks::io
@@ -0,0 +1,63 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+namespace starrocks::io {
+
+// IOLatencyModel learns the cost of remote reads of one kind of storage (e.g. s3, hdfs), which is modeled as
+// `elapsed = latency + bytes / bandwidth`, by a linear regression over the recent reads.
+//
+// It's used to choose how far two io ranges could be coalesced: reading the gap between them costs less than
+// issuing another request as long as the gap is smaller than `latency * bandwidth`.
+class IOLatencyModel {
+public:
+    // Number of reads needed before the model is trusted.
+    static constexpr int64_t MIN_SAMPLES = 32;
+    // Weight of the old reads is decayed by this factor for each new read.
+    static constexpr double DECAY = 0.98;
+
+    IOLatencyModel() = default;
+
+    // Get the shared model of storage `name`, which is created on first use.
+    static IOLatencyModel* get(const std::string& name);
+
+    void update(int64_t bytes, int64_t elapsed_ns);
+
+    // Estimated latency of one request in nanoseconds and bandwidth in bytes per nanosecond.
+    // Return false if there are not enough reads or the reads can not be fitted by the model.
+    bool estimate(double* latency_ns, double* bytes_per_ns) const;
+
+    // Bytes that can be transferred during the latency of one request, clamped into [min_size, max_size].
+    // Return `default_size` if the model can't be estimated yet.
+    int64_t coalesce_distance(int64_t default_size, int64_t min_size, int64_t max_size) const;
+
+    int64_t num_samples() const;
+
+private:
+    mutable std::mutex _mutex;
+    int64_t _num_samples = 0;
+    // decayed sums of weight, x, y, x*x and x*y, where x is bytes and y is elapsed time.
+    double _sw = 0;
+    double _sx = 0;
+    double _sy = 0;
+    double _sxx = 0;
+    double _sxy = 0;
+};
+
+} // namespace starrocks::io
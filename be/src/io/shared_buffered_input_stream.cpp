@@ -18,6 +18,7 @@
 
 #include "common/config.h"
 #include "gutil/strings/fastmem.h"
+#include "io/io_latency_model.h"
 #include "runtime/current_thread.h"
 #include "util/runtime_profile.h"
 
@@ -217,7 +218,7 @@ Status SharedBufferedInputStream::get_bytes(const uint8_t** buffer, size_t offse
     SharedBuffer& sb = *shared_buffer;
     if (sb.buffer.capacity() == 0) {
         RETURN_IF_ERROR(CurrentThread::mem_tracker()->check_mem_limit("read into shared buffer"));
-        SCOPED_RAW_TIMER(&_shared_io_timer);
+        int64_t io_ns = 0;
         _shared_io_count += 1;
         _shared_io_bytes += sb.size;
         if (sb.size > sb.raw_size) {
@@ -226,7 +227,14 @@ Status SharedBufferedInputStream::get_bytes(const uint8_t** buffer, size_t offse
             _shared_align_io_bytes += sb.size - sb.raw_size;
         }
         sb.buffer.reserve(sb.size);
-        RETURN_IF_ERROR(_stream->read_at_fully(sb.offset, sb.buffer.data(), sb.size));
+        {
+            SCOPED_RAW_TIMER(&io_ns);
+            RETURN_IF_ERROR(_stream->read_at_fully(sb.offset, sb.buffer.data(), sb.size));
+        }
+        _shared_io_timer += io_ns;
+        if (_latency_model != nullptr) {
+            _latency_model->update(sb.size, io_ns);
+        }
     }
     *buffer = sb.buffer.data() + offset - sb.offset;
     return Status::OK();
@@ -244,10 +252,17 @@ void SharedBufferedInputStream::release_to_offset(int64_t offset) {
 Status SharedBufferedInputStream::read_at_fully(int64_t offset, void* out, int64_t count) {
     auto st = find_shared_buffer(offset, count);
     if (!st.ok()) {
-        SCOPED_RAW_TIMER(&_direct_io_timer);
+        int64_t io_ns = 0;
         _direct_io_count += 1;
         _direct_io_bytes += count;
-        RETURN_IF_ERROR(_stream->read_at_fully(offset, out, count));
+        {
+            SCOPED_RAW_TIMER(&io_ns);
+            RETURN_IF_ERROR(_stream->read_at_fully(offset, out, count));
+        }
+        _direct_io_timer += io_ns;
+        if (_latency_model != nullptr) {
+            _latency_model->update(count, io_ns);
+        }
         return Status::OK();
     }
     const uint8_t* buffer = nullptr;
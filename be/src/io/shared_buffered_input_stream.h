@@ -23,6 +23,8 @@
 
 namespace starrocks::io {
 
+class IOLatencyModel;
+
 class SharedBufferedInputStream : public SeekableInputStream {
 public:
     struct IORange {
@@ -82,6 +84,8 @@ public:
     void release();
     void set_coalesce_options(const CoalesceOptions& options) { _options = options; }
     void set_align_size(int64_t size) { _align_size = size; }
+    // The elapsed time of reads from the underlying stream is reported to `model`.
+    void set_latency_model(IOLatencyModel* model) { _latency_model = model; }
 
     int64_t shared_io_count() const { return _shared_io_count; }
     int64_t shared_io_bytes() const { return _shared_io_bytes; }
@@ -118,6 +122,7 @@ private:
     int64_t _direct_io_timer = 0;
     int64_t _align_size = 0;
     int64_t _estimated_mem_usage = 0;
+    IOLatencyModel* _latency_model = nullptr;
 };
 
 } // namespace starrocks::io
@@ -40,6 +40,7 @@
 #include "agent/agent_server.h"
 #include "agent/master_info.h"
 #include "block_cache/block_cache.h"
+#include "column/column_buffer_pool.h"
 #include "column/column_pool.h"
 #include "common/config.h"
 #include "common/configbase.h"
@@ -227,6 +228,7 @@ Status GlobalEnv::_init_mem_tracker() {
     _compaction_mem_tracker = regist_tracker(compaction_mem_limit, "compaction", _process_mem_tracker.get());
     _schema_change_mem_tracker = regist_tracker(-1, "schema_change", _process_mem_tracker.get());
     _column_pool_mem_tracker = regist_tracker(-1, "column_pool", _process_mem_tracker.get());
+    _column_buffer_pool_mem_tracker = regist_tracker(-1, "column_buffer_pool", _process_mem_tracker.get());
     _page_cache_mem_tracker = regist_tracker(-1, "page_cache", _process_mem_tracker.get());
     _jit_cache_mem_tracker = regist_tracker(-1, "jit_cache", _process_mem_tracker.get());
     int32_t update_mem_percent = std::max(std::min(100, config::update_memory_limit_percent), 0);
@@ -242,6 +244,7 @@ Status GlobalEnv::_init_mem_tracker() {
 
     SetMemTrackerForColumnPool op(_column_pool_mem_tracker);
     ForEach<ColumnPoolList>(op);
+    ColumnBufferPool::instance()->set_mem_tracker(_column_buffer_pool_mem_tracker);
     _init_storage_page_cache(); // TODO: move to StorageEngine
     return Status::OK();
 }
@@ -0,0 +1,129 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "runtime/memory/mem_arena.h"
+
+#include <sys/mman.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <new>
+
+#include "common/logging.h"
+
+namespace starrocks {
+
+MemArena::MemArena(size_t chunk_size, bool use_huge_pages)
+        : _chunk_size(std::max(_round_size(chunk_size), MIN_ALIGNMENT * 4)), _use_huge_pages(use_huge_pages) {}
+
+MemArena::~MemArena() {
+    DCHECK_EQ(0, _allocated_bytes);
+    for (void* chunk : _chunks) {
+        ::free(chunk);
+    }
+}
+
+void* MemArena::allocate(size_t size, size_t alignment) {
+    if (size == 0) {
+        size = 1;
+    }
+    if (_is_large(size, alignment)) {
+        void* ptr = _allocate_large(size, alignment);
+        std::lock_guard<std::mutex> l(_mutex);
+        _reserved_bytes += size;
+        _allocated_bytes += size;
+        return ptr;
+    }
+
+    size = _round_size(size);
+    std::lock_guard<std::mutex> l(_mutex);
+    void* ptr = nullptr;
+    auto it = _free_blocks.find(size);
+    if (it != _free_blocks.end() && !it->second.empty()) {
+        ptr = it->second.back();
+        it->second.pop_back();
+    } else {
+        ptr = _allocate_from_chunk_locked(size);
+    }
+    _allocated_bytes += size;
+    return ptr;
+}
+
+void MemArena::deallocate(void* ptr, size_t size, size_t alignment) {
+    if (ptr == nullptr) {
+        return;
+    }
+    if (size == 0) {
+        size = 1;
+    }
+    if (_is_large(size, alignment)) {
+        _free_large(ptr);
+        std::lock_guard<std::mutex> l(_mutex);
+        _reserved_bytes -= size;
+        _allocated_bytes -= size;
+        return;
+    }
+
+    size = _round_size(size);
+    std::lock_guard<std::mutex> l(_mutex);
+    _free_blocks[size].push_back(ptr);
+    _allocated_bytes -= size;
+}
+
+size_t MemArena::total_reserved_bytes() const {
+    std::lock_guard<std::mutex> l(_mutex);
+    return _reserved_bytes;
+}
+
+size_t MemArena::total_allocated_bytes() const {
+    std::lock_guard<std::mutex> l(_mutex);
+    return _allocated_bytes;
+}
+
+void* MemArena::_allocate_large(size_t size, size_t alignment) {
+    bool huge = _use_huge_pages && size >= HUGE_PAGE_SIZE;
+    if (huge) {
+        alignment = std::max(alignment, HUGE_PAGE_SIZE);
+    }
+    alignment = std::max(alignment, sizeof(void*));
+    void* ptr = nullptr;
+    if (posix_memalign(&ptr, alignment, size) != 0) {
+        throw std::bad_alloc();
+    }
+    if (huge) {
+        // only an advice, the kernel may not back it by huge pages.
+        (void)madvise(ptr, size, MADV_HUGEPAGE);
+    }
+    return ptr;
+}
+
+void MemArena::_free_large(void* ptr) {
+    ::free(ptr);
+}
+
+void* MemArena::_allocate_from_chunk_locked(size_t size) {
+    if (size > static_cast<size_t>(_chunk_end - _chunk_pos)) {
+        // the rest of the current chunk is wasted, it's less than a quarter of the chunk.
+        void* chunk = _allocate_large(_chunk_size, MIN_ALIGNMENT);
+        _chunks.push_back(chunk);
+        _reserved_bytes += _chunk_size;
+        _chunk_pos = static_cast<uint8_t*>(chunk);
+        _chunk_end = _chunk_pos + _chunk_size;
+    }
+    void* ptr = _chunk_pos;
+    _chunk_pos += size;
+    return ptr;
+}
+
+} // namespace starrocks
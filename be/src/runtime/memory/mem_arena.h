@@ -0,0 +1,148 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace starrocks {
+
+// An arena shared by the hash tables of a fragment instance, all memory of it is released at once when the
+// last owner goes away.
+//
+// Small blocks are carved from big chunks, which are aligned and advised to be backed by transparent huge
+// pages, and a deallocated small block is kept to be reused by the next allocation of the same size. Hash
+// tables grow by the same sequence of sizes, so the buckets released by a rehash are reused by the other hash
+// tables of the same type, e.g. the sub maps of a two level hash map or the hash maps of other drivers.
+// Blocks not smaller than a quarter of the chunk are allocated and freed individually, so the old buckets of
+// a huge hash table don't stay until the teardown.
+//
+// It's thread safe, hash tables only allocate from it when they grow, so a mutex is cheap enough.
+class MemArena {
+public:
+    static constexpr size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+    static constexpr size_t MIN_ALIGNMENT = 16;
+
+    MemArena(size_t chunk_size, bool use_huge_pages);
+    ~MemArena();
+
+    MemArena(const MemArena&) = delete;
+    MemArena& operator=(const MemArena&) = delete;
+
+    // Throw std::bad_alloc if out of memory, as the allocators of STL containers do.
+    void* allocate(size_t size, size_t alignment = MIN_ALIGNMENT);
+    void deallocate(void* ptr, size_t size, size_t alignment = MIN_ALIGNMENT);
+
+    // Bytes held by the arena, including the free blocks waiting to be reused.
+    size_t total_reserved_bytes() const;
+    // Bytes allocated and not deallocated.
+    size_t total_allocated_bytes() const;
+
+private:
+    bool _is_large(size_t size, size_t alignment) const {
+        return size >= _chunk_size / 4 || alignment > MIN_ALIGNMENT;
+    }
+    static size_t _round_size(size_t size) { return (size + MIN_ALIGNMENT - 1) & ~(MIN_ALIGNMENT - 1); }
+
+    void* _allocate_large(size_t size, size_t alignment);
+    void _free_large(void* ptr);
+    void* _allocate_from_chunk_locked(size_t size);
+
+    const size_t _chunk_size;
+    const bool _use_huge_pages;
+
+    mutable std::mutex _mutex;
+    std::vector<void*> _chunks;
+    uint8_t* _chunk_pos = nullptr;
+    uint8_t* _chunk_end = nullptr;
+    // rounded size -> deallocated small blocks of that size
+    std::unordered_map<size_t, std::vector<void*>> _free_blocks;
+    size_t _reserved_bytes = 0;
+    size_t _allocated_bytes = 0;
+};
+
+// STL allocator allocating from a MemArena, or from the global allocator if there is no arena, so containers
+// using it work the same way when the arena is disabled. The arena is kept alive by the allocators.
+template <class T>
+class ArenaAllocator {
+public:
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+    ArenaAllocator() = default;
+    explicit ArenaAllocator(std::shared_ptr<MemArena> arena) : _arena(std::move(arena)) {}
+    template <class U>
+    ArenaAllocator(const ArenaAllocator<U>& other) : _arena(other.arena()) {}
+
+    T* allocate(size_t n) {
+        if (_arena == nullptr) {
+            return std::allocator<T>().allocate(n);
+        }
+        return static_cast<T*>(_arena->allocate(n * sizeof(T), std::max(alignof(T), MemArena::MIN_ALIGNMENT)));
+    }
+
+    void deallocate(T* ptr, size_t n) {
+        if (_arena == nullptr) {
+            std::allocator<T>().deallocate(ptr, n);
+            return;
+        }
+        _arena->deallocate(ptr, n * sizeof(T), std::max(alignof(T), MemArena::MIN_ALIGNMENT));
+    }
+
+    const std::shared_ptr<MemArena>& arena() const { return _arena; }
+
+    template <class U>
+    bool operator==(const ArenaAllocator<U>& rhs) const {
+        return _arena == rhs.arena();
+    }
+    template <class U>
+    bool operator!=(const ArenaAllocator<U>& rhs) const {
+        return _arena != rhs.arena();
+    }
+
+private:
+    std::shared_ptr<MemArena> _arena;
+};
+
+template <class T>
+using ArenaBuffer = std::vector<T, ArenaAllocator<T>>;
+
+template <class Container, class = void>
+struct IsArenaAllocated : std::false_type {};
+
+template <class Container>
+struct IsArenaAllocated<Container, std::void_t<typename Container::allocator_type>>
+        : std::is_same<typename Container::allocator_type,
+                       ArenaAllocator<typename Container::allocator_type::value_type>> {};
+
+// Make an empty container allocate from `arena`, containers not using ArenaAllocator are not changed.
+template <class Container>
+void use_arena(Container* container, const std::shared_ptr<MemArena>& arena) {
+    if constexpr (IsArenaAllocated<Container>::value) {
+        if (arena != nullptr) {
+            *container = Container(typename Container::allocator_type(arena));
+        }
+    }
+}
+
+} // namespace starrocks
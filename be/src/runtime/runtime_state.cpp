@@ -41,6 +41,7 @@
 #include <string>
 #include <utility>
 
+#include "common/config.h"
 #include "common/logging.h"
 #include "common/object_pool.h"
 #include "common/status.h"
@@ -56,6 +57,7 @@
 #include "runtime/exec_env.h"
 #include "runtime/load_path_mgr.h"
 #include "runtime/mem_tracker.h"
+#include "runtime/memory/mem_arena.h"
 #include "runtime/query_statistics.h"
 #include "runtime/runtime_filter_worker.h"
 #include "util/pretty_printer.h"
@@ -231,6 +233,18 @@ void RuntimeState::init_instance_mem_tracker() {
     _instance_mem_pool = std::make_unique<MemPool>();
 }
 
+std::shared_ptr<MemArena> RuntimeState::instance_arena() {
+    if (!config::enable_hash_table_arena) {
+        return nullptr;
+    }
+    // hash tables of different drivers are created concurrently.
+    std::call_once(_instance_arena_once, [this]() {
+        _instance_arena = std::make_shared<MemArena>(config::hash_table_arena_chunk_size,
+                                                     config::hash_table_arena_huge_pages);
+    });
+    return _instance_arena;
+}
+
 ObjectPool* RuntimeState::global_obj_pool() const {
     if (_query_ctx == nullptr) {
         return obj_pool();
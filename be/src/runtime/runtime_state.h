@@ -37,6 +37,7 @@
 #include <atomic>
 #include <fstream>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <string_view>
 #include <unordered_map>
@@ -68,6 +69,7 @@ class ExecEnv;
 class Expr;
 class DateTimeValue;
 class MemTracker;
+class MemArena;
 class DataStreamRecvr;
 class ResultBufferMgr;
 class LoadErrorHub;
@@ -140,6 +142,8 @@ public:
     ExecEnv* exec_env() { return _exec_env; }
     MemTracker* instance_mem_tracker() { return _instance_mem_tracker.get(); }
     MemPool* instance_mem_pool() { return _instance_mem_pool.get(); }
+    // Arena of the hash tables of this fragment instance, nullptr if disabled by enable_hash_table_arena.
+    std::shared_ptr<MemArena> instance_arena();
     std::shared_ptr<MemTracker> query_mem_tracker_ptr() { return _query_mem_tracker; }
     void set_query_mem_tracker(const std::shared_ptr<MemTracker>& query_mem_tracker) {
         _query_mem_tracker = query_mem_tracker;
@@ -479,10 +483,26 @@ public:
     // logical -> 32
     // div -> 64
     // mod -> 128
+    // hash key -> 256
     bool can_jit_expr(const int jit_label) {
         return (_query_options.jit_level == 1) || ((_query_options.jit_level & jit_label));
     }
 
+    // Occurrences of the common subexpressions in the expression trees of this fragment instance, identified by
+    // fingerprints, the ones occurring more than once are evaluated once per chunk, see CachedExpr.
+    void add_common_expr(const std::string& fingerprint) {
+        std::lock_guard<std::mutex> l(_common_exprs_lock);
+        _common_expr_counts[fingerprint]++;
+        _common_exprs_version.fetch_add(1, std::memory_order_release);
+    }
+    // Changed whenever an occurrence is added, e.g. by the rewrites of the scan conjuncts at runtime.
+    int64_t common_exprs_version() const { return _common_exprs_version.load(std::memory_order_acquire); }
+    int common_expr_count(const std::string& fingerprint) {
+        std::lock_guard<std::mutex> l(_common_exprs_lock);
+        auto it = _common_expr_counts.find(fingerprint);
+        return it == _common_expr_counts.end() ? 0 : it->second;
+    }
+
     std::string_view get_sql_dialect() const { return _query_options.sql_dialect; }
 
     void set_shuffle_hash_bucket_rf_ids(std::unordered_set<int32_t>&& filter_ids) {
@@ -570,6 +590,8 @@ private:
     std::mutex _process_status_lock;
     Status _process_status;
     std::unique_ptr<MemPool> _instance_mem_pool;
+    std::once_flag _instance_arena_once;
+    std::shared_ptr<MemArena> _instance_arena;
 
     // This is the node id of the root node for this plan fragment. This is used as the
     // hash seed and has two useful properties:
@@ -624,6 +646,10 @@ private:
     std::mutex _sink_commit_infos_lock;
     std::vector<TSinkCommitInfo> _sink_commit_infos;
 
+    std::mutex _common_exprs_lock;
+    std::unordered_map<std::string, int> _common_expr_counts;
+    std::atomic<int64_t> _common_exprs_version{0};
+
     // prohibit copies
     RuntimeState(const RuntimeState&) = delete;
 
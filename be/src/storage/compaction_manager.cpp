@@ -14,7 +14,9 @@
 
 #include "storage/compaction_manager.h"
 
+#include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <thread>
 
 #include "storage/data_dir.h"
@@ -25,7 +27,15 @@ using namespace std::chrono_literals;
 
 namespace starrocks {
 
-CompactionManager::CompactionManager() : _next_task_id(0) {}
+CompactionManager::CompactionManager() : _next_task_id(0) {
+    // threads are created on demand
+    auto st = ThreadPoolBuilder("compact_col_grp")
+                      .set_min_threads(0)
+                      .set_max_threads(std::max(1, config::vertical_compaction_column_group_thread_num))
+                      .set_max_queue_size(1000)
+                      .build(&_column_group_pool);
+    DCHECK(st.ok());
+}
 
 void CompactionManager::stop() {
     _stop.store(true, std::memory_order_release);
@@ -41,6 +51,9 @@ void CompactionManager::stop() {
     if (_update_candidate_pool) {
         _update_candidate_pool->shutdown();
     }
+    if (_column_group_pool) {
+        _column_group_pool->shutdown();
+    }
 }
 
 void CompactionManager::schedule() {
@@ -275,23 +288,51 @@ bool CompactionManager::pick_candidate(CompactionCandidate* candidate) {
         return false;
     }
 
+    auto iter = config::compaction_read_amplification_weight > 0 ? _find_candidate_by_read_amplification()
+                                                                  : _find_candidate();
+    if (iter == _compaction_candidates.end()) {
+        return false;
+    }
+    *candidate = *iter;
+    _compaction_candidates.erase(iter);
+    _last_score = candidate->score;
+    if (candidate->type == CompactionType::BASE_COMPACTION) {
+        StarRocksMetrics::instance()->wait_base_compaction_task_num.increment(-1);
+    } else {
+        StarRocksMetrics::instance()->wait_cumulative_compaction_task_num.increment(-1);
+    }
+    return true;
+}
+
+CompactionManager::CandidateSet::iterator CompactionManager::_find_candidate() {
     auto iter = _compaction_candidates.begin();
     while (iter != _compaction_candidates.end()) {
         if (_check_precondition(*iter)) {
-            *candidate = *iter;
-            _compaction_candidates.erase(iter);
-            _last_score = candidate->score;
-            if (candidate->type == CompactionType::BASE_COMPACTION) {
-                StarRocksMetrics::instance()->wait_base_compaction_task_num.increment(-1);
-            } else {
-                StarRocksMetrics::instance()->wait_cumulative_compaction_task_num.increment(-1);
-            }
-            return true;
+            return iter;
         }
         iter++;
     }
+    return _compaction_candidates.end();
+}
 
-    return false;
+// Read amplification of a tablet changes as queries come and go, so the boost is applied when picking
+// instead of when the candidate is queued. The boosted score only decides the order, candidates keep
+// their policy scores, which are reported by metrics.
+CompactionManager::CandidateSet::iterator CompactionManager::_find_candidate_by_read_amplification() {
+    std::vector<std::pair<double, CandidateSet::iterator>> boosted_candidates;
+    boosted_candidates.reserve(_compaction_candidates.size());
+    for (auto iter = _compaction_candidates.begin(); iter != _compaction_candidates.end(); iter++) {
+        boosted_candidates.emplace_back(_adjust_score_by_read_amplification(*iter->tablet, iter->score), iter);
+    }
+    // keep the order of policy scores for equal boosted scores
+    std::stable_sort(boosted_candidates.begin(), boosted_candidates.end(),
+                     [](const auto& lhs, const auto& rhs) { return lhs.first > rhs.first; });
+    for (auto& [score, iter] : boosted_candidates) {
+        if (_check_precondition(*iter)) {
+            return iter;
+        }
+    }
+    return _compaction_candidates.end();
 }
 
 void CompactionManager::_dispatch_worker() {
@@ -333,6 +374,22 @@ void CompactionManager::update_tablet_async(const TabletSharedPtr& tablet) {
     }
 }
 
+// Compaction of a tablet costs the same I/O no matter how often it's read, but the benefit is
+// proportional to how many segments the queries on it have to merge. Boost the score of hot tablets
+// so that they are picked first, cold tablets keep their original score and are naturally deferred.
+double CompactionManager::_adjust_score_by_read_amplification(const Tablet& tablet, double score) {
+    double weight = config::compaction_read_amplification_weight;
+    if (weight <= 0) {
+        return score;
+    }
+    double read_amp = tablet.read_amplification();
+    if (read_amp <= 1) {
+        // no recent query or queries read a single segment, compaction can't reduce the read cost
+        return score;
+    }
+    return score * (1 + weight * std::log2(1 + read_amp));
+}
+
 void CompactionManager::update_tablet(const TabletSharedPtr& tablet) {
     if (tablet == nullptr) {
         return;
@@ -42,6 +42,9 @@ public:
 
     void stop();
 
+    // Shared by vertical compaction tasks to merge column groups concurrently.
+    ThreadPool* column_group_pool() { return _column_group_pool.get(); }
+
     void init_max_task_num(int32_t num);
 
     size_t candidates_size() {
@@ -134,8 +137,14 @@ private:
     CompactionManager& operator=(const CompactionManager& compaction_manager) = delete;
     CompactionManager& operator=(CompactionManager&& compaction_manager) = delete;
 
+    using CandidateSet = std::set<CompactionCandidate, CompactionCandidateComparator>;
+
     void _dispatch_worker();
     bool _check_precondition(const CompactionCandidate& candidate);
+    static double _adjust_score_by_read_amplification(const Tablet& tablet, double score);
+    // find the first candidate passing the precondition, by policy score or boosted score
+    CandidateSet::iterator _find_candidate();
+    CandidateSet::iterator _find_candidate_by_read_amplification();
     void _schedule();
     void _notify();
     // wait until current running tasks are below max_concurrent_num
@@ -145,7 +154,7 @@ private:
 
     std::mutex _candidates_mutex;
     // protect by _mutex
-    std::set<CompactionCandidate, CompactionCandidateComparator> _compaction_candidates;
+    CandidateSet _compaction_candidates;
 
     std::mutex _tasks_mutex;
     std::atomic<uint64_t> _next_task_id;
@@ -173,6 +182,7 @@ private:
     uint64_t _round = 0;
 
     std::unique_ptr<ThreadPool> _compaction_pool = nullptr;
+    std::unique_ptr<ThreadPool> _column_group_pool;
     std::thread _scheduler_thread;
 };
 
@@ -67,6 +67,9 @@ public:
 
     Status init(const PersistentIndexSstableMetaPB& sstable_meta);
 
+    // keys in sstables are not counted by the levels of PersistentIndex
+    bool empty() const override { return false; }
+
     // batch get
     // |n|: size of key/value array
     // |keys|: key array as raw buffer
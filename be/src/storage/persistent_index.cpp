@@ -59,6 +59,9 @@ constexpr size_t kPackSize = 16;
 constexpr size_t kBucketSizeMax = 256;
 constexpr size_t kFixedMaxKeySize = 128;
 constexpr size_t kBatchBloomFilterReadSize = 4ULL << 20;
+// How many keys ahead to prefetch when probing a batch of keys, an empirical value
+// same as AGG_HASH_MAP_DEFAULT_PREFETCH_DIST.
+constexpr size_t kProbePrefetchDist = 16;
 
 const char* const kIndexFileMagic = "IDX1";
 
@@ -776,10 +779,16 @@ public:
 
     Status get(const Slice* keys, IndexValue* values, KeysInfo* not_found, size_t* num_found,
                const std::vector<size_t>& idxes) const override {
+        std::vector<uint64_t> hashes;
+        _compute_hashes_and_prefetch(keys, idxes, &hashes);
         size_t nfound = 0;
-        for (const auto idx : idxes) {
+        for (size_t i = 0; i < idxes.size(); i++) {
+            if (i + kProbePrefetchDist < idxes.size()) {
+                _map.prefetch_hash(hashes[i + kProbePrefetchDist]);
+            }
+            const auto idx = idxes[i];
             const auto& key = *reinterpret_cast<const KeyType*>(keys[idx].data);
-            uint64_t hash = FixedKeyHash<KeySize>()(key);
+            uint64_t hash = hashes[i];
             auto iter = _map.find(key, hash);
             if (iter == _map.end()) {
                 values[idx] = NullIndexValue;
@@ -795,11 +804,17 @@ public:
 
     Status upsert(const Slice* keys, const IndexValue* values, IndexValue* old_values, KeysInfo* not_found,
                   size_t* num_found, const std::vector<size_t>& idxes) override {
+        std::vector<uint64_t> hashes;
+        _compute_hashes_and_prefetch(keys, idxes, &hashes);
         size_t nfound = 0;
-        for (const auto idx : idxes) {
+        for (size_t i = 0; i < idxes.size(); i++) {
+            if (i + kProbePrefetchDist < idxes.size()) {
+                _map.prefetch_hash(hashes[i + kProbePrefetchDist]);
+            }
+            const auto idx = idxes[i];
             const auto& key = *reinterpret_cast<const KeyType*>(keys[idx].data);
             const auto value = values[idx];
-            uint64_t hash = FixedKeyHash<KeySize>()(key);
+            uint64_t hash = hashes[i];
             if (auto [it, inserted] = _map.emplace_with_hash(hash, key, value); inserted) {
                 not_found->key_infos.emplace_back((uint32_t)idx, hash);
             } else {
@@ -815,11 +830,17 @@ public:
 
     Status upsert(const Slice* keys, const IndexValue* values, KeysInfo* not_found, size_t* num_found,
                   const std::vector<size_t>& idxes) override {
+        std::vector<uint64_t> hashes;
+        _compute_hashes_and_prefetch(keys, idxes, &hashes);
         size_t nfound = 0;
-        for (const auto idx : idxes) {
+        for (size_t i = 0; i < idxes.size(); i++) {
+            if (i + kProbePrefetchDist < idxes.size()) {
+                _map.prefetch_hash(hashes[i + kProbePrefetchDist]);
+            }
+            const auto idx = idxes[i];
             const auto& key = *reinterpret_cast<const KeyType*>(keys[idx].data);
             const auto value = values[idx];
-            uint64_t hash = FixedKeyHash<KeySize>()(key);
+            uint64_t hash = hashes[i];
             if (auto [it, inserted] = _map.emplace_with_hash(hash, key, value); inserted) {
                 not_found->key_infos.emplace_back((uint32_t)idx, hash);
             } else {
@@ -1009,6 +1030,21 @@ public:
     size_t memory_usage() override { return _map.capacity() * (1 + (KeySize + 3) / 4 * 4 + kIndexValueSize); }
 
 private:
+    // Hash the whole batch up front so that the probe loop can prefetch the slots of
+    // the following keys while the current one is being compared.
+    void _compute_hashes_and_prefetch(const Slice* keys, const std::vector<size_t>& idxes,
+                                      std::vector<uint64_t>* hashes) const {
+        hashes->resize(idxes.size());
+        for (size_t i = 0; i < idxes.size(); i++) {
+            const auto& key = *reinterpret_cast<const KeyType*>(keys[idxes[i]].data);
+            (*hashes)[i] = FixedKeyHash<KeySize>()(key);
+        }
+        const size_t nprefetch = std::min(kProbePrefetchDist, idxes.size());
+        for (size_t i = 0; i < nprefetch; i++) {
+            _map.prefetch_hash((*hashes)[i]);
+        }
+    }
+
     phmap::flat_hash_map<KeyType, IndexValue, FixedKeyHash<KeySize>> _map;
 };
 
@@ -2309,7 +2345,15 @@ Status ImmutableIndex::_get_in_fixlen_shard(size_t shard_idx, size_t n, const Sl
                                             std::unique_ptr<ImmutableIndexShard>* shard) const {
     const auto& shard_info = _shards[shard_idx];
     uint8_t candidate_idxes[kBucketSizeMax];
-    for (const auto& key_info : keys_info) {
+    for (size_t i = 0; i < keys_info.size(); i++) {
+        if (i + kProbePrefetchDist < keys_info.size()) {
+            // bring the tags of a following key's bucket into cache, the bucket header is in the
+            // (already resident) page header so resolving the pack position is cheap
+            IndexHash ph(keys_info[i + kProbePrefetchDist].second);
+            auto& pinfo = (*shard)->bucket(ph.page() % shard_info.npage, ph.bucket() % shard_info.nbucket);
+            __builtin_prefetch((*shard)->pack_in_page(pinfo.pageid, pinfo.packid));
+        }
+        const auto& key_info = keys_info[i];
         IndexHash h(key_info.second);
         auto pageid = h.page() % shard_info.npage;
         auto bucketid = h.bucket() % shard_info.nbucket;
@@ -2446,7 +2490,7 @@ Status ImmutableIndex::_get_in_fixlen_shard_by_page(size_t shard_idx, size_t n,
                                                     std::map<size_t, LargeIndexPage>& pages) const {
     const auto& shard_info = _shards[shard_idx];
     uint8_t candidate_idxes[kBucketSizeMax];
-    for (auto [_, keys_info] : keys_info_by_page) {
+    for (const auto& [_, keys_info] : keys_info_by_page) {
         for (size_t i = 0; i < keys_info.size(); i++) {
             IndexHash h(keys_info[i].second);
             auto pageid = h.page() % shard_info.npage;
@@ -2495,7 +2539,7 @@ Status ImmutableIndex::_get_in_varlen_shard_by_page(size_t shard_idx, size_t n,
                                                     std::map<size_t, LargeIndexPage>& pages) const {
     const auto& shard_info = _shards[shard_idx];
     uint8_t candidate_idxes[kBucketSizeMax];
-    for (auto [_, keys_info] : keys_info_by_page) {
+    for (const auto& [_, keys_info] : keys_info_by_page) {
         for (size_t i = 0; i < keys_info.size(); i++) {
             IndexHash h(keys_info[i].second);
             auto pageid = h.page() % shard_info.npage;
@@ -3770,6 +3814,16 @@ Status PersistentIndex::_update_usage_and_size_by_key_length(
 
 Status PersistentIndex::upsert(size_t n, const Slice* keys, const IndexValue* values, IndexValue* old_values,
                                IOStat* stat) {
+    return _upsert(n, keys, values, old_values, stat, true);
+}
+
+Status PersistentIndex::upsert_absent_keys(size_t n, const Slice* keys, const IndexValue* values,
+                                           IndexValue* old_values, IOStat* stat) {
+    return _upsert(n, keys, values, old_values, stat, false);
+}
+
+Status PersistentIndex::_upsert(size_t n, const Slice* keys, const IndexValue* values, IndexValue* old_values,
+                                IOStat* stat, bool check_immutable_index) {
     std::map<size_t, KeysInfo> not_founds_by_key_size;
     size_t num_found = 0;
     MonotonicStopWatch watch;
@@ -3779,10 +3833,13 @@ Status PersistentIndex::upsert(size_t n, const Slice* keys, const IndexValue* va
         stat->l0_write_cost += watch.elapsed_time();
         watch.reset();
     }
-    if (config::enable_parallel_get_and_bf) {
-        RETURN_IF_ERROR(_get_from_immutable_index_parallel(n, keys, old_values, not_founds_by_key_size));
-    } else {
-        RETURN_IF_ERROR(_get_from_immutable_index(n, keys, old_values, not_founds_by_key_size, stat));
+    // keys not found in l0 are new keys if caller guarantees they are absent in l1/l2
+    if (check_immutable_index) {
+        if (config::enable_parallel_get_and_bf) {
+            RETURN_IF_ERROR(_get_from_immutable_index_parallel(n, keys, old_values, not_founds_by_key_size));
+        } else {
+            RETURN_IF_ERROR(_get_from_immutable_index(n, keys, old_values, not_founds_by_key_size, stat));
+        }
     }
     if (stat != nullptr) {
         stat->l1_l2_read_cost += watch.elapsed_time();
@@ -5193,6 +5250,18 @@ Status PersistentIndex::pk_dump(PrimaryKeyDump* dump, PrimaryIndexMultiLevelPB*
     return Status::OK();
 }
 
+size_t PersistentIndex::release_cold_memory() {
+    size_t released = 0;
+    for (auto& l1 : _l1_vec) {
+        released += l1->release_bloom_filters();
+    }
+    for (auto& l2 : _l2_vec) {
+        released += l2->release_bloom_filters();
+    }
+    _calc_memory_usage();
+    return released;
+}
+
 void PersistentIndex::_calc_memory_usage() {
     size_t memory_usage = _l0 ? _l0->memory_usage() : 0;
     for (int i = 0; i < _l1_vec.size(); i++) {
@@ -494,6 +494,23 @@ public:
         return mem_usage;
     }
 
+    // Drop bloom filters kept in memory, they will be reloaded from index file shard by shard
+    // when needed. return the bytes released.
+    size_t release_bloom_filters() {
+        // bloom filters are not persisted in file, can not reload them
+        if (_bf_off.empty()) {
+            return 0;
+        }
+        size_t released = 0;
+        for (auto& bf : _bf_vec) {
+            if (bf != nullptr) {
+                released += bf->size();
+                bf.reset();
+            }
+        }
+        return released;
+    }
+
     std::string filename() const {
         if (_file != nullptr) {
             return _file->filename();
@@ -669,8 +686,17 @@ public:
 
     size_t size() const { return _size; }
     size_t usage() const { return _usage; }
+
+    // Whether there is no key in any level. Unlike size(), it doesn't trust the size recorded in index meta.
+    virtual bool empty() const {
+        return _size == 0 && !_has_l1 && _l2_vec.empty() && (_l0 == nullptr || _l0->size() == 0);
+    }
     virtual size_t memory_usage() const { return _memory_usage.load(); }
 
+    // Release the bloom filters of on-disk levels (l1 and l2) which are reloaded lazily,
+    // return the bytes released. Caller should make sure no one else is using this index.
+    size_t release_cold_memory();
+
     EditVersion version() const { return _version; }
 
     // create new empty index
@@ -716,6 +742,16 @@ public:
     virtual Status upsert(size_t n, const Slice* keys, const IndexValue* values, IndexValue* old_values,
                           IOStat* stat = nullptr);
 
+    // batch upsert keys which caller already knows are not in l1/l2, e.g. all of them are larger than
+    // any key ever put into this index, so the lookups in l1/l2 are skipped
+    // |n|: size of key/value array
+    // |keys|: key array as raw buffer
+    // |values|: value array
+    // |old_values|: return old values for updates, or set to NullValue for inserts
+    // |stat|: used for collect statistic
+    Status upsert_absent_keys(size_t n, const Slice* keys, const IndexValue* values, IndexValue* old_values,
+                              IOStat* stat = nullptr);
+
     // batch replace without return old values
     // |n|: size of key/value array
     // |keys|: key array as raw buffer
@@ -818,6 +854,9 @@ protected:
     Status _load_by_loader(TabletLoader* loader);
 
 private:
+    Status _upsert(size_t n, const Slice* keys, const IndexValue* values, IndexValue* old_values, IOStat* stat,
+                   bool check_immutable_index);
+
     size_t _dump_bound();
 
     void _set_error(bool error, const string& msg) {
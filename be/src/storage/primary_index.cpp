@@ -1050,6 +1050,7 @@ Status PrimaryIndex::load(Tablet* tablet) {
     }
     _status = _do_load(tablet);
     _loaded = true;
+    _reset_pk_upper_bound(_status.ok() && _persistent_index != nullptr && _persistent_index->empty());
     if (!_status.ok()) {
         LOG(WARNING) << "load PrimaryIndex error: " << _status << " tablet:" << _tablet_id << " stack:\n"
                      << get_stack_trace();
@@ -1075,6 +1076,7 @@ void PrimaryIndex::unload() {
     }
     _status = Status::OK();
     _loaded = false;
+    _reset_pk_upper_bound(false);
     _calc_memory_usage();
 }
 
@@ -1290,6 +1292,7 @@ Status PrimaryIndex::_insert_into_persistent_index(uint32_t rssid, const vector<
     RETURN_IF_ERROR(_build_persistent_values(rssid, rowids, 0, pks.size(), &values));
     const Slice* vkeys = _build_persistent_keys(pks, 0, pks.size(), &keys);
     RETURN_IF_ERROR(_persistent_index->insert(pks.size(), vkeys, reinterpret_cast<IndexValue*>(values.data()), true));
+    _update_pk_upper_bound(pks, 0, pks.size());
     return Status::OK();
 }
 
@@ -1305,8 +1308,15 @@ Status PrimaryIndex::_upsert_into_persistent_index(uint32_t rssid, uint32_t rowi
     std::vector<uint64_t> old_values(n, NullIndexValue);
     const Slice* vkeys = _build_persistent_keys(pks, idx_begin, idx_end, &keys);
     RETURN_IF_ERROR(_build_persistent_values(rssid, rowid_start, idx_begin, idx_end, &values));
-    RETURN_IF_ERROR(_persistent_index->upsert(n, vkeys, reinterpret_cast<IndexValue*>(values.data()),
-                                              reinterpret_cast<IndexValue*>(old_values.data()), stat));
+    if (_keys_beyond_upper_bound(pks, idx_begin, idx_end)) {
+        RETURN_IF_ERROR(_persistent_index->upsert_absent_keys(n, vkeys, reinterpret_cast<IndexValue*>(values.data()),
+                                                              reinterpret_cast<IndexValue*>(old_values.data()),
+                                                              stat));
+    } else {
+        RETURN_IF_ERROR(_persistent_index->upsert(n, vkeys, reinterpret_cast<IndexValue*>(values.data()),
+                                                  reinterpret_cast<IndexValue*>(old_values.data()), stat));
+    }
+    _update_pk_upper_bound(pks, idx_begin, idx_end);
     for (unsigned long old : old_values) {
         if ((old != NullIndexValue) && (old >> 32) == rssid) {
             LOG(ERROR) << "found duplicate in upsert data rssid:" << rssid;
@@ -1496,6 +1506,23 @@ std::size_t PrimaryIndex::memory_usage() const {
     return _memory_usage.load();
 }
 
+std::size_t PrimaryIndex::release_cold_memory() {
+    // called with the lock of index cache held, don't wait for _lock to avoid lock order inversion,
+    // the index is being loaded or reset if _lock is held by others.
+    std::unique_lock<std::mutex> ul(_lock, std::try_to_lock);
+    if (!ul.owns_lock()) {
+        return memory_usage();
+    }
+    if (_loaded && _status.ok() && _persistent_index != nullptr) {
+        size_t released = _persistent_index->release_cold_memory();
+        if (released > 0) {
+            VLOG(1) << "release cold memory of primary index tablet:" << _tablet_id << " released:" << released;
+        }
+        _calc_memory_usage();
+    }
+    return memory_usage();
+}
+
 std::size_t PrimaryIndex::size() const {
     if (_persistent_index) {
         return _persistent_index->size();
@@ -1552,6 +1579,7 @@ Status PrimaryIndex::reset(Tablet* tablet, EditVersion version, PersistentIndexM
         _pkey_to_rssid_rowid = create_hash_index(_enc_pk_type, _key_size);
     }
     _loaded = true;
+    _reset_pk_upper_bound(_persistent_index != nullptr && _persistent_index->empty());
     _calc_memory_usage();
 
     return Status::OK();
@@ -1574,6 +1602,43 @@ Status PrimaryIndex::pk_dump(PrimaryKeyDump* dump, PrimaryIndexMultiLevelPB* dum
     return Status::OK();
 }
 
+void PrimaryIndex::_reset_pk_upper_bound(bool valid) {
+    _pk_upper_bound_valid = valid;
+    _pk_upper_bound.reset();
+}
+
+bool PrimaryIndex::_keys_beyond_upper_bound(const Column& pks, uint32_t idx_begin, uint32_t idx_end) const {
+    if (!_pk_upper_bound_valid || idx_begin >= idx_end) {
+        return false;
+    }
+    if (_pk_upper_bound == nullptr) {
+        // nothing has been put into index yet
+        return true;
+    }
+    for (uint32_t i = idx_begin; i < idx_end; i++) {
+        if (pks.compare_at(i, 0, *_pk_upper_bound, 1) <= 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void PrimaryIndex::_update_pk_upper_bound(const Column& pks, uint32_t idx_begin, uint32_t idx_end) {
+    if (!_pk_upper_bound_valid || idx_begin >= idx_end) {
+        return;
+    }
+    uint32_t max_idx = idx_begin;
+    for (uint32_t i = idx_begin + 1; i < idx_end; i++) {
+        if (pks.compare_at(i, max_idx, pks, 1) > 0) {
+            max_idx = i;
+        }
+    }
+    if (_pk_upper_bound == nullptr || pks.compare_at(max_idx, 0, *_pk_upper_bound, 1) > 0) {
+        _pk_upper_bound = pks.clone_empty();
+        _pk_upper_bound->append(pks, max_idx, 1);
+    }
+}
+
 void PrimaryIndex::_calc_memory_usage() {
     size_t memory_usage = 0;
     if (_persistent_index) {
@@ -135,6 +135,11 @@ public:
     // [not thread-safe]
     std::size_t memory_usage() const;
 
+    // Release the bloom filters of the on-disk levels of a persistent index, which are reloaded lazily, without
+    // unloading the whole index, return memory usage after releasing.
+    // Nothing is released if the index is locked by others.
+    std::size_t release_cold_memory();
+
     // [not thread-safe]
     std::size_t size() const;
 
@@ -194,6 +199,15 @@ private:
 
     void _calc_memory_usage();
 
+    // reset the key upper bound, |valid| should be true only if the index is known to be empty
+    void _reset_pk_upper_bound(bool valid);
+
+    // return true if every key in [idx_begin, idx_end) of |pks| is larger than the key upper bound,
+    // which means none of them exists in index
+    bool _keys_beyond_upper_bound(const Column& pks, uint32_t idx_begin, uint32_t idx_end) const;
+
+    void _update_pk_upper_bound(const Column& pks, uint32_t idx_begin, uint32_t idx_end);
+
 protected:
     std::mutex _lock;
     std::atomic<bool> _loaded{false};
@@ -208,6 +222,13 @@ private:
     LogicalType _enc_pk_type = TYPE_UNKNOWN;
     std::unique_ptr<HashIndex> _pkey_to_rssid_rowid;
     std::atomic<size_t> _memory_usage{0};
+    // Upper bound of all the keys ever put into persistent index. For append-mostly loads whose keys are
+    // monotonically increasing, a batch of new keys can be upserted without probing l1/l2 at all.
+    // It's only tracked when every key in index passed through this object, i.e. index starts empty.
+    // After the index is unloaded, evicted or reloaded from disk with existing keys, the bound is unknown and
+    // stays invalid until the index is reset, since the keys of l1/l2 are neither sorted nor summarized.
+    bool _pk_upper_bound_valid = false;
+    std::unique_ptr<Column> _pk_upper_bound;
 };
 
 inline std::ostream& operator<<(std::ostream& os, const PrimaryIndex& o) {
@@ -31,7 +31,7 @@ RowSourceMaskBuffer::RowSourceMaskBuffer(int64_t tablet_id, std::string storage_
 
 RowSourceMaskBuffer::~RowSourceMaskBuffer() {
     _reset_mask_column();
-    if (_tmp_file_fd > 0) {
+    if (_tmp_file_fd > 0 && _owns_tmp_file) {
         ::close(_tmp_file_fd);
     }
 }
@@ -103,16 +103,24 @@ size_t RowSourceMaskBuffer::max_same_source_count(uint16_t source, size_t limit_
 Status RowSourceMaskBuffer::flip_to_read() {
     _current_index = 0;
     if (_tmp_file_fd > 0) {
-        off_t offset = lseek(_tmp_file_fd, 0, SEEK_SET);
-        if (offset != 0) {
-            PLOG(WARNING) << "fail to seek to offset 0. offset=" << offset;
-            return Status::InternalError("fail to seek to offset 0");
-        }
+        _read_offset = 0;
         _reset_mask_column();
     }
     return Status::OK();
 }
 
+std::unique_ptr<RowSourceMaskBuffer> RowSourceMaskBuffer::create_shared_reader() const {
+    auto reader = std::make_unique<RowSourceMaskBuffer>(_tablet_id, _storage_root_path);
+    if (_tmp_file_fd > 0) {
+        // all masks have been persisted by flush(), reader reads them by its own offset
+        reader->_tmp_file_fd = _tmp_file_fd;
+        reader->_owns_tmp_file = false;
+    } else {
+        reader->_mask_column->append(*_mask_column);
+    }
+    return reader;
+}
+
 Status RowSourceMaskBuffer::flush() {
     if (_tmp_file_fd > 0 && !_mask_column->empty()) {
         RETURN_IF_ERROR(_serialize_masks());
@@ -153,22 +161,25 @@ Status RowSourceMaskBuffer::_serialize_masks() {
 }
 
 Status RowSourceMaskBuffer::_deserialize_masks() {
+    // use pread with own offset, the file may be shared by several readers
     uint64_t num_rows = 0;
-    ssize_t r_size = ::read(_tmp_file_fd, &num_rows, sizeof(num_rows));
+    ssize_t r_size = ::pread(_tmp_file_fd, &num_rows, sizeof(num_rows), _read_offset);
     if (r_size == 0) {
         return Status::EndOfFile("end of file");
     } else if (r_size != sizeof(uint64_t)) {
         PLOG(WARNING) << "fail to read masks size from mask file. read size=" << r_size;
         return Status::InternalError("fail to read masks size from mask file");
     }
+    _read_offset += r_size;
 
     std::vector<uint16_t> content;
     raw::stl_vector_resize_uninitialized(&content, num_rows);
-    r_size = ::read(_tmp_file_fd, content.data(), content.size() * sizeof(content[0]));
+    r_size = ::pread(_tmp_file_fd, content.data(), content.size() * sizeof(content[0]), _read_offset);
     if (r_size != content.size() * sizeof(content[0])) {
         PLOG(WARNING) << "fail to read masks from mask file. read size=" << r_size;
         return Status::InternalError("fail to read masks from mask file");
     }
+    _read_offset += r_size;
     _mask_column->get_data().swap(content);
     return Status::OK();
 }
@@ -87,6 +87,11 @@ public:
     Status flip_to_read();
     Status flush();
 
+    // Create a buffer which reads the same masks as this one with its own read position, so that
+    // several column groups can replay the masks concurrently. Must be called after flush(),
+    // and this buffer must outlive the returned one.
+    std::unique_ptr<RowSourceMaskBuffer> create_shared_reader() const;
+
 private:
     void _reset_mask_column() { _mask_column->reset_column(); }
     Status _create_tmp_file();
@@ -97,9 +102,13 @@ private:
 
     // for read
     uint64_t _current_index = 0;
+    // read offset of temporary file
+    off_t _read_offset = 0;
 
     // temporary file for persistence
     int _tmp_file_fd = -1;
+    // false if the temporary file is shared from another buffer
+    bool _owns_tmp_file = true;
     int64_t _tablet_id;
     std::string _storage_root_path;
 };
@@ -1663,6 +1663,30 @@ double Tablet::compaction_score() {
     return _compaction_context ? _compaction_context->score : 0;
 }
 
+void Tablet::update_read_amplification(size_t num_segments) {
+    // exponential moving average, concurrent updates may lose some samples which is acceptable for a hint
+    double prev = _read_amplification.load(std::memory_order_relaxed);
+    double cur = _last_read_millis.load(std::memory_order_relaxed) == 0
+                         ? static_cast<double>(num_segments)
+                         : prev * 0.8 + static_cast<double>(num_segments) * 0.2;
+    _read_amplification.store(cur, std::memory_order_relaxed);
+    _last_read_millis.store(UnixMillis(), std::memory_order_relaxed);
+}
+
+double Tablet::read_amplification() const {
+    int64_t last_read_millis = _last_read_millis.load(std::memory_order_relaxed);
+    int64_t window_millis = config::compaction_read_amplification_window_seconds * 1000;
+    if (last_read_millis == 0 || window_millis <= 0) {
+        return 0;
+    }
+    int64_t elapsed = UnixMillis() - last_read_millis;
+    if (elapsed >= window_millis) {
+        return 0;
+    }
+    // decay linearly with time since last read, so tablets that stop being queried cool down
+    return _read_amplification.load(std::memory_order_relaxed) * (window_millis - elapsed) / window_millis;
+}
+
 void Tablet::stop_compaction() {
     std::lock_guard lock(_compaction_task_lock);
     StorageEngine::instance()->compaction_manager()->stop_compaction(
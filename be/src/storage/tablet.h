@@ -267,6 +267,13 @@ public:
     double compaction_score();
     CompactionType compaction_type();
 
+    // record how many segments a query scan on this tablet has to merge
+    void update_read_amplification(size_t num_segments);
+
+    // moving average of segments merged per query scan, it decays to 0 if the tablet
+    // is not read within `compaction_read_amplification_window_seconds`
+    double read_amplification() const;
+
     void set_compaction_context(std::unique_ptr<CompactionContext>& context);
 
     std::shared_ptr<CompactionTask> create_compaction_task();
@@ -438,6 +445,9 @@ private:
 
     std::atomic<int64_t> _cumulative_point{0};
     std::atomic<int32_t> _newly_created_rowset_num{0};
+    // read amplification observed by queries, see update_read_amplification()
+    std::atomic<double> _read_amplification{0};
+    std::atomic<int64_t> _last_read_millis{0};
     std::atomic<int64_t> _last_checkpoint_time{0};
 
     std::unique_ptr<BinlogManager> _binlog_manager;
@@ -317,6 +317,9 @@ Status TabletReader::get_segment_iterators(const TabletReaderParams& params, std
 Status TabletReader::_init_collector(const TabletReaderParams& params) {
     std::vector<ChunkIteratorPtr> seg_iters;
     RETURN_IF_ERROR(get_segment_iterators(params, &seg_iters));
+    if (is_query(params.reader_type) && _tablet != nullptr) {
+        _tablet->update_read_amplification(seg_iters.size());
+    }
 
     // Put each SegmentIterator into a TimedChunkIterator, if a profile is provided.
     if (params.profile != nullptr) {
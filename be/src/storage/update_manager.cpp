@@ -395,6 +395,12 @@ void UpdateManager::evict_cache(int64_t memory_urgent_level, int64_t memory_high
     int64_t memory_urgent = capacity * memory_urgent_level / 100;
     int64_t memory_high = capacity * memory_high_level / 100;
 
+    // Shrinking cold indexes is much cheaper than reloading a whole evicted index on next apply.
+    if (size > memory_high && config::enable_pindex_release_cold_memory) {
+        _index_cache.try_shrink(memory_high, [](PrimaryIndex& index) { return index.release_cold_memory(); });
+        size = _index_cache.size();
+    }
+
     if (size > memory_urgent) {
         _index_cache.try_evict(memory_urgent);
     }
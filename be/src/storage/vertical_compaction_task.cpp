@@ -19,14 +19,18 @@
 #include "column/schema.h"
 #include "runtime/current_thread.h"
 #include "storage/chunk_helper.h"
+#include "storage/compaction_manager.h"
 #include "storage/compaction_utils.h"
 #include "storage/olap_common.h"
 #include "storage/row_source_mask.h"
 #include "storage/rowset/column_reader.h"
 #include "storage/rowset/rowset.h"
 #include "storage/rowset/rowset_writer.h"
+#include "storage/storage_engine.h"
 #include "storage/tablet_reader.h"
 #include "storage/tablet_reader_params.h"
+#include "util/defer_op.h"
+#include "util/threadpool.h"
 #include "util/time.h"
 #include "util/trace.h"
 
@@ -73,7 +77,7 @@ Status VerticalCompactionTask::_vertical_compaction_data(Statistics* statistics)
           "size:$1",
           max_rows_per_segment, column_groups.size());
 
-    for (size_t i = 0; i < column_groups.size(); ++i) {
+    for (size_t i = 0; i < column_groups.size();) {
         if (should_stop()) {
             LOG(INFO) << "vertical compaction task_id:" << _task_info.task_id << " is stopped.";
             return Status::Cancelled("vertical compaction task is stopped.");
@@ -83,8 +87,15 @@ Status VerticalCompactionTask::_vertical_compaction_data(Statistics* statistics)
             // read mask buffer from the beginning
             RETURN_IF_ERROR(mask_buffer->flip_to_read());
         }
-        RETURN_IF_ERROR(_compact_column_group(is_key, i, column_groups[i], output_rs_writer.get(), mask_buffer.get(),
-                                              source_masks.get(), statistics));
+        size_t end = is_key ? i + 1 : _get_parallel_column_groups_end(i, column_groups);
+        if (end - i > 1) {
+            RETURN_IF_ERROR(_compact_column_groups_in_parallel(i, end, column_groups, output_rs_writer.get(),
+                                                               mask_buffer.get()));
+        } else {
+            RETURN_IF_ERROR(_compact_column_group(is_key, i, column_groups[i], output_rs_writer.get(),
+                                                  mask_buffer.get(), source_masks.get(), statistics));
+        }
+        i = end;
     }
     TRACE("[Compaction] data compacted");
 
@@ -162,12 +173,152 @@ Status VerticalCompactionTask::_compact_column_group(bool is_key, int column_gro
     return Status::OK();
 }
 
-StatusOr<int32_t> VerticalCompactionTask::_calculate_chunk_size_for_column_group(
-        const std::vector<uint32_t>& column_group) {
-    int64_t total_num_rows = 0;
+Status VerticalCompactionTask::_compact_column_groups_in_parallel(
+        size_t begin, size_t end, const std::vector<std::vector<uint32_t>>& column_groups,
+        RowsetWriter* output_rs_writer, RowSourceMaskBuffer* mask_buffer) {
+    struct ColumnGroupContext {
+        explicit ColumnGroupContext(size_t queue_size) : chunks(queue_size) {}
+
+        Schema schema;
+        int32_t chunk_size = 0;
+        std::unique_ptr<RowSourceMaskBuffer> mask_buffer;
+        std::unique_ptr<TabletReader> reader;
+        // merged chunks, shutdown by the merge task when it's done
+        BlockingQueue<ChunkPtr> chunks;
+        Status status;
+        // the merge task is rejected by the pool, the group is merged by the calling thread
+        bool merge_in_place = false;
+    };
+
+    auto tablet = std::static_pointer_cast<Tablet>(_tablet->shared_from_this());
+    size_t queue_size = std::max(config::vertical_compaction_column_group_queue_size, 1);
+    std::vector<std::unique_ptr<ColumnGroupContext>> contexts;
+    contexts.reserve(end - begin);
+    for (size_t i = begin; i < end; ++i) {
+        auto& ctx = contexts.emplace_back(std::make_unique<ColumnGroupContext>(queue_size));
+        ctx->schema = ChunkHelper::convert_schema(_tablet_schema, column_groups[i]);
+        ctx->mask_buffer = mask_buffer->create_shared_reader();
+        ctx->reader = std::make_unique<TabletReader>(tablet, output_rs_writer->version(), ctx->schema, false,
+                                                     ctx->mask_buffer.get(), _tablet_schema);
+        RETURN_IF_ERROR(ctx->reader->prepare());
+        TabletReaderParams reader_params;
+        DCHECK(compaction_type() == BASE_COMPACTION || compaction_type() == CUMULATIVE_COMPACTION);
+        reader_params.reader_type =
+                compaction_type() == BASE_COMPACTION ? READER_BASE_COMPACTION : READER_CUMULATIVE_COMPACTION;
+        reader_params.profile = _runtime_profile.create_child("merge_rowsets");
+        ASSIGN_OR_RETURN(ctx->chunk_size, _calculate_chunk_size_for_column_group(column_groups[i]));
+        reader_params.chunk_size = ctx->chunk_size;
+        RETURN_IF_ERROR(ctx->reader->open(reader_params));
+    }
+    VLOG(1) << "compaction task_id:" << _task_info.task_id << ", tablet=" << _tablet->tablet_id()
+            << ", merge column groups [" << begin << ", " << end << ") in parallel";
+
+    auto* pool = StorageEngine::instance()->compaction_manager()->column_group_pool();
+    auto token = pool->new_token(ThreadPool::ExecutionMode::CONCURRENT);
+    // wake up the merge tasks blocked by full queues on error, and wait for them to exit
+    DeferOp wait_merge_tasks([&] {
+        for (auto& ctx : contexts) {
+            ctx->chunks.shutdown();
+        }
+        token->wait();
+    });
+    for (auto& ctx : contexts) {
+        auto st = token->submit_func([this, context = ctx.get()] {
+            SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(_mem_tracker);
+            try {
+                context->status = _merge_column_group(
+                        context->schema, context->chunk_size, context->reader.get(), [context](ChunkPtr chunk) {
+                            if (!context->chunks.blocking_put(std::move(chunk))) {
+                                // the writer has given up
+                                return Status::Cancelled("column group merge is cancelled");
+                            }
+                            return Status::OK();
+                        });
+            } catch (const std::exception& e) {
+                context->status = Status::InternalError(fmt::format("merge column group error: {}", e.what()));
+            }
+            context->chunks.shutdown();
+        });
+        if (!st.ok()) {
+            LOG(WARNING) << "compaction task_id:" << _task_info.task_id << ", tablet=" << _tablet->tablet_id()
+                         << ", failed to submit column group merge task, merge it sequentially: " << st;
+            ctx->merge_in_place = true;
+        }
+    }
+
+    // column groups are appended to the same segment files, so write them in order
+    for (size_t i = begin; i < end; ++i) {
+        auto& ctx = contexts[i - begin];
+        auto write_chunk = [&](const ChunkPtr& chunk) {
+            RETURN_IF_ERROR(output_rs_writer->add_columns(*chunk, column_groups[i], false));
+            _task_info.total_output_num_rows += chunk->num_rows();
+            return Status::OK();
+        };
+        if (ctx->merge_in_place) {
+            RETURN_IF_ERROR(_merge_column_group(ctx->schema, ctx->chunk_size, ctx->reader.get(), write_chunk));
+        } else {
+            ChunkPtr chunk;
+            while (ctx->chunks.blocking_get(&chunk)) {
+                RETURN_IF_ERROR(write_chunk(chunk));
+                chunk.reset();
+            }
+            RETURN_IF_ERROR(ctx->status);
+        }
+        _task_info.total_del_filtered_rows += ctx->reader->stats().rows_del_filtered;
+        _task_info.total_merged_rows += ctx->reader->merged_rows();
+        RETURN_IF_ERROR(output_rs_writer->flush_columns());
+    }
+    return Status::OK();
+}
+
+Status VerticalCompactionTask::_merge_column_group(const Schema& schema, int32_t chunk_size, TabletReader* reader,
+                                                   const std::function<Status(ChunkPtr)>& consumer) {
+    auto char_field_indexes = ChunkHelper::get_char_field_indexes(schema);
+    std::vector<RowSourceMask> source_masks;
+    while (LIKELY(!should_stop())) {
+#ifndef BE_TEST
+        RETURN_IF_ERROR(tls_thread_status.mem_tracker()->check_mem_limit("Compaction"));
+#endif
+        auto chunk = ChunkHelper::new_chunk(schema, chunk_size);
+        Status status = reader->get_next(chunk.get(), &source_masks);
+        if (!status.ok()) {
+            if (status.is_end_of_file()) {
+                return Status::OK();
+            }
+            LOG(WARNING) << "reader get next error. tablet=" << _tablet->tablet_id() << ", err=" << status.to_string();
+            return Status::InternalError(fmt::format("reader get_next error: {}", status.to_string()));
+        }
+        ChunkHelper::padding_char_columns(char_field_indexes, schema, _tablet_schema, chunk.get());
+        RETURN_IF_ERROR(consumer(std::move(chunk)));
+        source_masks.clear();
+    }
+    return Status::Cancelled("vertical compaction task is stopped.");
+}
+
+size_t VerticalCompactionTask::_get_parallel_column_groups_end(
+        size_t begin, const std::vector<std::vector<uint32_t>>& column_groups) {
+    auto* pool = StorageEngine::instance()->compaction_manager()->column_group_pool();
+    if (pool == nullptr) {
+        return begin + 1;
+    }
+    size_t max_parallel = std::max<int64_t>(config::vertical_compaction_max_parallel_column_groups, 1);
+    int64_t mem_used = 0;
+    size_t end = begin;
+    while (end < column_groups.size() && end - begin < max_parallel) {
+        // column readers of each group are opened until the group is written
+        int64_t mem_footprint = _calculate_mem_footprint(column_groups[end]);
+        if (mem_used + mem_footprint > config::compaction_memory_limit_per_worker) {
+            break;
+        }
+        mem_used += mem_footprint;
+        ++end;
+    }
+    return std::max(end, begin + 1);
+}
+
+int64_t VerticalCompactionTask::_calculate_mem_footprint(const std::vector<uint32_t>& column_group) {
     int64_t total_mem_footprint = 0;
     for (auto& rowset : _input_rowsets) {
-        total_num_rows += rowset->num_rows();
         for (auto& segment : rowset->segments()) {
             for (uint32_t column_index : column_group) {
                 auto uid = _tablet_schema->column(column_index).unique_id();
@@ -179,6 +330,16 @@ StatusOr<int32_t> VerticalCompactionTask::_calculate_chunk_size_for_column_group
             }
         }
     }
+    return total_mem_footprint;
+}
+
+StatusOr<int32_t> VerticalCompactionTask::_calculate_chunk_size_for_column_group(
+        const std::vector<uint32_t>& column_group) {
+    int64_t total_num_rows = 0;
+    for (auto& rowset : _input_rowsets) {
+        total_num_rows += rowset->num_rows();
+    }
+    int64_t total_mem_footprint = _calculate_mem_footprint(column_group);
     int32_t chunk_size =
             CompactionUtils::get_read_chunk_size(config::compaction_memory_limit_per_worker, config::vector_chunk_size,
                                                  total_num_rows, total_mem_footprint, _task_info.input_segments_num);
@@ -14,13 +14,16 @@
 
 #pragma once
 
+#include <functional>
 #include <vector>
 
+#include "column/vectorized_fwd.h"
 #include "common/status.h"
 #include "common/statusor.h"
 #include "storage/compaction_task.h"
 #include "storage/olap_common.h"
 #include "storage/rowset/rowset.h"
+#include "util/blocking_queue.hpp"
 
 namespace starrocks {
 
@@ -48,6 +51,24 @@ private:
                                    const Schema& schema, TabletReader* reader, RowsetWriter* output_rs_writer,
                                    RowSourceMaskBuffer* mask_buffer, std::vector<RowSourceMask>* source_masks);
 
+    // Merge non-key column groups [begin, end) concurrently on the column group pool of CompactionManager,
+    // each group replays the row source masks with its own reader. Merged chunks are streamed through a bounded
+    // queue per group, and are written to `output_rs_writer` in group order. A group rejected by the pool is
+    // merged by the calling thread when it's its turn to be written.
+    Status _compact_column_groups_in_parallel(size_t begin, size_t end,
+                                              const std::vector<std::vector<uint32_t>>& column_groups,
+                                              RowsetWriter* output_rs_writer, RowSourceMaskBuffer* mask_buffer);
+
+    // Merge a column group by `reader` and pass the merged chunks to `consumer`.
+    Status _merge_column_group(const Schema& schema, int32_t chunk_size, TabletReader* reader,
+                               const std::function<Status(ChunkPtr)>& consumer);
+
+    // Return the end of the non-key column groups starting from `begin` which can be merged concurrently
+    // within config::compaction_memory_limit_per_worker.
+    size_t _get_parallel_column_groups_end(size_t begin, const std::vector<std::vector<uint32_t>>& column_groups);
+
+    int64_t _calculate_mem_footprint(const std::vector<uint32_t>& column_group);
+
     StatusOr<int32_t> _calculate_chunk_size_for_column_group(const std::vector<uint32_t>& column_group);
 };
 
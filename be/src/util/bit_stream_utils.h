@@ -202,6 +202,9 @@ public:
     template <typename UINT_T>
     bool get_lleb_128(UINT_T* v);
 
+    // Returns the current read position in the buffer.
+    const uint8_t* buffer_pos() const { return _buffer_pos; }
+
 private:
     /// Returns the number of bytes left in the stream.
     int _bytes_left() { return _buffer_end - _buffer_pos; }
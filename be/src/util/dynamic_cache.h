@@ -326,6 +326,32 @@ public:
         return;
     }
 
+    // Walk unused entries from the least recently used one and let |shrink| release the part of
+    // the object that can be rebuilt lazily, until total size drops to |target_capacity|.
+    // |shrink| returns the new size of the object. Unlike try_evict, entries stay in cache.
+    // |shrink| is called with the cache lock held, so that no one can get the entry meanwhile,
+    // it must not block on other locks.
+    template <typename ShrinkFunc>
+    void try_shrink(size_t target_capacity, ShrinkFunc&& shrink) {
+        std::lock_guard<std::mutex> lg(_lock);
+        auto itr = _list.begin();
+        while (_size > target_capacity && itr != _list.end()) {
+            Entry* entry = (*itr);
+            itr++;
+            // entry is in use by others, skip it
+            if (entry->_ref != 1) {
+                continue;
+            }
+            size_t new_size = shrink(entry->_value);
+            if (new_size < entry->_size) {
+                size_t released = entry->_size - new_size;
+                _size -= released;
+                if (_mem_tracker) _mem_tracker->release(released);
+                entry->_size = new_size;
+            }
+        }
+    }
+
     bool TEST_evict(size_t target_capacity, std::vector<Entry*>* entry_list) {
         return _evict(target_capacity, entry_list);
     }
@@ -22,4 +22,8 @@ uint64_t HashUtil::xx_hash3_64(const void* key, int32_t len, uint64_t seed) {
     return XXH3_64bits_withSeed(key, len, seed);
 }
 
+uint64_t HashUtil::xx_hash64(const void* key, int32_t len, uint64_t seed) {
+    return XXH64(key, len, seed);
+}
+
 } // namespace starrocks
\ No newline at end of file
@@ -0,0 +1,158 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "util/perf_event_counters.h"
+
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+#include "common/logging.h"
+
+namespace starrocks {
+
+struct PerfEventConfig {
+    uint32_t type;
+    uint64_t config;
+    const char* name;
+};
+
+// Hardware events go first, so the group leader is a hardware event if any is supported.
+static const PerfEventConfig kEventConfigs[PerfEventCounters::NUM_EVENTS] = {
+        {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES, "CpuCycles"},
+        {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS, "Instructions"},
+        {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES, "CacheMisses"},
+        {PERF_TYPE_HW_CACHE,
+         PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16),
+         "DTLBMisses"},
+        {PERF_TYPE_SOFTWARE, PERF_COUNT_SW_PAGE_FAULTS, "PageFaults"},
+};
+
+static int perf_event_open(perf_event_attr* attr, int group_fd) {
+    // the calling thread on any cpu
+    return static_cast<int>(syscall(__NR_perf_event_open, attr, 0, -1, group_fd, PERF_FLAG_FD_CLOEXEC));
+}
+
+PerfEventCounters::PerfEventCounters() {
+    for (int i = 0; i < NUM_EVENTS; i++) {
+        _fds[i] = -1;
+        _index[i] = -1;
+
+        perf_event_attr attr;
+        memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = kEventConfigs[i].type;
+        attr.config = kEventConfigs[i].config;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+        int fd = perf_event_open(&attr, _group_fd);
+        if (fd < 0) {
+            VLOG(2) << "failed to open perf event " << kEventConfigs[i].name << ": " << std::strerror(errno);
+            continue;
+        }
+        if (_group_fd < 0) {
+            _group_fd = fd;
+        }
+        _fds[i] = fd;
+        _index[i] = _num_opened++;
+    }
+}
+
+PerfEventCounters::~PerfEventCounters() {
+    for (int fd : _fds) {
+        if (fd >= 0) {
+            close(fd);
+        }
+    }
+}
+
+PerfEventCounters* PerfEventCounters::thread_local_instance() {
+    static thread_local PerfEventCounters s_counters;
+    return s_counters.is_open() ? &s_counters : nullptr;
+}
+
+// The events opened by a probe instance, which is closed at once.
+static const std::array<bool, PerfEventCounters::NUM_EVENTS>& supported_events() {
+    static const auto s_supported = [] {
+        std::array<bool, PerfEventCounters::NUM_EVENTS> supported{};
+        PerfEventCounters probe;
+        for (int i = 0; i < PerfEventCounters::NUM_EVENTS; i++) {
+            supported[i] = probe.has_event(static_cast<PerfEventCounters::Event>(i));
+        }
+        return supported;
+    }();
+    return s_supported;
+}
+
+bool PerfEventCounters::is_supported() {
+    const auto& supported = supported_events();
+    return std::any_of(supported.begin(), supported.end(), [](bool v) { return v; });
+}
+
+bool PerfEventCounters::is_supported(Event event) {
+    return supported_events()[event];
+}
+
+const char* PerfEventCounters::event_name(Event event) {
+    return kEventConfigs[event].name;
+}
+
+bool PerfEventCounters::read(Values* values) const {
+    if (_group_fd < 0) {
+        return false;
+    }
+    // {nr, time_enabled, time_running, value[nr]}
+    uint64_t buf[3 + NUM_EVENTS];
+    ssize_t size = ::read(_group_fd, buf, sizeof(buf));
+    if (size < static_cast<ssize_t>(3 * sizeof(uint64_t)) || buf[0] != static_cast<uint64_t>(_num_opened)) {
+        return false;
+    }
+    uint64_t time_enabled = buf[1];
+    uint64_t time_running = buf[2];
+    for (int i = 0; i < NUM_EVENTS; i++) {
+        if (_index[i] < 0) {
+            values->values[i] = 0;
+            continue;
+        }
+        uint64_t value = buf[3 + _index[i]];
+        // the group was not always on the PMU when there are more events than the hardware counters
+        if (time_running > 0 && time_running < time_enabled) {
+            value = static_cast<uint64_t>(static_cast<double>(value) * time_enabled / time_running);
+        }
+        values->values[i] = static_cast<int64_t>(value);
+    }
+    return true;
+}
+
+std::unique_ptr<PerfEventProfileCounters> PerfEventProfileCounters::create(RuntimeProfile* profile) {
+    if (!PerfEventCounters::is_supported()) {
+        return nullptr;
+    }
+    auto counters = std::make_unique<PerfEventProfileCounters>();
+    for (int i = 0; i < PerfEventCounters::NUM_EVENTS; i++) {
+        auto event = static_cast<PerfEventCounters::Event>(i);
+        if (PerfEventCounters::is_supported(event)) {
+            counters->_counters[i] = ADD_COUNTER(profile, PerfEventCounters::event_name(event), TUnit::UNIT);
+        }
+    }
+    return counters;
+}
+
+} // namespace starrocks
@@ -0,0 +1,121 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include "util/runtime_profile.h"
+
+namespace starrocks {
+
+// Hardware and software counters of the calling thread, read by perf_event_open(2), e.g. to find out the
+// operators bound by cache misses, TLB misses or page faults.
+//
+// The events are opened as one group per thread, so they are read by a single syscall. Only the user space
+// is counted, which is allowed when kernel.perf_event_paranoid is not greater than 2. Events not supported
+// by the machine, e.g. hardware events in some virtual machines, are left out and stay zero.
+// It is not thread-safe, use thread_local_instance() to get the counters of the current thread.
+class PerfEventCounters {
+public:
+    enum Event { CPU_CYCLES = 0, INSTRUCTIONS, CACHE_MISSES, DTLB_MISSES, PAGE_FAULTS, NUM_EVENTS };
+
+    struct Values {
+        int64_t values[NUM_EVENTS] = {};
+    };
+
+    PerfEventCounters();
+    ~PerfEventCounters();
+
+    PerfEventCounters(const PerfEventCounters&) = delete;
+    PerfEventCounters& operator=(const PerfEventCounters&) = delete;
+
+    // The counters of the current thread, opened on the first call, nullptr if no event is available.
+    static PerfEventCounters* thread_local_instance();
+
+    // Whether any event can be opened in this process.
+    static bool is_supported();
+    // Whether `event` can be opened in this process.
+    static bool is_supported(Event event);
+
+    static const char* event_name(Event event);
+
+    // Read the accumulated values, scaled if the events were multiplexed with others.
+    bool read(Values* values) const;
+
+    bool is_open() const { return _group_fd >= 0; }
+    bool has_event(Event event) const { return _index[event] >= 0; }
+
+private:
+    int _group_fd = -1;
+    int _fds[NUM_EVENTS];
+    // event -> position in the group read, -1 if not opened
+    int _index[NUM_EVENTS];
+    int _num_opened = 0;
+};
+
+// Profile counters of the events, each added to `profile` only if the event is supported.
+class PerfEventProfileCounters {
+public:
+    // Return nullptr if perf events are not supported.
+    static std::unique_ptr<PerfEventProfileCounters> create(RuntimeProfile* profile);
+
+    // nullptr if the event is not supported.
+
+    RuntimeProfile::Counter* counter(PerfEventCounters::Event event) const { return _counters[event]; }
+
+private:
+    RuntimeProfile::Counter* _counters[PerfEventCounters::NUM_EVENTS] = {};
+};
+
+// Add the events happened in the scope on the current thread to `counters`, do nothing if it is nullptr.
+class ScopedPerfEventCounters {
+public:
+    explicit ScopedPerfEventCounters(const PerfEventProfileCounters* counters) {
+        if (counters == nullptr) {
+            return;
+        }
+        _perf_counters = PerfEventCounters::thread_local_instance();
+        if (_perf_counters != nullptr && _perf_counters->read(&_start)) {
+            _counters = counters;
+        }
+    }
+
+    ~ScopedPerfEventCounters() {
+        PerfEventCounters::Values end;
+        if (_counters == nullptr || !_perf_counters->read(&end)) {
+            return;
+        }
+        for (int i = 0; i < PerfEventCounters::NUM_EVENTS; i++) {
+            auto* counter = _counters->counter(static_cast<PerfEventCounters::Event>(i));
+            if (counter != nullptr && end.values[i] > _start.values[i]) {
+                COUNTER_UPDATE(counter, end.values[i] - _start.values[i]);
+            }
+        }
+    }
+
+    ScopedPerfEventCounters(const ScopedPerfEventCounters&) = delete;
+    ScopedPerfEventCounters& operator=(const ScopedPerfEventCounters&) = delete;
+
+private:
+    const PerfEventProfileCounters* _counters = nullptr;
+    PerfEventCounters* _perf_counters = nullptr;
+    PerfEventCounters::Values _start;
+};
+
+#define SCOPED_PERF_EVENT_COUNTERS(c) \
+    ScopedPerfEventCounters MACRO_CONCAT(SCOPED_PERF_EVENT_COUNTERS, __COUNTER__)(c)
+
+} // namespace starrocks
@@ -20,10 +20,13 @@
 #include <cstring>
 #include <filesystem>
 
+#include "common/config.h"
 #include "common/logging.h"
 #include "common/statusor.h"
 #include "fs/fs_util.h"
 #include "storage/options.h"
+#include "util/coding.h"
+#include "util/defer_op.h"
 
 namespace starrocks {
 
@@ -239,6 +242,156 @@ TEST_F(BlockCacheTest, write_with_overwrite_option) {
     cache->shutdown();
 }
 
+TEST_F(BlockCacheTest, write_and_read_blob) {
+    std::unique_ptr<BlockCache> cache(new BlockCache);
+    const size_t block_size = 1024;
+
+    CacheOptions options;
+    options.mem_space_size = 20 * 1024 * 1024;
+    options.block_size = block_size;
+    options.max_concurrent_inserts = 100000;
+    options.max_flying_memory_mb = 100;
+    options.engine = "starcache";
+    Status status = cache->init(options);
+    ASSERT_TRUE(status.ok());
+
+    // a blob spans several blocks, and one just fills the first block with its length header
+    for (size_t blob_size : {size_t(0), size_t(100), block_size - sizeof(uint32_t), 3 * block_size + 10}) {
+        const std::string cache_key = fmt::format("test_blob_{}", blob_size);
+        std::string blob(blob_size, 0);
+        for (size_t i = 0; i < blob_size; i++) {
+            blob[i] = static_cast<char>('a' + i % 26);
+        }
+        ASSERT_TRUE(cache->write_blob(cache_key, blob).ok());
+
+        auto res = cache->read_blob(cache_key);
+        ASSERT_TRUE(res.ok()) << res.status();
+        ASSERT_EQ(blob, res.value());
+    }
+
+    ASSERT_FALSE(cache->read_blob("not_exist_blob").ok());
+
+    cache->shutdown();
+}
+
+TEST_F(BlockCacheTest, write_blob_after_partial_write) {
+    std::unique_ptr<BlockCache> cache(new BlockCache);
+    const size_t block_size = 1024;
+
+    CacheOptions options;
+    options.mem_space_size = 20 * 1024 * 1024;
+    options.block_size = block_size;
+    options.max_concurrent_inserts = 100000;
+    options.max_flying_memory_mb = 100;
+    options.engine = "starcache";
+    Status status = cache->init(options);
+    ASSERT_TRUE(status.ok());
+
+    const std::string cache_key = "test_partial_blob";
+    std::string blob(3 * block_size + 10, 0);
+    for (size_t i = 0; i < blob.size(); i++) {
+        blob[i] = static_cast<char>('a' + i % 26);
+    }
+    std::string data(sizeof(uint32_t), 0);
+    encode_fixed32_le(reinterpret_cast<uint8_t*>(data.data()), blob.size());
+    data.append(blob);
+
+    // a previous write failed after the last two blocks, the blob is not readable without its head block
+    WriteCacheOptions write_options;
+    for (size_t offset : {3 * block_size, 2 * block_size}) {
+        size_t size = std::min(block_size, data.size() - offset);
+        ASSERT_TRUE(cache->write_buffer(cache_key, offset, size, data.data() + offset, &write_options).ok());
+    }
+    ASSERT_FALSE(cache->read_blob(cache_key).ok());
+
+    // the existing blocks are skipped and the rest are written
+    ASSERT_TRUE(cache->write_blob(cache_key, blob, &write_options).ok());
+    auto res = cache->read_blob(cache_key);
+    ASSERT_TRUE(res.ok()) << res.status();
+    ASSERT_EQ(blob, res.value());
+
+    // the blob is complete, writing it again reports the head block
+    ASSERT_TRUE(cache->write_blob(cache_key, blob, &write_options).is_already_exist());
+
+    cache->shutdown();
+}
+
+TEST_F(BlockCacheTest, write_with_admission) {
+    std::unique_ptr<BlockCache> cache(new BlockCache);
+    const size_t block_size = 1024;
+
+    CacheOptions options;
+    options.mem_space_size = 20 * 1024 * 1024;
+    options.block_size = block_size;
+    options.max_concurrent_inserts = 100000;
+    options.max_flying_memory_mb = 100;
+    options.engine = "starcache";
+    Status status = cache->init(options);
+    ASSERT_TRUE(status.ok());
+
+    config::datacache_admission_enable = true;
+    DeferOp defer([]() { config::datacache_admission_enable = false; });
+
+    const std::string cache_key = "test_admission_file";
+    std::string value(block_size, 'a');
+    // not admitted for the first access
+    Status st = cache->write_buffer(cache_key, 0, block_size, value.c_str());
+    ASSERT_TRUE(st.is_cancelled()) << st;
+    ASSERT_EQ(1, cache->admission_reject_count());
+    char rvalue[block_size] = {0};
+    ASSERT_TRUE(cache->read_buffer(cache_key, 0, block_size, rvalue).status().is_not_found());
+
+    // admitted for the second access
+    st = cache->write_buffer(cache_key, 0, block_size, value.c_str());
+    ASSERT_TRUE(st.ok()) << st;
+    auto res = cache->read_buffer(cache_key, 0, block_size, rvalue);
+    ASSERT_TRUE(res.ok());
+    ASSERT_EQ(memcmp(rvalue, value.c_str(), block_size), 0);
+
+    // other blocks are not affected
+    st = cache->write_buffer(cache_key, block_size, block_size, value.c_str());
+    ASSERT_TRUE(st.is_cancelled()) << st;
+    ASSERT_EQ(2, cache->admission_reject_count());
+
+    cache->shutdown();
+}
+
+TEST_F(BlockCacheTest, write_blob_with_admission) {
+    std::unique_ptr<BlockCache> cache(new BlockCache);
+    const size_t block_size = 1024;
+
+    CacheOptions options;
+    options.mem_space_size = 20 * 1024 * 1024;
+    options.block_size = block_size;
+    options.max_concurrent_inserts = 100000;
+    options.max_flying_memory_mb = 100;
+    options.engine = "starcache";
+    Status status = cache->init(options);
+    ASSERT_TRUE(status.ok());
+
+    config::datacache_admission_enable = true;
+    DeferOp defer([]() { config::datacache_admission_enable = false; });
+
+    const std::string cache_key = "test_admission_blob";
+    std::string blob(3 * block_size + 10, 'b');
+    // not admitted for the first access, no block is written
+    Status st = cache->write_blob(cache_key, blob);
+    ASSERT_TRUE(st.is_cancelled()) << st;
+    ASSERT_EQ(1, cache->admission_reject_count());
+    char rvalue[block_size] = {0};
+    ASSERT_TRUE(cache->read_buffer(cache_key, 2 * block_size, block_size, rvalue).status().is_not_found());
+
+    // all blocks are admitted for the second access
+    st = cache->write_blob(cache_key, blob);
+    ASSERT_TRUE(st.ok()) << st;
+    ASSERT_EQ(1, cache->admission_reject_count());
+    auto res = cache->read_blob(cache_key);
+    ASSERT_TRUE(res.ok()) << res.status();
+    ASSERT_EQ(blob, res.value());
+
+    cache->shutdown();
+}
+
 TEST_F(BlockCacheTest, read_cache_with_adaptor) {
     const std::string cache_dir = "./block_disk_cache4";
     ASSERT_TRUE(fs::create_directories(cache_dir).ok());
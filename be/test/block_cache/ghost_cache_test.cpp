@@ -0,0 +1,66 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "block_cache/ghost_cache.h"
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include "block_cache/table_cache_metrics.h"
+
+namespace starrocks {
+
+TEST(GhostCacheTest, touch) {
+    GhostCache ghost(1024);
+    ASSERT_FALSE(ghost.contains("key1"));
+    ASSERT_FALSE(ghost.touch("key1"));
+    ASSERT_TRUE(ghost.contains("key1"));
+    ASSERT_TRUE(ghost.touch("key1"));
+    ASSERT_FALSE(ghost.touch("key2"));
+    ASSERT_TRUE(ghost.touch("key2"));
+}
+
+TEST(GhostCacheTest, window) {
+    GhostCache ghost(1024);
+    ASSERT_FALSE(ghost.touch("key"));
+    // the old keys are overwritten by new ones
+    for (int i = 0; i < 100 * 1024; i++) {
+        ghost.touch(fmt::format("other_key_{}", i));
+    }
+    ASSERT_FALSE(ghost.contains("key"));
+
+    // most of the recent keys are remembered
+    int hits = 0;
+    for (int i = 0; i < 128; i++) {
+        ghost.touch(fmt::format("recent_key_{}", i));
+    }
+    for (int i = 0; i < 128; i++) {
+        hits += ghost.contains(fmt::format("recent_key_{}", i));
+    }
+    ASSERT_GT(hits, 100);
+}
+
+TEST(TableCacheMetricsTest, hit_ratio) {
+    auto* metrics = TableCacheMetrics::instance();
+    ASSERT_EQ(-1, metrics->hit_ratio("test_db.test_tbl"));
+    metrics->update("test_db.test_tbl", 100, 300);
+    ASSERT_DOUBLE_EQ(25, metrics->hit_ratio("test_db.test_tbl"));
+    metrics->update("test_db.test_tbl", 400, 200);
+    ASSERT_DOUBLE_EQ(50, metrics->hit_ratio("test_db.test_tbl"));
+    // nothing is read
+    metrics->update("test_db.empty_tbl", 0, 0);
+    ASSERT_EQ(-1, metrics->hit_ratio("test_db.empty_tbl"));
+}
+
+} // namespace starrocks
@@ -659,4 +659,48 @@ PARALLEL_TEST(BinaryColumnTest, test_reference_memory_usage) {
     ASSERT_EQ(0, column->Column::reference_memory_usage());
 }
 
+// NOLINTNEXTLINE
+PARALLEL_TEST(BinaryColumnTest, test_get_view) {
+    // inline and long strings, strings with zero bytes and bytes greater than 0x7f.
+    std::vector<std::string> values = {"",
+                                       "a",
+                                       std::string("a\0", 2),
+                                       "ab",
+                                       "abc",
+                                       "abcd",
+                                       "abcde",
+                                       "abce",
+                                       "b",
+                                       "\xff",
+                                       "abcdefghijkl",
+                                       "abcdefghijkm",
+                                       "abcdefghijklm",
+                                       "abcdefghijkln",
+                                       "abcdefghijklmn"};
+    auto column = BinaryColumn::create();
+    for (const auto& value : values) {
+        column->append(Slice(value));
+    }
+
+    for (size_t i = 0; i < values.size(); i++) {
+        auto lhs = column->get_view(i);
+        ASSERT_EQ(values[i].size(), lhs.size());
+        ASSERT_EQ(column->get_slice(i), lhs.to_slice());
+        ASSERT_EQ(values[i].size() <= BinaryView::INLINE_SIZE, lhs.is_inline());
+        for (size_t j = 0; j < values.size(); j++) {
+            auto rhs = column->get_proxy_data()[j];
+            int expected = column->get_slice(i).compare(rhs);
+            int actual = lhs.compare(column->get_view_proxy_data()[j]);
+            ASSERT_EQ(expected < 0, actual < 0) << values[i] << " vs " << values[j];
+            ASSERT_EQ(expected > 0, actual > 0) << values[i] << " vs " << values[j];
+            ASSERT_EQ(expected == 0, lhs == column->get_view(j)) << values[i] << " vs " << values[j];
+        }
+    }
+
+    // long strings refer to the bytes of the column.
+    auto view = column->get_view(values.size() - 1);
+    ASSERT_FALSE(view.is_inline());
+    ASSERT_EQ(column->get_slice(values.size() - 1).data, view.data());
+}
+
 } // namespace starrocks
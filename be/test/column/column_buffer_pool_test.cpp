@@ -0,0 +1,108 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "column/column_buffer_pool.h"
+
+#include <gtest/gtest.h>
+
+#include "column/binary_column.h"
+#include "common/config.h"
+
+namespace starrocks {
+
+class ColumnBufferPoolTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        config::enable_column_buffer_pool = true;
+        ColumnBufferPool::instance()->release_all_buffers();
+    }
+    void TearDown() override {
+        config::enable_column_buffer_pool = false;
+        ColumnBufferPool::instance()->release_all_buffers();
+    }
+};
+
+TEST_F(ColumnBufferPoolTest, allocation_size) {
+    ASSERT_EQ(1000, ColumnBufferPool::allocation_size(1000));
+    ASSERT_EQ(64 * 1024, ColumnBufferPool::allocation_size(64 * 1024));
+    ASSERT_EQ(80 * 1024, ColumnBufferPool::allocation_size(64 * 1024 + 1));
+    ASSERT_EQ(112 * 1024, ColumnBufferPool::allocation_size(100 * 1024));
+    ASSERT_EQ(128 * 1024, ColumnBufferPool::allocation_size(128 * 1024));
+    ASSERT_EQ(160 * 1024, ColumnBufferPool::allocation_size(129 * 1024));
+    ASSERT_EQ(ColumnBufferPool::MAX_BYTES, ColumnBufferPool::allocation_size(ColumnBufferPool::MAX_BYTES));
+    ASSERT_EQ(ColumnBufferPool::MAX_BYTES + 1, ColumnBufferPool::allocation_size(ColumnBufferPool::MAX_BYTES + 1));
+}
+
+TEST_F(ColumnBufferPoolTest, reuse) {
+    auto* pool = ColumnBufferPool::instance();
+    void* p1 = pool->allocate(100 * 1024);
+    pool->deallocate(p1, 100 * 1024);
+    ASSERT_GE(pool->cached_bytes(), 112 * 1024);
+
+    // any size of the same class reuses the buffer.
+    void* p2 = pool->allocate(110 * 1024);
+    ASSERT_EQ(p1, p2);
+    ASSERT_EQ(0, pool->cached_bytes());
+    pool->deallocate(p2, 110 * 1024);
+
+    // small buffers are not cached.
+    void* p3 = pool->allocate(1024);
+    pool->deallocate(p3, 1024);
+    ASSERT_GE(pool->cached_bytes(), 112 * 1024);
+    ASSERT_LT(pool->cached_bytes(), 128 * 1024);
+}
+
+TEST_F(ColumnBufferPoolTest, release_idle_buffers) {
+    auto* pool = ColumnBufferPool::instance();
+    void* p1 = pool->allocate(200 * 1024);
+    pool->deallocate(p1, 200 * 1024);
+    // it's just cached.
+    ASSERT_EQ(0, pool->release_idle_buffers());
+    ASSERT_GT(pool->cached_bytes(), 0);
+    // not reused since the last release.
+    ASSERT_GT(pool->release_idle_buffers(), 0);
+    ASSERT_EQ(0, pool->cached_bytes());
+}
+
+TEST_F(ColumnBufferPoolTest, disabled) {
+    config::enable_column_buffer_pool = false;
+    auto* pool = ColumnBufferPool::instance();
+    void* p1 = pool->allocate(200 * 1024);
+    pool->deallocate(p1, 200 * 1024);
+    ASSERT_EQ(0, pool->cached_bytes());
+}
+
+TEST_F(ColumnBufferPoolTest, binary_column) {
+    auto* pool = ColumnBufferPool::instance();
+    std::string value(100, 'a');
+    const uint8_t* data = nullptr;
+    {
+        auto column = BinaryColumn::create();
+        for (int i = 0; i < 4096; i++) {
+            column->append(Slice(value));
+        }
+        data = column->get_bytes().data();
+    }
+    ASSERT_GT(pool->cached_bytes(), 0);
+
+    auto column = BinaryColumn::create();
+    for (int i = 0; i < 4096; i++) {
+        column->append(Slice(value));
+    }
+    ASSERT_EQ(value, column->get_slice(4095).to_string());
+    // the buffer of the same size is reused.
+    ASSERT_EQ(data, column->get_bytes().data());
+}
+
+} // namespace starrocks
@@ -0,0 +1,152 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "connector/file_connector.h"
+
+#include <gtest/gtest.h>
+
+#include "common/config.h"
+#include "gen_cpp/PlanNodes_types.h"
+#include "gutil/casts.h"
+
+namespace starrocks::connector {
+
+class FileDataSourceTest : public ::testing::Test {
+public:
+    void SetUp() override { _split_size = config::file_scan_split_size; }
+    void TearDown() override { config::file_scan_split_size = _split_size; }
+
+protected:
+    static TScanRange create_scan_range(int64_t start_offset, int64_t size) {
+        TBrokerRangeDesc range;
+        range.__set_format_type(TFileFormatType::FORMAT_CSV_PLAIN);
+        range.__set_file_type(TFileType::FILE_LOCAL);
+        range.__set_path("/path/to/file.csv");
+        range.__set_start_offset(start_offset);
+        range.__set_size(size);
+        range.__set_file_size(start_offset + size);
+
+        TScanRange scan_range;
+        scan_range.broker_scan_range.ranges.emplace_back(range);
+        scan_range.__isset.broker_scan_range = true;
+        return scan_range;
+    }
+
+    static std::vector<std::pair<int64_t, int64_t>> get_split_tasks(FileDataSource* data_source) {
+        data_source->_generate_split_tasks();
+        std::vector<pipeline::ScanSplitContextPtr> split_tasks;
+        data_source->get_split_tasks(&split_tasks);
+        std::vector<std::pair<int64_t, int64_t>> splits;
+        for (const auto& task : split_tasks) {
+            const auto* split_context = down_cast<const FileSplitContext*>(task.get());
+            splits.emplace_back(split_context->split_start, split_context->split_end);
+        }
+        return splits;
+    }
+
+    int64_t _split_size = 0;
+};
+
+TEST_F(FileDataSourceTest, test_could_split) {
+    // disabled by default
+    {
+        FileDataSource data_source(nullptr, create_scan_range(0, 1000));
+        config::file_scan_split_size = 0;
+        ASSERT_FALSE(data_source._could_split());
+    }
+
+    config::file_scan_split_size = 100;
+    {
+        FileDataSource data_source(nullptr, create_scan_range(0, 200));
+        ASSERT_TRUE(data_source._could_split());
+    }
+    // less than twice the split size
+    {
+        FileDataSource data_source(nullptr, create_scan_range(0, 199));
+        ASSERT_FALSE(data_source._could_split());
+    }
+    // more than one range
+    {
+        auto scan_range = create_scan_range(0, 1000);
+        scan_range.broker_scan_range.ranges.emplace_back(scan_range.broker_scan_range.ranges[0]);
+        FileDataSource data_source(nullptr, scan_range);
+        ASSERT_FALSE(data_source._could_split());
+    }
+    // json and stream load
+    {
+        auto scan_range = create_scan_range(0, 1000);
+        scan_range.broker_scan_range.ranges[0].__set_format_type(TFileFormatType::FORMAT_JSON);
+        FileDataSource data_source(nullptr, scan_range);
+        ASSERT_FALSE(data_source._could_split());
+    }
+    {
+        auto scan_range = create_scan_range(0, 1000);
+        scan_range.broker_scan_range.ranges[0].__set_file_type(TFileType::FILE_STREAM);
+        FileDataSource data_source(nullptr, scan_range);
+        ASSERT_FALSE(data_source._could_split());
+    }
+    // compressed
+    {
+        auto scan_range = create_scan_range(0, 1000);
+        scan_range.broker_scan_range.ranges[0].__set_compression_type(TCompressionType::GZIP);
+        FileDataSource data_source(nullptr, scan_range);
+        ASSERT_FALSE(data_source._could_split());
+    }
+    {
+        auto scan_range = create_scan_range(0, 1000);
+        scan_range.broker_scan_range.ranges[0].__set_compression_type(TCompressionType::NO_COMPRESSION);
+        FileDataSource data_source(nullptr, scan_range);
+        ASSERT_TRUE(data_source._could_split());
+    }
+    // records may contain the row delimiter
+    {
+        auto scan_range = create_scan_range(0, 1000);
+        scan_range.broker_scan_range.params.__set_enclose('"');
+        FileDataSource data_source(nullptr, scan_range);
+        ASSERT_FALSE(data_source._could_split());
+    }
+    {
+        auto scan_range = create_scan_range(0, 1000);
+        scan_range.broker_scan_range.params.__set_escape('\\');
+        FileDataSource data_source(nullptr, scan_range);
+        ASSERT_FALSE(data_source._could_split());
+    }
+}
+
+TEST_F(FileDataSourceTest, test_generate_split_tasks) {
+    config::file_scan_split_size = 100;
+    {
+        FileDataSource data_source(nullptr, create_scan_range(0, 200));
+        std::vector<std::pair<int64_t, int64_t>> expected{{0, 100}, {100, 200}};
+        ASSERT_EQ(expected, get_split_tasks(&data_source));
+    }
+    // the small tail is merged into the last task
+    {
+        FileDataSource data_source(nullptr, create_scan_range(0, 450));
+        std::vector<std::pair<int64_t, int64_t>> expected{{0, 100}, {100, 200}, {200, 300}, {300, 450}};
+        ASSERT_EQ(expected, get_split_tasks(&data_source));
+    }
+    // splits are relative to the start of the range, and cover the range without gaps
+    {
+        FileDataSource data_source(nullptr, create_scan_range(1000, 250));
+        std::vector<std::pair<int64_t, int64_t>> expected{{1000, 1100}, {1100, 1250}};
+        ASSERT_EQ(expected, get_split_tasks(&data_source));
+        // tasks are handed out only once
+        std::vector<pipeline::ScanSplitContextPtr> split_tasks;
+        data_source.get_split_tasks(&split_tasks);
+        ASSERT_TRUE(split_tasks.empty());
+    }
+}
+
+} // namespace starrocks::connector
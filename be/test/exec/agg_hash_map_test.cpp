@@ -16,6 +16,7 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <any>
 
 #include "column/column_helper.h"
@@ -24,6 +25,8 @@
 #include "column/vectorized_fwd.h"
 #include "exec/aggregate/agg_hash_set.h"
 #include "exec/aggregate/agg_hash_variant.h"
+#include "exprs/jit/jit_engine.h"
+#include "exprs/jit/jit_key_serializer.h"
 #include "runtime/mem_pool.h"
 #include "runtime/runtime_state.h"
 #include "types/logical_type.h"
@@ -325,4 +328,87 @@ TEST_F(AggHashMapKeyNotFoundsTest, TestAllocateAndComputeNonFounds_FixedSize16Sl
     TestAggHashMapKeyWithIntType<TestAggHashMapKey>(true);
 }
 
+// Group by a nullable BIGINT, an INT and a nullable SMALLINT, return the groups with their row counts in order.
+// With jit, keys of the first chunk are serialized by columns while the function is compiled by the compile pool,
+// and keys of the following chunks are serialized by the compiled function.
+static std::vector<std::string> serialized_key_group_by(bool enable_jit, bool* serialized_by_jit) {
+    const int chunk_size = 1024;
+    const int num_chunks = 4;
+    RuntimeProfile profile("serialized_key_group_by");
+    AggStatistics statis(&profile);
+    SerializedKeyAggHashMap<PhmapSeed1> key(chunk_size, &statis);
+    key.enable_jit_key_serialize = enable_jit;
+    MemPool pool;
+    Buffer<AggDataPtr> agg_states(chunk_size);
+    auto allocate_func = [&pool](auto&) {
+        AggDataPtr state = pool.allocate(sizeof(int64_t));
+        *reinterpret_cast<int64_t*>(state) = 0;
+        return state;
+    };
+    std::vector<TypeDescriptor> types = {TypeDescriptor(TYPE_BIGINT), TypeDescriptor(TYPE_INT),
+                                         TypeDescriptor(TYPE_SMALLINT)};
+    for (int c = 0; c < num_chunks; c++) {
+        Columns key_columns{ColumnHelper::create_column(types[0], true), ColumnHelper::create_column(types[1], false),
+                            ColumnHelper::create_column(types[2], true)};
+        for (int i = 0; i < chunk_size; i++) {
+            int32_t row = c * chunk_size + i;
+            if (row % 7 == 0) {
+                key_columns[0]->append_nulls(1);
+            } else {
+                key_columns[0]->append_datum(Datum(static_cast<int64_t>(row % 100)));
+            }
+            key_columns[1]->append_datum(Datum(row % 3));
+            if (row % 11 == 0) {
+                key_columns[2]->append_nulls(1);
+            } else {
+                key_columns[2]->append_datum(Datum(static_cast<int16_t>(row % 5)));
+            }
+        }
+        key.build_hash_map(chunk_size, key_columns, &pool, allocate_func, &agg_states);
+        for (int i = 0; i < chunk_size; i++) {
+            (*reinterpret_cast<int64_t*>(agg_states[i]))++;
+        }
+        if (enable_jit) {
+            JITEngine::get_instance()->compile_pool()->wait();
+        }
+    }
+    *serialized_by_jit = key.key_serializer != nullptr && key.key_serializer->is_ready();
+
+    std::vector<Slice> keys;
+    std::vector<int64_t> counts;
+    for (const auto& [k, v] : key.hash_map) {
+        keys.emplace_back(k);
+        counts.emplace_back(*reinterpret_cast<int64_t*>(v));
+    }
+    Columns res_columns{ColumnHelper::create_column(types[0], true), ColumnHelper::create_column(types[1], false),
+                        ColumnHelper::create_column(types[2], true)};
+    key.insert_keys_to_columns(keys, res_columns, keys.size());
+    std::vector<std::string> groups;
+    for (size_t i = 0; i < counts.size(); i++) {
+        std::string group;
+        for (const auto& column : res_columns) {
+            group += column->debug_item(i) + ",";
+        }
+        groups.emplace_back(group + std::to_string(counts[i]));
+    }
+    std::sort(groups.begin(), groups.end());
+    return groups;
+}
+
+TEST(HashMapTest, JITSerializedKeyGroupBy) {
+    auto* jit_engine = JITEngine::get_instance();
+    if (!jit_engine->support_jit()) {
+        GTEST_SKIP() << "JIT is not supported";
+    }
+    bool serialized_by_jit = false;
+    auto expected = serialized_key_group_by(false, &serialized_by_jit);
+    ASSERT_FALSE(serialized_by_jit);
+
+    // keys serialized by columns and by the jit function are in the same hash map.
+    jit_engine->get_func_cache()->erase("key_serialize{n8,4,n2,}");
+    auto groups = serialized_key_group_by(true, &serialized_by_jit);
+    ASSERT_TRUE(serialized_by_jit);
+    ASSERT_EQ(expected, groups);
+}
+
 } // namespace starrocks
@@ -707,6 +707,44 @@ TEST_P(CSVScannerTest, test_skip_header) {
     EXPECT_EQ(0, chunk->get(4)[1].get_int32());
 }
 
+TEST_P(CSVScannerTest, test_split_ranges) {
+    std::vector<TypeDescriptor> types{TypeDescriptor(TYPE_INT), TypeDescriptor(TYPE_INT)};
+
+    // csv_file15 has 4 header lines of 24 bytes, followed by records starting at 24, 28, 32, 36 and 40.
+    // Split at the middle of a record and at the beginning of a record, each record should be read exactly once.
+    for (int64_t split : {30, 32}) {
+        std::vector<TBrokerRangeDesc> ranges;
+        TBrokerRangeDesc range;
+        range.__set_num_of_columns_from_file(2);
+        range.__set_path("./be/test/exec/test_data/csv_scanner/csv_file15");
+        range.__set_start_offset(0);
+        range.__set_size(split);
+        ranges.push_back(range);
+        range.__set_start_offset(split);
+        range.__set_size(44 - split);
+        ranges.push_back(range);
+
+        auto scanner = create_csv_scanner(types, ranges, "\n", "|", 4);
+        ASSERT_OK(scanner->open());
+
+        scanner->use_v2(_use_v2);
+
+        std::vector<int32_t> values;
+        while (true) {
+            auto res = scanner->get_next();
+            if (res.status().is_end_of_file()) {
+                break;
+            }
+            ASSERT_OK(res.status());
+            ChunkPtr chunk = res.value();
+            for (size_t i = 0; i < chunk->num_rows(); i++) {
+                values.push_back(chunk->get(i)[0].get_int32());
+            }
+        }
+        EXPECT_EQ((std::vector<int32_t>{1, 3, 5, 7, 9}), values) << "split at " << split;
+    }
+}
+
 TEST_P(CSVScannerTrimSpaceTest, test_trim_space) {
     std::vector<TypeDescriptor> types{TypeDescriptor(TYPE_INT), TypeDescriptor(TYPE_VARCHAR)};
 
@@ -16,6 +16,11 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <functional>
+
+#include "exprs/jit/jit_engine.h"
+#include "exprs/jit/jit_key_serializer.h"
 #include "runtime/descriptor_helper.h"
 #include "runtime/exec_env.h"
 #include "runtime/mem_tracker.h"
@@ -69,9 +74,10 @@ protected:
     static void check_probe_state(const JoinHashTableItems& table_items, const HashTableProbeState& probe_state,
                                   JoinMatchFlag match_flag, uint32_t step, uint32_t match_count,
                                   uint32_t probe_row_count);
-    static void check_build_index(const Buffer<uint32_t>& first, const Buffer<uint32_t>& next, uint32_t row_count);
-    static void check_build_index(const Buffer<uint8_t>& nulls, const Buffer<uint32_t>& first,
-                                  const Buffer<uint32_t>& next, uint32_t row_count);
+    static void check_build_index(const ArenaBuffer<uint32_t>& first, const ArenaBuffer<uint32_t>& next,
+                                  uint32_t row_count);
+    static void check_build_index(const Buffer<uint8_t>& nulls, const ArenaBuffer<uint32_t>& first,
+                                  const ArenaBuffer<uint32_t>& next, uint32_t row_count);
     static void check_build_slice(const Buffer<Slice>& slices, uint32_t row_count);
     static void check_build_slice(const Buffer<uint8_t>& nulls, const Buffer<Slice>& slices, uint32_t row_count);
     static void check_build_column(const ColumnPtr& build_column, uint32_t row_count);
@@ -99,6 +105,8 @@ protected:
                                             uint32_t count);
     void check_empty_hash_map(TJoinOp::type join_type, int num_probe_rows, int32_t expect_num_rows,
                               int32_t expect_num_colums);
+    std::vector<std::string> serialized_key_join(const std::function<void(JoinHashTable*)>& before_probe,
+                                                 bool* probe_by_jit);
 
     void sort_results_from_coroutine(std::vector<uint32_t>& pid, std::vector<uint32_t>& bid, int size) {
         std::vector<std::pair<int, int>> zipped;
@@ -501,7 +509,7 @@ void JoinHashMapTest::check_build_column(const ColumnPtr& build_column, uint32_t
     }
 }
 
-void JoinHashMapTest::check_build_index(const Buffer<uint32_t>& first, const Buffer<uint32_t>& next,
+void JoinHashMapTest::check_build_index(const ArenaBuffer<uint32_t>& first, const ArenaBuffer<uint32_t>& next,
                                         uint32_t row_count) {
     ASSERT_EQ(first.size(), JoinHashMapHelper::calc_bucket_size(row_count));
     ASSERT_EQ(next.size(), row_count + 1);
@@ -526,8 +534,8 @@ void JoinHashMapTest::check_build_index(const Buffer<uint32_t>& first, const Buf
     }
 }
 
-void JoinHashMapTest::check_build_index(const Buffer<uint8_t>& nulls, const Buffer<uint32_t>& first,
-                                        const Buffer<uint32_t>& next, uint32_t row_count) {
+void JoinHashMapTest::check_build_index(const Buffer<uint8_t>& nulls, const ArenaBuffer<uint32_t>& first,
+                                        const ArenaBuffer<uint32_t>& next, uint32_t row_count) {
     ASSERT_EQ(first.size(), JoinHashMapHelper::calc_bucket_size(row_count));
     ASSERT_EQ(next.size(), row_count + 1);
     ASSERT_EQ(next[0], 0);
@@ -2882,4 +2890,105 @@ TEST_F(JoinHashMapTest, TestMorRead) {
     check_lazy_build_output_slot_ids(*ht.table_items(), {});
 }
 
+// Inner join on three BIGINT keys, which don't fit in 16 bytes, so the keys are serialized.
+// Build keys are nullable with nulls and probe keys are not. Return the joined rows in order.
+std::vector<std::string> JoinHashMapTest::serialized_key_join(const std::function<void(JoinHashTable*)>& before_probe,
+                                                              bool* probe_by_jit) {
+    const int64_t num_build_rows = 1000;
+    const int64_t num_probe_rows = 1500;
+    TDescriptorTableBuilder row_desc_builder;
+    add_tuple_descriptor(&row_desc_builder, LogicalType::TYPE_BIGINT, false);
+    add_tuple_descriptor(&row_desc_builder, LogicalType::TYPE_BIGINT, true);
+    auto probe_row_desc = create_probe_desc(&row_desc_builder);
+    auto build_row_desc = create_build_desc(&row_desc_builder);
+
+    auto bigint_type = TypeDescriptor::from_logical_type(TYPE_BIGINT);
+    HashTableParam param = create_table_param(TJoinOp::INNER_JOIN, 6);
+    for (int i = 0; i < 3; i++) {
+        param.join_keys.emplace_back(JoinKeyDesc{&bigint_type, false, nullptr});
+    }
+    param.probe_row_desc = probe_row_desc.get();
+    param.build_row_desc = build_row_desc.get();
+
+    JoinHashTable hash_table;
+    hash_table.create(param);
+
+    auto build_chunk = std::make_shared<Chunk>();
+    auto probe_chunk = std::make_shared<Chunk>();
+    for (int i = 0; i < 3; i++) {
+        auto build_column = ColumnHelper::create_column(bigint_type, true);
+        for (int64_t row = 0; row < num_build_rows; row++) {
+            if (i == 1 && row % 5 == 0) {
+                build_column->append_nulls(1);
+            } else {
+                build_column->append_datum(Datum(row * (i + 1)));
+            }
+        }
+        build_chunk->append_column(build_column, 3 + i);
+        auto probe_column = ColumnHelper::create_column(bigint_type, false);
+        for (int64_t row = 0; row < num_probe_rows; row++) {
+            probe_column->append_datum(Datum(row * (i + 1)));
+        }
+        probe_chunk->append_column(probe_column, i);
+    }
+
+    Columns build_key_columns = build_chunk->columns();
+    hash_table.append_chunk(build_chunk, build_key_columns);
+    EXPECT_OK(hash_table.build(_runtime_state.get()));
+    before_probe(&hash_table);
+
+    Columns probe_key_columns = probe_chunk->columns();
+    ChunkPtr result_chunk = std::make_shared<Chunk>();
+    bool eos = false;
+    EXPECT_OK(hash_table.probe(_runtime_state.get(), probe_key_columns, &probe_chunk, &result_chunk, &eos));
+    const auto& probe_serializer = hash_table._probe_state->key_serializer;
+    *probe_by_jit = probe_serializer != nullptr && probe_serializer->is_ready();
+
+    std::vector<std::string> rows;
+    for (size_t i = 0; i < result_chunk->num_rows(); i++) {
+        rows.emplace_back(result_chunk->debug_row(i));
+    }
+    std::sort(rows.begin(), rows.end());
+    hash_table.close();
+    return rows;
+}
+
+// NOLINTNEXTLINE
+TEST_F(JoinHashMapTest, JITSerializedKeyJoin) {
+    auto* jit_engine = JITEngine::get_instance();
+    if (!jit_engine->support_jit()) {
+        GTEST_SKIP() << "JIT is not supported";
+    }
+    // build and probe keys have the same schema after the nullable build keys are split into data and null columns.
+    const std::string schema = "key_serialize{8,8,8,}";
+    auto* func_cache = jit_engine->get_func_cache();
+    bool probe_by_jit = false;
+
+    _runtime_state->set_jit_level(0);
+    auto expected = serialized_key_join([](JoinHashTable*) {}, &probe_by_jit);
+    ASSERT_EQ(800, expected.size());
+    ASSERT_FALSE(probe_by_jit);
+
+    _runtime_state->set_jit_level(CompilableExprType::HASH_KEY);
+    // build keys are serialized by columns while the function is compiled by the compile pool,
+    // probe keys are serialized by the compiled function.
+    func_cache->erase(schema);
+    auto rows = serialized_key_join([&](JoinHashTable*) { jit_engine->compile_pool()->wait(); }, &probe_by_jit);
+    ASSERT_TRUE(probe_by_jit);
+    ASSERT_EQ(expected, rows);
+
+    // build keys are serialized by the cached function, probe keys are serialized by columns as if the function of
+    // the probe side were still being compiled.
+    auto* handle = func_cache->lookup(schema);
+    ASSERT_TRUE(handle != nullptr);
+    func_cache->release(handle);
+    rows = serialized_key_join(
+            [&](JoinHashTable* hash_table) {
+                hash_table->_probe_state->key_serializer.reset(new JITKeySerializer(schema));
+            },
+            &probe_by_jit);
+    ASSERT_FALSE(probe_by_jit);
+    ASSERT_EQ(expected, rows);
+}
+
 } // namespace starrocks
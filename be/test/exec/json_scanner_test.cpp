@@ -693,6 +693,54 @@ TEST_F(JsonScannerTest, test_json_new_parser) {
     EXPECT_EQ("['v1', 'server', '10.10.0.1', 10]", chunk->debug_row(11));
 }
 
+TEST_F(JsonScannerTest, test_flat_jsonpath) {
+    std::vector<TypeDescriptor> types;
+    types.emplace_back(TypeDescriptor::create_varchar_type(20));
+    types.emplace_back(TypeDescriptor::create_varchar_type(20));
+    types.emplace_back(TYPE_INT);
+
+    std::vector<TBrokerRangeDesc> ranges;
+    TBrokerRangeDesc range;
+    range.format_type = TFileFormatType::FORMAT_JSON;
+    range.file_type = TFileType::FILE_LOCAL;
+    range.strip_outer_array = false;
+    range.__isset.strip_outer_array = false;
+    range.__isset.jsonpaths = true;
+    range.jsonpaths = R"(["$.k1", "$.kind", "$.value"])";
+    range.__isset.json_root = false;
+    range.__set_path("./be/test/exec/test_data/json_scanner/test_flat_jsonpath.json");
+    ranges.emplace_back(range);
+
+    {
+        auto scanner = create_json_scanner(types, ranges, {"k1", "kind", "value"});
+        ASSERT_OK(scanner->open());
+
+        ChunkPtr chunk = scanner->get_next().value();
+        EXPECT_EQ(3, chunk->num_columns());
+        EXPECT_EQ(5, chunk->num_rows());
+
+        EXPECT_EQ("['v1', 'server', 10]", chunk->debug_row(0));
+        EXPECT_EQ("['v2', NULL, 20]", chunk->debug_row(1));
+        // the first one of duplicated keys is taken.
+        EXPECT_EQ("[NULL, 'server2', 30]", chunk->debug_row(2));
+        EXPECT_EQ("[NULL, NULL, NULL]", chunk->debug_row(3));
+        EXPECT_EQ("['v4', 'server3', 40]", chunk->debug_row(4));
+    }
+
+    // nested jsonpath falls back to extract every path from the object.
+    ranges[0].jsonpaths = R"(["$.k1", "$.attrs.a[2].b", "$.value"])";
+    {
+        auto scanner = create_json_scanner(types, ranges, {"k1", "b", "value"});
+        ASSERT_OK(scanner->open());
+
+        ChunkPtr chunk = scanner->get_next().value();
+        EXPECT_EQ(5, chunk->num_rows());
+        EXPECT_EQ("['v1', 'c', 10]", chunk->debug_row(0));
+        EXPECT_EQ("['v2', NULL, 20]", chunk->debug_row(1));
+        EXPECT_EQ("[NULL, NULL, NULL]", chunk->debug_row(3));
+    }
+}
+
 TEST_F(JsonScannerTest, test_adaptive_nullable_column) {
     std::vector<TypeDescriptor> types;
     types.emplace_back(TypeDescriptor::create_varchar_type(20));
@@ -0,0 +1,182 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/pipeline/select_operator.h"
+
+#include "column/chunk.h"
+#include "column/column_helper.h"
+#include "column/fixed_length_column.h"
+#include "column/nullable_column.h"
+#include "exec/pipeline/query_context.h"
+#include "exprs/binary_predicate.h"
+#include "exprs/column_ref.h"
+#include "exprs/expr_context.h"
+#include "exprs/in_predicate.h"
+#include "exprs/jit/jit_engine.h"
+#include "exprs/literal.h"
+#include "gtest/gtest.h"
+#include "runtime/runtime_state.h"
+#include "testutil/assert.h"
+
+namespace starrocks::pipeline {
+
+class SelectOperatorTest : public testing::Test {
+public:
+    SelectOperatorTest() : _runtime_state(TQueryGlobals()) {}
+
+protected:
+    void SetUp() override { _runtime_state.set_query_ctx(_query_ctx.get()); }
+
+    Expr* create_slot_ref(SlotId slot_id, bool nullable);
+    Expr* create_literal(int32_t value);
+    Expr* create_binary_predicate(TExprOpcode::type opcode, Expr* lhs, Expr* rhs);
+    Expr* create_in_predicate(Expr* lhs, const std::vector<int32_t>& values, bool is_not_in);
+    // c1 > 100 AND c2 IN (1, 3, 5, 7) AND c1 < 3000 AND c2 NOT IN (5, 100, 101, ..., 118)
+    std::vector<ExprContext*> create_conjuncts();
+    // c1 is nullable, null at every 7th row
+    ChunkPtr create_chunk(size_t num_rows);
+    // Filter the chunk by a select operator, `num_conjuncts` is set to the number of conjuncts after prepare.
+    void select(bool enable_jit, const ChunkPtr& chunk, size_t* num_conjuncts);
+
+    ObjectPool _pool;
+    RuntimeState _runtime_state;
+    std::unique_ptr<QueryContext> _query_ctx = std::make_unique<QueryContext>();
+};
+
+Expr* SelectOperatorTest::create_slot_ref(SlotId slot_id, bool nullable) {
+    TExprNode node;
+    node.node_type = TExprNodeType::SLOT_REF;
+    node.type = TypeDescriptor(TYPE_INT).to_thrift();
+    node.is_nullable = nullable;
+    node.slot_ref.slot_id = slot_id;
+    node.slot_ref.tuple_id = 0;
+    return _pool.add(new ColumnRef(node));
+}
+
+Expr* SelectOperatorTest::create_literal(int32_t value) {
+    auto column = ColumnHelper::create_const_column<TYPE_INT>(value, 1);
+    return _pool.add(new VectorizedLiteral(std::move(column), TypeDescriptor(TYPE_INT)));
+}
+
+Expr* SelectOperatorTest::create_binary_predicate(TExprOpcode::type opcode, Expr* lhs, Expr* rhs) {
+    TExprNode node;
+    node.node_type = TExprNodeType::BINARY_PRED;
+    node.__set_opcode(opcode);
+    node.__set_child_type(TPrimitiveType::INT);
+    node.type = TypeDescriptor(TYPE_BOOLEAN).to_thrift();
+    node.is_nullable = lhs->is_nullable() || rhs->is_nullable();
+    node.num_children = 2;
+    auto* expr = _pool.add(VectorizedBinaryPredicateFactory::from_thrift(node));
+    expr->add_child(lhs);
+    expr->add_child(rhs);
+    return expr;
+}
+
+Expr* SelectOperatorTest::create_in_predicate(Expr* lhs, const std::vector<int32_t>& values, bool is_not_in) {
+    TExprNode node;
+    node.node_type = TExprNodeType::IN_PRED;
+    node.__set_opcode(TExprOpcode::FILTER_IN);
+    node.__set_child_type(TPrimitiveType::INT);
+    node.type = TypeDescriptor(TYPE_BOOLEAN).to_thrift();
+    node.is_nullable = lhs->is_nullable();
+    node.num_children = values.size() + 1;
+    node.in_predicate.is_not_in = is_not_in;
+    auto* expr = _pool.add(VectorizedInPredicateFactory::from_thrift(node));
+    expr->add_child(lhs);
+    for (int32_t value : values) {
+        expr->add_child(create_literal(value));
+    }
+    return expr;
+}
+
+std::vector<ExprContext*> SelectOperatorTest::create_conjuncts() {
+    // too many values to be compiled
+    std::vector<int32_t> not_in_values{5};
+    for (int32_t v = 100; v < 119; v++) {
+        not_in_values.emplace_back(v);
+    }
+    std::vector<Expr*> roots{
+            create_binary_predicate(TExprOpcode::GT, create_slot_ref(1, true), create_literal(100)),
+            create_in_predicate(create_slot_ref(2, false), {1, 3, 5, 7}, false),
+            create_binary_predicate(TExprOpcode::LT, create_slot_ref(1, true), create_literal(3000)),
+            create_in_predicate(create_slot_ref(2, false), not_in_values, true),
+    };
+    std::vector<ExprContext*> ctxs;
+    for (auto* root : roots) {
+        ctxs.emplace_back(_pool.add(new ExprContext(root)));
+    }
+    return ctxs;
+}
+
+ChunkPtr SelectOperatorTest::create_chunk(size_t num_rows) {
+    auto c1 = NullableColumn::create(Int32Column::create(), NullColumn::create());
+    auto c2 = Int32Column::create();
+    for (size_t i = 0; i < num_rows; i++) {
+        if (i % 7 == 0) {
+            c1->append_nulls(1);
+        } else {
+            c1->append_datum(Datum(static_cast<int32_t>(i)));
+        }
+        c2->append(static_cast<int32_t>(i % 10));
+    }
+    auto chunk = std::make_shared<Chunk>();
+    chunk->append_column(std::move(c1), 1);
+    chunk->append_column(std::move(c2), 2);
+    return chunk;
+}
+
+void SelectOperatorTest::select(bool enable_jit, const ChunkPtr& chunk, size_t* num_conjuncts) {
+    _runtime_state.set_jit_level(enable_jit ? -1 : 0);
+    SelectOperatorFactory factory(1, 1, create_conjuncts());
+    ASSERT_OK(factory.prepare(&_runtime_state));
+    *num_conjuncts = factory._conjunct_ctxs.size();
+
+    auto op = factory.create(1, 0);
+    ASSERT_OK(op->prepare(&_runtime_state));
+    ASSERT_OK(op->push_chunk(&_runtime_state, chunk));
+    op->close(&_runtime_state);
+    factory.close(&_runtime_state);
+}
+
+TEST_F(SelectOperatorTest, fuse_compilable_conjuncts) {
+    const size_t num_rows = 4096;
+    size_t num_conjuncts = 0;
+
+    auto interpreted = create_chunk(num_rows);
+    ASSERT_NO_FATAL_FAILURE(select(false, interpreted, &num_conjuncts));
+    ASSERT_EQ(4, num_conjuncts);
+
+    auto fused = create_chunk(num_rows);
+    ASSERT_NO_FATAL_FAILURE(select(true, fused, &num_conjuncts));
+    if (JITEngine::get_instance()->support_jit()) {
+        // the compilable ones are fused into one, the long NOT IN list is evaluated after it
+        ASSERT_EQ(2, num_conjuncts);
+    } else {
+        ASSERT_EQ(4, num_conjuncts);
+    }
+
+    size_t expected_rows = 0;
+    for (size_t i = 0; i < num_rows; i++) {
+        if (i % 7 != 0 && i > 100 && i < 3000 && (i % 10 == 1 || i % 10 == 3 || i % 10 == 7)) {
+            expected_rows++;
+        }
+    }
+    ASSERT_EQ(expected_rows, interpreted->num_rows());
+    ASSERT_EQ(interpreted->num_rows(), fused->num_rows());
+    for (size_t i = 0; i < fused->num_rows(); i++) {
+        ASSERT_EQ(interpreted->debug_row(i), fused->debug_row(i));
+    }
+}
+
+} // namespace starrocks::pipeline
@@ -0,0 +1,157 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exprs/cached_expr.h"
+
+#include <gtest/gtest.h>
+
+#include "column/chunk.h"
+#include "column/fixed_length_column.h"
+#include "exprs/column_ref.h"
+#include "exprs/mock_vectorized_expr.h"
+#include "runtime/runtime_state.h"
+#include "testutil/assert.h"
+
+namespace starrocks {
+
+class CountingExpr final : public MockExpr {
+public:
+    CountingExpr(TypeDescriptor type, ColumnPtr col) : MockExpr(std::move(type), std::move(col)) {}
+
+    StatusOr<ColumnPtr> evaluate_checked(ExprContext* context, Chunk* ptr) override {
+        num_evaluations++;
+        return MockExpr::evaluate_checked(context, ptr);
+    }
+
+    int num_evaluations = 0;
+};
+
+class CachedExprTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        auto column = Int32Column::create();
+        for (int32_t i = 0; i < 10; i++) {
+            column->append(i);
+        }
+        _chunk.append_column(column, 1);
+        _result = column->clone_shared();
+        _expr = _pool.add(new CountingExpr(TypeDescriptor(TYPE_INT), _result));
+        // the slots read by the expr
+        _expr->add_child(_pool.add(new ColumnRef(TypeDescriptor(TYPE_INT), 1)));
+    }
+
+protected:
+    RuntimeState _state;
+    ObjectPool _pool;
+    Chunk _chunk;
+    ColumnPtr _result;
+    CountingExpr* _expr = nullptr;
+};
+
+TEST_F(CachedExprTest, reuse_common_expr) {
+    _state.add_common_expr("f");
+    _state.add_common_expr("f");
+    auto* cached1 = CachedExpr::create(&_pool, _expr, "f", &_state);
+    auto* cached2 = CachedExpr::create(&_pool, _expr, "f", &_state);
+
+    ASSIGN_OR_ABORT(auto column1, cached1->evaluate_checked(nullptr, &_chunk));
+    ASSIGN_OR_ABORT(auto column2, cached2->evaluate_checked(nullptr, &_chunk));
+    ASSERT_EQ(1, _expr->num_evaluations);
+    // the cached column is shared without a copy
+    ASSERT_EQ(column1.get(), column2.get());
+    ASSERT_EQ(column1.get(), _chunk.get_cached_expr_column("f", {1}).get());
+
+    // the cached column is filtered with the chunk
+    Filter filter(10, 0);
+    filter[3] = 1;
+    filter[5] = 1;
+    _chunk.filter(filter);
+    ASSIGN_OR_ABORT(auto column3, cached2->evaluate_checked(nullptr, &_chunk));
+    ASSERT_EQ(1, _expr->num_evaluations);
+    ASSERT_EQ(2, column3->size());
+    ASSERT_EQ("3", column3->debug_item(0));
+    ASSERT_EQ("5", column3->debug_item(1));
+    // the result returned before is not changed, the cached column is copied on write
+    ASSERT_EQ(10, column1->size());
+    ASSERT_NE(column1.get(), column3.get());
+
+    // filtered in place once it's not referenced elsewhere
+    auto* cached_column = column3.get();
+    column3.reset();
+    filter.assign(2, 1);
+    filter[0] = 0;
+    _chunk.filter(filter);
+    ASSIGN_OR_ABORT(auto column5, cached1->evaluate_checked(nullptr, &_chunk));
+    ASSERT_EQ(1, _expr->num_evaluations);
+    ASSERT_EQ(cached_column, column5.get());
+    ASSERT_EQ("5", column5->debug_item(0));
+
+    // columns are replaced
+    _chunk.update_column(Int32Column::create(1, 0), 1);
+    ASSERT_OK(cached1->evaluate_checked(nullptr, &_chunk).status());
+    ASSERT_EQ(2, _expr->num_evaluations);
+}
+
+TEST_F(CachedExprTest, not_common_expr) {
+    _state.add_common_expr("f");
+    auto* cached = CachedExpr::create(&_pool, _expr, "f", &_state);
+    ASSERT_OK(cached->evaluate_checked(nullptr, &_chunk).status());
+    ASSERT_OK(cached->evaluate_checked(nullptr, &_chunk).status());
+    ASSERT_EQ(2, _expr->num_evaluations);
+    ASSERT_EQ(nullptr, _chunk.get_cached_expr_column("f", {1}));
+
+    // another occurrence is added by a rewrite after the evaluation started
+    _state.add_common_expr("f");
+    ASSERT_OK(cached->evaluate_checked(nullptr, &_chunk).status());
+    ASSERT_OK(cached->evaluate_checked(nullptr, &_chunk).status());
+    ASSERT_EQ(3, _expr->num_evaluations);
+    ASSERT_NE(nullptr, _chunk.get_cached_expr_column("f", {1}));
+}
+
+TEST_F(CachedExprTest, input_column_changed) {
+    _state.add_common_expr("f");
+    _state.add_common_expr("f");
+    auto* cached = CachedExpr::create(&_pool, _expr, "f", &_state);
+    ASSERT_OK(cached->evaluate_checked(nullptr, &_chunk).status());
+    ASSERT_EQ(1, _expr->num_evaluations);
+
+    // the input column is swapped with one of the same size
+    auto column = Int32Column::create();
+    for (int32_t i = 0; i < 10; i++) {
+        column->append(i * 2);
+    }
+    std::weak_ptr<Column> old_column = _chunk.get_column_by_slot_id(1);
+    _chunk.get_column_by_slot_id(1) = column;
+    // the replaced column is held by the cache, so its address can't be reused by another column
+    ASSERT_FALSE(old_column.expired());
+    ASSERT_EQ(nullptr, _chunk.get_cached_expr_column("f", {1}));
+    ASSERT_OK(cached->evaluate_checked(nullptr, &_chunk).status());
+    ASSERT_EQ(2, _expr->num_evaluations);
+    ASSERT_NE(nullptr, _chunk.get_cached_expr_column("f", {1}));
+    // a missing slot
+    ASSERT_EQ(nullptr, _chunk.get_cached_expr_column("f", {2}));
+}
+
+TEST_F(CachedExprTest, fingerprint) {
+    ColumnRef slot1(TypeDescriptor(TYPE_INT), 1);
+    ColumnRef slot1_copy(TypeDescriptor(TYPE_INT), 1);
+    ColumnRef slot2(TypeDescriptor(TYPE_INT), 2);
+    ASSERT_FALSE(CachedExpr::fingerprint(&slot1).empty());
+    ASSERT_EQ(CachedExpr::fingerprint(&slot1), CachedExpr::fingerprint(&slot1_copy));
+    ASSERT_NE(CachedExpr::fingerprint(&slot1), CachedExpr::fingerprint(&slot2));
+    // unknown exprs
+    ASSERT_TRUE(CachedExpr::fingerprint(_expr).empty());
+}
+
+} // namespace starrocks
@@ -19,7 +19,9 @@
 #include "column/column_helper.h"
 #include "column/fixed_length_column.h"
 #include "exprs/condition_expr.h"
+#include "exprs/exprs_test_helper.h"
 #include "exprs/mock_vectorized_expr.h"
+#include "runtime/runtime_state.h"
 
 namespace starrocks {
 
@@ -48,6 +50,7 @@ public:
     }
 
 private:
+    RuntimeState runtime_state;
     std::vector<TTypeDesc> tttype_desc;
     TExprNode expr_node;
 };
@@ -244,4 +247,27 @@ TEST_F(VectorizedCoalesceExprTest, coalesceConst) {
     }
 }
 
+TEST_F(VectorizedCoalesceExprTest, coalesceJit) {
+    expr_node.type = tttype_desc[0];
+    auto expr = std::unique_ptr<Expr>(VectorizedConditionExprFactory::create_coalesce_expr(expr_node));
+
+    MockNullVectorizedExpr<TYPE_BIGINT> col1(expr_node, 10, 10);
+    MockNullVectorizedExpr<TYPE_BIGINT> col2(expr_node, 10, 20);
+    col2.all_null = true;
+    MockVectorizedExpr<TYPE_BIGINT> col3(expr_node, 10, 30);
+
+    expr->_children.push_back(&col1);
+    expr->_children.push_back(&col2);
+    expr->_children.push_back(&col3);
+
+    ColumnPtr ptr = expr->evaluate(nullptr, nullptr);
+    ExprsTestHelper::verify_with_jit(ptr, expr.get(), &runtime_state, [](ColumnPtr const& ptr) {
+        auto* v = down_cast<Int64Column*>(ColumnHelper::get_data_column(ptr.get()));
+        ASSERT_EQ(10, v->size());
+        for (int j = 0; j < v->size(); ++j) {
+            ASSERT_FALSE(ptr->is_null(j));
+            ASSERT_EQ(j % 2 == 0 ? 10 : 30, v->get_data()[j]);
+        }
+    });
+}
 } // namespace starrocks
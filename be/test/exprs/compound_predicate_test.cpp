@@ -17,10 +17,18 @@
 #include <glog/logging.h>
 #include <gtest/gtest.h>
 
+#include "column/binary_column.h"
+#include "column/chunk.h"
 #include "column/fixed_length_column.h"
+#include "column/nullable_column.h"
+#include "exprs/column_ref.h"
+#include "exprs/expr_context.h"
 #include "exprs/exprs_test_helper.h"
+#include "exprs/function_call_expr.h"
+#include "exprs/literal.h"
 #include "exprs/mock_vectorized_expr.h"
 #include "runtime/runtime_state.h"
+#include "testutil/assert.h"
 
 namespace starrocks {
 
@@ -433,4 +441,106 @@ TEST_F(VectorizedCompoundPredicateTest, testOnlyNullAndZeroRow) {
     }
 }
 
+static Expr* create_pattern_predicate(ObjectPool* pool, const std::string& name, Expr* value, Expr* pattern) {
+    TExprNode node;
+    node.node_type = TExprNodeType::FUNCTION_CALL;
+    node.type = gen_type_desc(TPrimitiveType::BOOLEAN);
+    node.is_nullable = true;
+    node.num_children = 2;
+    TFunction fn;
+    fn.name.__set_function_name(name);
+    fn.__set_binary_type(TFunctionBinaryType::BUILTIN);
+    fn.__set_arg_types({gen_type_desc(TPrimitiveType::VARCHAR), gen_type_desc(TPrimitiveType::VARCHAR)});
+    fn.__set_has_var_args(false);
+    fn.__set_fid(name == "LIKE" ? 60010 : 60020);
+    node.__set_fn(fn);
+    auto* expr = pool->add(new VectorizedFunctionCallExpr(node));
+    expr->add_child(value);
+    expr->add_child(pattern);
+    return expr;
+}
+
+// value LIKE '%ab_d%' OR value REGEXP 'x[0-9]+y' OR value LIKE 'q_r' OR value LIKE 'pre%' OR value REGEXP '^eq$'
+// [OR value LIKE NULL], the first three are batched into one hyperscan database, the others are evaluated one by one.
+TEST_F(VectorizedCompoundPredicateTest, orPatternPredicates) {
+    TExprNode slot_node;
+    slot_node.node_type = TExprNodeType::SLOT_REF;
+    slot_node.type = gen_type_desc(TPrimitiveType::VARCHAR);
+    slot_node.is_nullable = true;
+    slot_node.slot_ref.slot_id = 1;
+    slot_node.slot_ref.tuple_id = 0;
+
+    std::vector<std::string> values = {"xxabcdxx", "x12y", "qxr", "prefix", "eq", "zzz", "", "eq\n", "qxr\n"};
+    auto data = BinaryColumn::create();
+    auto nulls = NullColumn::create();
+    for (const auto& v : values) {
+        data->append(v);
+        nulls->append(0);
+    }
+    data->append_default();
+    nulls->append(1);
+    auto chunk = std::make_shared<Chunk>();
+    chunk->append_column(NullableColumn::create(std::move(data), std::move(nulls)), 1);
+
+    for (bool with_null_pattern : {false, true}) {
+        ObjectPool pool;
+        auto create_pattern = [&](const std::string& pattern) -> Expr* {
+            auto column = ColumnHelper::create_const_column<TYPE_VARCHAR>(Slice(pattern), 1);
+            return pool.add(new VectorizedLiteral(std::move(column), TypeDescriptor::create_varchar_type(10)));
+        };
+        auto create_value = [&]() -> Expr* { return pool.add(new ColumnRef(slot_node)); };
+
+        std::vector<Expr*> leaves = {
+                create_pattern_predicate(&pool, "LIKE", create_value(), create_pattern("%ab_d%")),
+                create_pattern_predicate(&pool, "REGEXP", create_value(), create_pattern("x[0-9]+y")),
+                create_pattern_predicate(&pool, "LIKE", create_value(), create_pattern("q_r")),
+                create_pattern_predicate(&pool, "LIKE", create_value(), create_pattern("pre%")),
+                create_pattern_predicate(&pool, "REGEXP", create_value(), create_pattern("^eq$")),
+        };
+        if (with_null_pattern) {
+            auto* null_pattern = pool.add(new VectorizedLiteral(ColumnHelper::create_const_null_column(1),
+                                                                TypeDescriptor::create_varchar_type(10)));
+            leaves.emplace_back(create_pattern_predicate(&pool, "LIKE", create_value(), null_pattern));
+        }
+
+        TExprNode or_node;
+        or_node.node_type = TExprNodeType::COMPOUND_PRED;
+        or_node.__set_opcode(TExprOpcode::COMPOUND_OR);
+        or_node.type = gen_type_desc(TPrimitiveType::BOOLEAN);
+        or_node.is_nullable = true;
+        or_node.num_children = 2;
+        Expr* root = leaves[0];
+        for (size_t i = 1; i < leaves.size(); i++) {
+            auto* or_expr = pool.add(VectorizedCompoundPredicateFactory::from_thrift(or_node));
+            or_expr->add_child(root);
+            or_expr->add_child(leaves[i]);
+            root = or_expr;
+        }
+
+        ExprContext context(root);
+        ASSERT_OK(context.prepare(&runtime_state));
+        ASSERT_OK(context.open(&runtime_state));
+        ASSIGN_OR_ABORT(ColumnPtr result, context.evaluate(chunk.get()));
+        ASSERT_EQ(values.size() + 1, result->size());
+
+        // "eq\n" and "qxr\n" are not matched, the patterns are anchored at the end of the value.
+        std::vector<bool> expected = {true, true, true, true, true, false, false, false, false};
+        auto* result_data = ColumnHelper::get_data_column(result.get());
+        for (size_t i = 0; i < expected.size(); i++) {
+            if (expected[i]) {
+                ASSERT_FALSE(result->is_null(i)) << i;
+                ASSERT_TRUE(down_cast<BooleanColumn*>(result_data)->get_data()[i]) << i;
+            } else if (with_null_pattern) {
+                // false OR null
+                ASSERT_TRUE(result->is_null(i)) << i;
+            } else {
+                ASSERT_FALSE(result->is_null(i)) << i;
+                ASSERT_FALSE(down_cast<BooleanColumn*>(result_data)->get_data()[i]) << i;
+            }
+        }
+        ASSERT_TRUE(result->is_null(expected.size()));
+        context.close(&runtime_state);
+    }
+}
+
 } // namespace starrocks
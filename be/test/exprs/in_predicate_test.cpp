@@ -21,7 +21,10 @@
 #include "column/binary_column.h"
 #include "column/column_helper.h"
 #include "column/fixed_length_column.h"
+#include "exprs/exprs_test_helper.h"
+#include "exprs/literal.h"
 #include "exprs/mock_vectorized_expr.h"
+#include "runtime/runtime_state.h"
 
 namespace starrocks {
 
@@ -479,4 +482,63 @@ TEST_F(VectorizedInPredicateTest, inArrayConstAllNULL) {
     }
 }
 
+TEST_F(VectorizedInPredicateTest, intInJit) {
+    TExprNode lhs_node;
+    lhs_node.node_type = TExprNodeType::SLOT_REF;
+    lhs_node.type = gen_type_desc(TPrimitiveType::INT);
+    lhs_node.is_nullable = true;
+    // 0, 1, ..., 9 with nulls at row 4 and 9
+    auto data = Int32Column::create();
+    auto nulls = NullColumn::create();
+    for (int j = 0; j < 10; j++) {
+        data->append(j);
+        nulls->append(j % 5 == 4);
+    }
+    MockColumnExpr lhs(lhs_node, NullableColumn::create(std::move(data), std::move(nulls)));
+
+    TypeDescriptor int_type(TYPE_INT);
+    std::vector<std::unique_ptr<Expr>> literals;
+    for (int v : {1, 3, 4}) {
+        literals.emplace_back(new VectorizedLiteral(ColumnHelper::create_const_column<TYPE_INT>(v, 1), int_type));
+    }
+    // a typed null literal, which is compiled as well
+    auto null_literal = std::make_unique<VectorizedLiteral>(ColumnHelper::create_const_null_column(1), int_type);
+
+    RuntimeState runtime_state;
+    for (bool not_in : is_not_in) {
+        for (bool with_null : {false, true}) {
+            expr_node.child_type = TPrimitiveType::INT;
+            expr_node.opcode = TExprOpcode::FILTER_IN;
+            expr_node.type = gen_type_desc(TPrimitiveType::BOOLEAN);
+            expr_node.is_nullable = true;
+            expr_node.in_predicate.is_not_in = not_in;
+            auto expr = std::unique_ptr<Expr>(VectorizedInPredicateFactory::from_thrift(expr_node));
+            expr->_children.push_back(&lhs);
+            for (auto& literal : literals) {
+                expr->_children.push_back(literal.get());
+            }
+            if (with_null) {
+                expr->_children.push_back(null_literal.get());
+            }
+            ASSERT_TRUE(expr->prepare(nullptr, nullptr).ok());
+            ASSERT_TRUE(expr->open(nullptr, nullptr, FunctionContext::FunctionStateScope::FRAGMENT_LOCAL).ok());
+
+            ColumnPtr ptr = expr->evaluate(nullptr, nullptr);
+            ExprsTestHelper::verify_with_jit(ptr, expr.get(), &runtime_state, [&](ColumnPtr const& ptr) {
+                ASSERT_EQ(10, ptr->size());
+                auto* v = down_cast<BooleanColumn*>(ColumnHelper::get_data_column(ptr.get()));
+                for (int j = 0; j < 10; ++j) {
+                    // row 4 is null even though 4 is in the list
+                    bool lhs_null = j % 5 == 4;
+                    bool match = j == 1 || j == 3;
+                    ASSERT_EQ(lhs_null || (!match && with_null), ptr->is_null(j)) << j;
+                    if (!ptr->is_null(j)) {
+                        ASSERT_EQ(match != not_in, v->get_data()[j]) << j;
+                    }
+                }
+            });
+        }
+    }
+}
+
 } // namespace starrocks
@@ -22,7 +22,9 @@
 #include "column/chunk.h"
 #include "column/column_helper.h"
 #include "column/fixed_length_column.h"
+#include "exprs/exprs_test_helper.h"
 #include "exprs/mock_vectorized_expr.h"
+#include "runtime/runtime_state.h"
 
 namespace starrocks {
 
@@ -39,6 +41,7 @@ public:
     }
 
 public:
+    RuntimeState runtime_state;
     TExprNode expr_node;
 };
 
@@ -191,4 +194,24 @@ TEST_F(VectorizedIsNullExprTest, isNotNullTest) {
         ASSERT_TRUE(v);
     }
 }
+TEST_F(VectorizedIsNullExprTest, isNullJitTest) {
+    for (auto name : {"is_null_pred", "is_not_null_pred"}) {
+        expr_node.fn.name.function_name = name;
+        auto expr = std::unique_ptr<Expr>(VectorizedIsNullPredicateFactory::from_thrift(expr_node));
+        expr->set_type(TypeDescriptor(TYPE_BOOLEAN));
+
+        MockNullVectorizedExpr<TYPE_BIGINT> col1(expr_node, 10, 10);
+        expr->_children.push_back(&col1);
+
+        bool is_null = expr_node.fn.name.function_name == "is_null_pred";
+        ColumnPtr ptr = expr->evaluate(nullptr, nullptr);
+        ExprsTestHelper::verify_with_jit(ptr, expr.get(), &runtime_state, [is_null](ColumnPtr const& ptr) {
+            auto* v = down_cast<BooleanColumn*>(ColumnHelper::get_data_column(ptr.get()));
+            ASSERT_EQ(10, v->size());
+            for (int j = 0; j < v->size(); ++j) {
+                ASSERT_EQ(is_null == (j % 2 == 1), v->get_data()[j]);
+            }
+        });
+    }
+}
 } // namespace starrocks
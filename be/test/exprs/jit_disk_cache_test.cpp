@@ -0,0 +1,112 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exprs/jit/jit_disk_cache.h"
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include <filesystem>
+
+#include "fs/fs_util.h"
+#include "testutil/assert.h"
+
+namespace starrocks {
+
+class JitDiskCacheTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        _test_dir = fmt::format("{}/jit_disk_cache_test", std::filesystem::current_path().string());
+        (void)fs::remove_all(_test_dir);
+    }
+
+    void TearDown() override { (void)fs::remove_all(_test_dir); }
+
+protected:
+    std::string _test_dir;
+};
+
+TEST_F(JitDiskCacheTest, key) {
+    JitDiskCache cache(_test_dir, 1024);
+    auto key = cache.make_key("define void @f() { ret void }");
+    ASSERT_EQ(key, cache.make_key("define void @f() { ret void }"));
+    ASSERT_NE(key, cache.make_key("define void @g() { ret void }"));
+    // hex of sha256
+    ASSERT_EQ(64, key.size());
+}
+
+TEST_F(JitDiskCacheTest, insert_and_lookup) {
+    JitDiskCache cache(_test_dir, 1024);
+    ASSERT_OK(cache.init());
+    ASSERT_TRUE(cache.lookup("k1").status().is_not_found());
+
+    ASSERT_OK(cache.insert("k1", Slice("object1")));
+    ASSIGN_OR_ABORT(auto object, cache.lookup("k1"));
+    ASSERT_EQ("object1", object);
+    ASSERT_EQ(1, cache.num_objects());
+    ASSERT_EQ(7, cache.usage());
+    ASSERT_EQ(1, cache.hit_count());
+    ASSERT_EQ(1, cache.miss_count());
+
+    // overwrite
+    ASSERT_OK(cache.insert("k1", Slice("obj")));
+    ASSIGN_OR_ABORT(object, cache.lookup("k1"));
+    ASSERT_EQ("obj", object);
+    ASSERT_EQ(3, cache.usage());
+}
+
+TEST_F(JitDiskCacheTest, evict) {
+    JitDiskCache cache(_test_dir, 20);
+    ASSERT_OK(cache.init());
+    ASSERT_OK(cache.insert("k1", Slice("0123456789")));
+    ASSERT_OK(cache.insert("k2", Slice("0123456789")));
+    // k1 is the most recently used
+    ASSERT_OK(cache.lookup("k1").status());
+    ASSERT_OK(cache.insert("k3", Slice("0123456789")));
+    ASSERT_EQ(2, cache.num_objects());
+    ASSERT_TRUE(cache.lookup("k2").status().is_not_found());
+    ASSERT_FALSE(fs::path_exist(_test_dir + "/k2" + JitDiskCache::OBJECT_SUFFIX));
+    ASSERT_OK(cache.lookup("k1").status());
+    ASSERT_OK(cache.lookup("k3").status());
+
+    cache.set_capacity(10);
+    ASSERT_EQ(1, cache.num_objects());
+    ASSERT_EQ(10, cache.usage());
+}
+
+TEST_F(JitDiskCacheTest, reload) {
+    {
+        JitDiskCache cache(_test_dir, 1024);
+        ASSERT_OK(cache.init());
+        ASSERT_OK(cache.insert("k1", Slice("object1")));
+        ASSERT_OK(cache.insert("k2", Slice("object2")));
+    }
+    // a temporary file left by crash and an unrelated file.
+    ASSIGN_OR_ABORT(auto tmp_file, fs::new_writable_file(_test_dir + "/k3.o.tmp0"));
+    ASSERT_OK(tmp_file->append(Slice("obj")));
+    ASSERT_OK(tmp_file->close());
+    ASSIGN_OR_ABORT(auto other_file, fs::new_writable_file(_test_dir + "/README"));
+    ASSERT_OK(other_file->close());
+
+    JitDiskCache cache(_test_dir, 1024);
+    ASSERT_OK(cache.init());
+    ASSERT_EQ(2, cache.num_objects());
+    ASSERT_EQ(14, cache.usage());
+    ASSIGN_OR_ABORT(auto object, cache.lookup("k2"));
+    ASSERT_EQ("object2", object);
+    ASSERT_FALSE(fs::path_exist(_test_dir + "/k3.o.tmp0"));
+    ASSERT_TRUE(fs::path_exist(_test_dir + "/README"));
+}
+
+} // namespace starrocks
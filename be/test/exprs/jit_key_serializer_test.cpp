@@ -0,0 +1,138 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exprs/jit/jit_key_serializer.h"
+
+#include <gtest/gtest.h>
+
+#include "column/column_helper.h"
+#include "column/fixed_length_column.h"
+#include "column/nullable_column.h"
+#include "exprs/jit/jit_engine.h"
+#include "testutil/assert.h"
+
+namespace starrocks {
+
+class JITKeySerializerTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        if (!JITEngine::get_instance()->support_jit()) {
+            GTEST_SKIP() << "JIT is not supported";
+        }
+        auto c0 = Int32Column::create();
+        auto c1 = NullableColumn::create(Int64Column::create(), NullColumn::create());
+        auto c2 = Int16Column::create();
+        for (int i = 0; i < NUM_ROWS; i++) {
+            c0->append(i);
+            if (i % 3 == 0) {
+                c1->append_nulls(1);
+            } else {
+                c1->append_datum(Datum(int64_t(i * 1000)));
+            }
+            c2->append(static_cast<int16_t>(-i));
+        }
+        _columns = {c0, c1, c2};
+    }
+
+    // Serialize rows [start, start + count) by columns in row format.
+    std::vector<Slice> serialize_by_columns(size_t start, size_t count, std::vector<uint8_t>* buffer) {
+        buffer->resize(count * MAX_ROW_SIZE);
+        std::vector<Slice> keys;
+        for (size_t i = 0; i < count; i++) {
+            uint8_t* pos = buffer->data() + i * MAX_ROW_SIZE;
+            size_t size = 0;
+            for (const auto& column : _columns) {
+                size += column->serialize(start + i, pos + size);
+            }
+            keys.emplace_back(pos, size);
+        }
+        return keys;
+    }
+
+protected:
+    static constexpr int NUM_ROWS = 100;
+    // 4 + (1 + 8) + 2
+    static constexpr uint32_t MAX_ROW_SIZE = 15;
+    Columns _columns;
+};
+
+TEST_F(JITKeySerializerTest, schema_name) {
+    ASSERT_EQ("key_serialize{4,n8,2,}", JITKeySerializer::schema_name(_columns));
+
+    Columns columns = _columns;
+    columns.emplace_back(BinaryColumn::create());
+    ASSERT_EQ("", JITKeySerializer::schema_name(columns));
+
+    columns = _columns;
+    columns.emplace_back(ColumnHelper::create_const_column<TYPE_INT>(1, NUM_ROWS));
+    ASSERT_EQ("", JITKeySerializer::schema_name(columns));
+    ASSERT_FALSE(JITKeySerializer::create(columns).ok());
+}
+
+TEST_F(JITKeySerializerTest, serialize_packed) {
+    ASSIGN_OR_ABORT(auto serializer, JITKeySerializer::create(_columns));
+
+    const size_t start = 7;
+    const size_t count = 60;
+    std::vector<uint8_t> expected_buffer;
+    auto expected = serialize_by_columns(start, count, &expected_buffer);
+
+    std::vector<uint8_t> buffer(count * MAX_ROW_SIZE);
+    std::vector<uint32_t> sizes(count);
+    serializer->serialize(_columns, start, count, buffer.data(), 0, sizes.data());
+    size_t offset = 0;
+    for (size_t i = 0; i < count; i++) {
+        ASSERT_EQ(expected[i], Slice(buffer.data() + offset, sizes[i])) << i;
+        offset += sizes[i];
+    }
+}
+
+TEST_F(JITKeySerializerTest, serialize_stride) {
+    ASSIGN_OR_ABORT(auto serializer, JITKeySerializer::create(_columns));
+
+    std::vector<uint8_t> expected_buffer;
+    auto expected = serialize_by_columns(0, NUM_ROWS, &expected_buffer);
+
+    std::vector<uint8_t> buffer(NUM_ROWS * MAX_ROW_SIZE);
+    std::vector<uint32_t> sizes(NUM_ROWS);
+    serializer->serialize(_columns, 0, NUM_ROWS, buffer.data(), MAX_ROW_SIZE, sizes.data());
+    for (size_t i = 0; i < NUM_ROWS; i++) {
+        ASSERT_EQ(expected[i], Slice(buffer.data() + i * MAX_ROW_SIZE, sizes[i])) << i;
+    }
+}
+
+TEST_F(JITKeySerializerTest, prepare) {
+    std::shared_ptr<JITKeySerializer> holder;
+    // compiled by the compile pool, keys are serialized by columns until it's ready.
+    JITKeySerializer::prepare(_columns, &holder);
+    ASSERT_TRUE(holder != nullptr);
+    JITEngine::get_instance()->compile_pool()->wait();
+    ASSERT_TRUE(holder->is_ready());
+    const auto* serializer = JITKeySerializer::prepare(_columns, &holder);
+    ASSERT_EQ(holder.get(), serializer);
+    ASSERT_EQ(serializer, JITKeySerializer::prepare(_columns, &holder));
+
+    // the schema is changed.
+    Columns columns = {_columns[0], _columns[2]};
+    JITKeySerializer::prepare(columns, &holder);
+    JITEngine::get_instance()->compile_pool()->wait();
+    const auto* other = JITKeySerializer::prepare(columns, &holder);
+    ASSERT_TRUE(other != nullptr);
+    ASSERT_EQ("key_serialize{4,2,}", other->name());
+
+    columns.emplace_back(BinaryColumn::create());
+    ASSERT_TRUE(JITKeySerializer::prepare(columns, &holder) == nullptr);
+}
+
+} // namespace starrocks
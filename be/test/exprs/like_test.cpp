@@ -658,4 +658,72 @@ TEST_F(LikeTest, constValueLikeComplicateForHyperscan) {
                         .ok());
 }
 
+TEST_F(LikeTest, extractLikeLiteral) {
+    ASSERT_EQ("abc", LikePredicate::extract_like_literal("%abc%"));
+    ASSERT_EQ("world", LikePredicate::extract_like_literal("he_lo%world%x"));
+    ASSERT_EQ("a%bc", LikePredicate::extract_like_literal("%a\\%bc_"));
+    ASSERT_EQ("", LikePredicate::extract_like_literal("%_%"));
+}
+
+TEST_F(LikeTest, extractRegexLiteral) {
+    ASSERT_EQ("hello", LikePredicate::extract_regex_literal("^hello.*wor"));
+    ASSERT_EQ("a.b", LikePredicate::extract_regex_literal("[0-9]+a\\.b$"));
+    // the quantified atom is optional
+    ASSERT_EQ("abc", LikePredicate::extract_regex_literal("abcd?e"));
+    ASSERT_EQ("ab", LikePredicate::extract_regex_literal("abc{2,3}"));
+    ASSERT_EQ("", LikePredicate::extract_regex_literal("abc|def"));
+    ASSERT_EQ("", LikePredicate::extract_regex_literal("(?i)abc"));
+    ASSERT_EQ("", LikePredicate::extract_regex_literal("\\dabc"));
+    ASSERT_EQ("", LikePredicate::extract_regex_literal("abc[de"));
+}
+
+TEST_F(LikeTest, searchSubstring) {
+    auto str = BinaryColumn::create();
+    std::vector<std::string> values = {"abc", "xxab", "cab", "", "ab", "xabcab", "a"};
+    for (const auto& v : values) {
+        str->append(v);
+    }
+    std::vector<uint8_t> matched(values.size(), 2);
+    LikePredicate::search_substring(*str, "ab", matched.data());
+    std::vector<uint8_t> expected = {1, 1, 1, 0, 1, 1, 0};
+    ASSERT_EQ(expected, matched);
+
+    // an occurrence across the boundary of two strings
+    std::fill(matched.begin(), matched.end(), 2);
+    LikePredicate::search_substring(*str, "cx", matched.data());
+    ASSERT_EQ(std::vector<uint8_t>(values.size(), 0), matched);
+}
+
+TEST_F(LikeTest, multiPatternMatcher) {
+    auto str = BinaryColumn::create();
+    auto null = NullColumn::create();
+    std::vector<std::string> values = {"hello", "world", "shell", "", "hello world", "abc"};
+    for (const auto& v : values) {
+        str->append(v);
+        null->append(0);
+    }
+    str->append_default();
+    null->append(1);
+    auto column = NullableColumn::create(str, null);
+
+    std::vector<std::string> regexes = {LikePredicate::like_to_regex("hel%"), LikePredicate::like_to_regex("%orl_"),
+                                        "^ab"};
+    auto matcher = LikeMultiPatternMatcher::create(regexes);
+    ASSERT_TRUE(matcher.ok());
+    ASSERT_EQ(3, matcher.value()->num_patterns());
+
+    auto result = matcher.value()->match_any(column);
+    ASSERT_TRUE(result.ok());
+    auto v = ColumnHelper::as_column<NullableColumn>(result.value());
+    auto data = ColumnHelper::cast_to<TYPE_BOOLEAN>(v->data_column());
+    std::vector<bool> expected = {true, true, false, false, true, true};
+    for (size_t i = 0; i < expected.size(); ++i) {
+        ASSERT_FALSE(v->is_null(i));
+        ASSERT_EQ(expected[i], (bool)data->get_data()[i]) << i;
+    }
+    ASSERT_TRUE(v->is_null(expected.size()));
+
+    ASSERT_FALSE(LikeMultiPatternMatcher::create({"(abc"}).ok());
+}
+
 } // namespace starrocks
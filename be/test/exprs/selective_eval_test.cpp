@@ -0,0 +1,277 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+#include "column/chunk.h"
+#include "column/column_helper.h"
+#include "column/fixed_length_column.h"
+#include "column/nullable_column.h"
+#include "common/config.h"
+#include "exec/exec_node.h"
+#include "exprs/column_ref.h"
+#include "exprs/expr.h"
+#include "exprs/expr_context.h"
+#include "runtime/runtime_state.h"
+#include "simd/simd.h"
+#include "testutil/assert.h"
+
+namespace starrocks {
+
+// returns the column of its child, and records the number of rows evaluated. It's a function call unless
+// `costly` is false.
+class IdentityExpr final : public Expr {
+public:
+    explicit IdentityExpr(Expr* child, bool costly = true) : Expr(TypeDescriptor(TYPE_INT), false) {
+        if (costly) {
+            _node_type = TExprNodeType::FUNCTION_CALL;
+        }
+        add_child(child);
+    }
+
+    Expr* clone(ObjectPool* pool) const override { return pool->add(new IdentityExpr(*this)); }
+
+    StatusOr<ColumnPtr> evaluate_checked(ExprContext* context, Chunk* ptr) override {
+        ASSIGN_OR_RETURN(auto column, _children[0]->evaluate_checked(context, ptr));
+        num_evaluated_rows += column->size();
+        return column->clone_shared();
+    }
+
+    size_t num_evaluated_rows = 0;
+};
+
+// function call `child % divisor == 0`, null if the child is null. It records the rows it evaluated.
+class ModPredicate final : public Expr {
+public:
+    ModPredicate(Expr* child, int32_t divisor) : Expr(TypeDescriptor(TYPE_BOOLEAN), false), _divisor(divisor) {
+        _node_type = TExprNodeType::FUNCTION_CALL;
+        add_child(child);
+    }
+
+    Expr* clone(ObjectPool* pool) const override { return pool->add(new ModPredicate(*this)); }
+
+    StatusOr<ColumnPtr> evaluate_checked(ExprContext* context, Chunk* ptr) override {
+        ASSIGN_OR_RETURN(auto column, _children[0]->evaluate_checked(context, ptr));
+        auto result = NullableColumn::create(BooleanColumn::create(), NullColumn::create());
+        for (size_t i = 0; i < column->size(); i++) {
+            auto datum = column->get(i);
+            if (datum.is_null()) {
+                result->append_nulls(1);
+                continue;
+            }
+            int32_t value = datum.get_int32();
+            evaluated_values.emplace_back(value);
+            result->append_datum(Datum(static_cast<uint8_t>(value % _divisor == 0)));
+        }
+        num_evaluated_rows += column->size();
+        return result;
+    }
+
+    size_t num_evaluated_rows = 0;
+    // the values of the non-null rows evaluated
+    std::vector<int32_t> evaluated_values;
+
+private:
+    int32_t _divisor;
+};
+
+class SelectiveEvalTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        auto column = Int32Column::create();
+        for (int32_t i = 0; i < 10; i++) {
+            column->append(i);
+        }
+        _chunk.append_column(column, 1);
+        _expr = _pool.add(new IdentityExpr(_pool.add(new ColumnRef(TypeDescriptor(TYPE_INT), 1))));
+        _ratio = config::selective_eval_max_selected_ratio;
+        config::selective_eval_max_selected_ratio = 0.5;
+    }
+
+    void TearDown() override { config::selective_eval_max_selected_ratio = _ratio; }
+
+protected:
+    double _ratio = 0;
+    ObjectPool _pool;
+    Chunk _chunk;
+    IdentityExpr* _expr = nullptr;
+};
+
+TEST_F(SelectiveEvalTest, sparse_filter) {
+    Filter filter(10, 0);
+    filter[2] = 1;
+    filter[7] = 1;
+    ASSIGN_OR_ABORT(auto column, _expr->evaluate_with_filter(nullptr, &_chunk, filter.data()));
+    ASSERT_EQ(2, _expr->num_evaluated_rows);
+    ASSERT_EQ(10, column->size());
+    ASSERT_EQ("2", column->debug_item(2));
+    ASSERT_EQ("7", column->debug_item(7));
+}
+
+TEST_F(SelectiveEvalTest, cheap_expr) {
+    auto* expr = _pool.add(new IdentityExpr(_pool.add(new ColumnRef(TypeDescriptor(TYPE_INT), 1)), false));
+    Filter filter(10, 0);
+    filter[2] = 1;
+    ASSIGN_OR_ABORT(auto column, expr->evaluate_with_filter(nullptr, &_chunk, filter.data()));
+    ASSERT_EQ(10, expr->num_evaluated_rows);
+    ASSERT_EQ("2", column->debug_item(2));
+}
+
+TEST_F(SelectiveEvalTest, disabled_by_default) {
+    config::selective_eval_max_selected_ratio = _ratio;
+    Filter filter(10, 0);
+    filter[2] = 1;
+    ASSERT_OK(_expr->evaluate_with_filter(nullptr, &_chunk, filter.data()).status());
+    ASSERT_EQ(10, _expr->num_evaluated_rows);
+}
+
+TEST_F(SelectiveEvalTest, dense_filter) {
+    Filter filter(10, 1);
+    filter[2] = 0;
+    ASSIGN_OR_ABORT(auto column, _expr->evaluate_with_filter(nullptr, &_chunk, filter.data()));
+    ASSERT_EQ(10, _expr->num_evaluated_rows);
+    ASSERT_EQ(10, column->size());
+    for (size_t i = 0; i < 10; i++) {
+        ASSERT_EQ(std::to_string(i), column->debug_item(i));
+    }
+}
+
+class SelectiveEvalConjunctsTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        // c1 % 4 = 0 AND c1 % 3 = 0 AND c2 % 3 = 0
+        _conjuncts = {
+                _pool.add(new ModPredicate(_pool.add(new ColumnRef(TypeDescriptor(TYPE_INT), 1)), 4)),
+                _pool.add(new ModPredicate(_pool.add(new ColumnRef(TypeDescriptor(TYPE_INT), 1)), 3)),
+                _pool.add(new ModPredicate(_pool.add(new ColumnRef(TypeDescriptor(TYPE_INT), 2)), 3)),
+        };
+        for (auto* conjunct : _conjuncts) {
+            auto* ctx = _pool.add(new ExprContext(conjunct));
+            ASSERT_OK(ctx->prepare(&_state));
+            ASSERT_OK(ctx->open(&_state));
+            _ctxs.emplace_back(ctx);
+        }
+        _ratio = config::selective_eval_max_selected_ratio;
+        config::selective_eval_max_selected_ratio = 0.5;
+    }
+
+    void TearDown() override { config::selective_eval_max_selected_ratio = _ratio; }
+
+protected:
+    // c1 is nullable, 0..99 and null at every 10th row, c2 is a constant 3.
+    ChunkPtr create_chunk() {
+        auto c1 = NullableColumn::create(Int32Column::create(), NullColumn::create());
+        for (size_t i = 0; i < kNumRows; i++) {
+            if (i % 10 == 0) {
+                c1->append_nulls(1);
+            } else {
+                c1->append_datum(Datum(static_cast<int32_t>(i)));
+            }
+        }
+        auto chunk = std::make_shared<Chunk>();
+        chunk->append_column(std::move(c1), 1);
+        chunk->append_column(ColumnHelper::create_const_column<TYPE_INT>(3, kNumRows), 2);
+        return chunk;
+    }
+
+    ModPredicate* conjunct(size_t i) { return down_cast<ModPredicate*>(_conjuncts[i]); }
+
+    // c1 of the rows selected by the conjuncts
+    static std::vector<int32_t> expected_values() {
+        std::vector<int32_t> values;
+        for (size_t i = 0; i < kNumRows; i++) {
+            if (i % 10 != 0 && i % 12 == 0) {
+                values.emplace_back(static_cast<int32_t>(i));
+            }
+        }
+        return values;
+    }
+
+    // The conjuncts after the first one only see the rows selected by the previous ones.
+    void check_evaluated_rows() {
+        ASSERT_EQ(kNumRows, conjunct(0)->num_evaluated_rows);
+        // 4, 8, ..., 96 except the nulls
+        ASSERT_EQ(20, conjunct(1)->num_evaluated_rows);
+        for (int32_t value : conjunct(1)->evaluated_values) {
+            ASSERT_EQ(0, value % 4);
+        }
+        ASSERT_EQ(expected_values().size(), conjunct(2)->num_evaluated_rows);
+    }
+
+    static constexpr size_t kNumRows = 100;
+
+    double _ratio = 0;
+    RuntimeState _state;
+    ObjectPool _pool;
+    std::vector<Expr*> _conjuncts;
+    std::vector<ExprContext*> _ctxs;
+};
+
+TEST_F(SelectiveEvalConjunctsTest, eval_conjuncts) {
+    auto chunk = create_chunk();
+    FilterPtr filter;
+    ASSERT_OK(ExecNode::eval_conjuncts(_ctxs, chunk.get(), &filter));
+    ASSERT_NO_FATAL_FAILURE(check_evaluated_rows());
+
+    auto expected = expected_values();
+    ASSERT_EQ(expected.size(), chunk->num_rows());
+    for (size_t i = 0; i < expected.size(); i++) {
+        ASSERT_EQ(std::to_string(expected[i]), chunk->get_column_by_slot_id(1)->debug_item(i));
+        ASSERT_EQ("3", chunk->get_column_by_slot_id(2)->debug_item(i));
+    }
+    ASSERT_EQ(expected.size(), SIMD::count_nonzero(*filter));
+}
+
+TEST_F(SelectiveEvalConjunctsTest, eager_prune_eval_conjuncts) {
+    auto chunk = create_chunk();
+    ASSERT_OK(ExecNode::eval_conjuncts(_ctxs, chunk.get()));
+    ASSERT_NO_FATAL_FAILURE(check_evaluated_rows());
+
+    auto expected = expected_values();
+    ASSERT_EQ(expected.size(), chunk->num_rows());
+    for (size_t i = 0; i < expected.size(); i++) {
+        ASSERT_EQ(std::to_string(expected[i]), chunk->get_column_by_slot_id(1)->debug_item(i));
+    }
+}
+
+TEST_F(SelectiveEvalConjunctsTest, eval_conjuncts_into_filter) {
+    auto chunk = create_chunk();
+    Filter filter(kNumRows, 1);
+    ASSIGN_OR_ABORT(auto num_selected, ExecNode::eval_conjuncts_into_filter(_ctxs, chunk.get(), &filter));
+    ASSERT_NO_FATAL_FAILURE(check_evaluated_rows());
+
+    auto expected = expected_values();
+    ASSERT_EQ(expected.size(), num_selected);
+    ASSERT_EQ(kNumRows, chunk->num_rows());
+    for (size_t i = 0; i < kNumRows; i++) {
+        bool selected = std::find(expected.begin(), expected.end(), static_cast<int32_t>(i)) != expected.end();
+        ASSERT_EQ(selected, filter[i] != 0);
+    }
+}
+
+TEST_F(SelectiveEvalConjunctsTest, disabled) {
+    config::selective_eval_max_selected_ratio = 0;
+
+    auto chunk = create_chunk();
+    FilterPtr filter;
+    ASSERT_OK(ExecNode::eval_conjuncts(_ctxs, chunk.get(), &filter));
+    for (auto* conjunct : _conjuncts) {
+        ASSERT_EQ(kNumRows, down_cast<ModPredicate*>(conjunct)->num_evaluated_rows);
+    }
+    ASSERT_EQ(expected_values().size(), chunk->num_rows());
+}
+
+} // namespace starrocks
@@ -0,0 +1,153 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "formats/csv/csv_reader.h"
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+namespace starrocks {
+
+class StringCSVReader : public CSVReader {
+public:
+    StringCSVReader(const CSVParseOptions& parse_options, std::string data)
+            : CSVReader(parse_options), _data(std::move(data)) {}
+
+protected:
+    Status _fill_buffer() override {
+        size_t size = std::min(_buff.free_space(), _data.size() - _offset);
+        memcpy(_buff.limit(), _data.data() + _offset, size);
+        _buff.add_limit(size);
+        _offset += size;
+        // same as ScannerCSVReader, add the missing row delimiter at the end of data.
+        if (size == 0) {
+            size_t n = _buff.available();
+            if (n < _row_delimiter_length ||
+                _buff.find(_parse_options.row_delimiter, n - _row_delimiter_length) == nullptr) {
+                for (char ch : _parse_options.row_delimiter) {
+                    _buff.append(ch);
+                }
+            }
+            if (n == 0) {
+                _buff.skip(_row_delimiter_length);
+                return Status::EndOfFile("end of string");
+            }
+        }
+        return Status::OK();
+    }
+
+    char* _find_line_delimiter(CSVBuffer& buffer, size_t pos) override {
+        return buffer.find(_parse_options.row_delimiter, pos);
+    }
+
+private:
+    std::string _data;
+    size_t _offset = 0;
+};
+
+class CSVReaderTest : public ::testing::Test {
+protected:
+    static std::vector<std::string> _read_row(StringCSVReader* reader) {
+        CSVRow row;
+        auto st = reader->next_record(row);
+        EXPECT_TRUE(st.ok()) << st;
+        std::vector<std::string> columns;
+        for (const auto& column : row.columns) {
+            const char* base = column.is_escaped_column ? reader->escapeDataPtr() : reader->buffBasePtr();
+            columns.emplace_back(base + column.start_pos, column.length);
+        }
+        return columns;
+    }
+};
+
+TEST_F(CSVReaderTest, test_special_char_finder) {
+    std::mt19937 rng(42);
+    std::string data(1000, 'a');
+    for (auto& c : data) {
+        // sparse special characters
+        c = (rng() % 50 == 0) ? ",\n\"\\"[rng() % 4] : 'a' + rng() % 26;
+    }
+    CSVSpecialCharFinder finder(',', '\n', '"', '\\');
+    for (size_t i = 0; i + CSVSpecialCharFinder::kBlockSize <= data.size(); i += 7) {
+        uint64_t mask = finder.bitmap(data.data() + i);
+        for (size_t j = 0; j < CSVSpecialCharFinder::kBlockSize; j++) {
+            char c = data[i + j];
+            bool expected = c == ',' || c == '\n' || c == '"' || c == '\\';
+            ASSERT_EQ(expected, ((mask >> j) & 1) == 1) << i << " " << j;
+        }
+    }
+    for (size_t i = 0; i < data.size(); i += 3) {
+        size_t expected = data.find_first_of(",\n\"\\", i);
+        expected = expected == std::string::npos ? data.size() - i : expected - i;
+        ASSERT_EQ(expected, finder.find_first(data.data() + i, data.size() - i));
+    }
+}
+
+TEST_F(CSVReaderTest, test_split_long_record) {
+    std::vector<std::string> expected;
+    std::string record;
+    for (int i = 0; i < 100; i++) {
+        expected.emplace_back(std::string(i % 7, 'x') + std::to_string(i));
+        record += expected.back();
+        if (i != 99) {
+            record += '|';
+        }
+    }
+    StringCSVReader reader(CSVParseOptions("\n", "|"), "");
+    CSVReader::Fields fields;
+    reader.split_record(Slice(record), &fields);
+    ASSERT_EQ(expected.size(), fields.size());
+    for (size_t i = 0; i < expected.size(); i++) {
+        ASSERT_EQ(expected[i], fields[i].to_string());
+    }
+
+    // empty columns
+    fields.clear();
+    std::string delimiters(100, '|');
+    reader.split_record(Slice(delimiters), &fields);
+    ASSERT_EQ(101, fields.size());
+    for (const auto& field : fields) {
+        ASSERT_EQ(0, field.size);
+    }
+}
+
+TEST_F(CSVReaderTest, test_enclose_and_escape_long_columns) {
+    std::string long_value(200, 'v');
+    std::string data;
+    // enclosed column contains column delimiter, row delimiter and escaped enclose.
+    data += "\"" + long_value + ",\n" + long_value + "\"\"end\"," + long_value + "\n";
+    // escape in ordinary column
+    data += long_value + "\\," + long_value + ",tail\n";
+    data += "a,b";
+
+    StringCSVReader reader(CSVParseOptions("\n", ",", 0, false, '\\', '"'), data);
+
+    auto row = _read_row(&reader);
+    ASSERT_EQ(2, row.size());
+    ASSERT_EQ(long_value + ",\n" + long_value + "\"end", row[0]);
+    ASSERT_EQ(long_value, row[1]);
+
+    row = _read_row(&reader);
+    ASSERT_EQ(2, row.size());
+    ASSERT_EQ(long_value + "," + long_value, row[0]);
+    ASSERT_EQ("tail", row[1]);
+
+    row = _read_row(&reader);
+    ASSERT_EQ(2, row.size());
+    ASSERT_EQ("a", row[0]);
+    ASSERT_EQ("b", row[1]);
+}
+
+} // namespace starrocks
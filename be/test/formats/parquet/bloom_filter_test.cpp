@@ -0,0 +1,95 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "formats/parquet/bloom_filter.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "gen_cpp/parquet_types.h"
+#include "io/string_input_stream.h"
+#include "util/thrift_util.h"
+
+namespace starrocks::parquet {
+
+class ParquetBloomFilterTest : public testing::Test {
+public:
+    ParquetBloomFilterTest() = default;
+    ~ParquetBloomFilterTest() override = default;
+};
+
+TEST_F(ParquetBloomFilterTest, Hash) {
+    // parquet bloom filter uses xxhash64 with seed 0
+    ASSERT_EQ(0xEF46DB3751D8E999ULL, ParquetBloomFilter::hash("", 0));
+}
+
+TEST_F(ParquetBloomFilterTest, InsertAndTest) {
+    ParquetBloomFilter bloom_filter;
+    ASSERT_FALSE(bloom_filter.init(0).ok());
+    ASSERT_FALSE(bloom_filter.init(100).ok());
+    ASSERT_TRUE(bloom_filter.init(4096).ok());
+
+    for (int64_t i = 0; i < 1000; i++) {
+        bloom_filter.insert_hash(ParquetBloomFilter::hash(&i, sizeof(i)));
+    }
+    for (int64_t i = 0; i < 1000; i++) {
+        ASSERT_TRUE(bloom_filter.test_hash(ParquetBloomFilter::hash(&i, sizeof(i))));
+    }
+    int false_positive = 0;
+    for (int64_t i = 1000; i < 11000; i++) {
+        false_positive += bloom_filter.test_hash(ParquetBloomFilter::hash(&i, sizeof(i)));
+    }
+    // 32 bits per value, false positive rate should be far less than 1%
+    ASSERT_LT(false_positive, 100);
+}
+
+TEST_F(ParquetBloomFilterTest, ReadFromFile) {
+    ParquetBloomFilter builder;
+    ASSERT_TRUE(builder.init(1024).ok());
+    std::string values[] = {"hello", "world", "starrocks"};
+    for (const auto& value : values) {
+        builder.insert_hash(ParquetBloomFilter::hash(value.data(), value.size()));
+    }
+
+    // some bytes of other data before bloom filter
+    std::string buffer(100, 'x');
+    int64_t offset = buffer.size();
+    {
+        tparquet::BloomFilterHeader header;
+        header.numBytes = builder.num_bytes();
+        header.algorithm.__set_BLOCK(tparquet::SplitBlockAlgorithm());
+        header.hash.__set_XXHASH(tparquet::XxHash());
+        header.compression.__set_UNCOMPRESSED(tparquet::Uncompressed());
+
+        ThriftSerializer ser(true, 100);
+        uint32_t len = 0;
+        uint8_t* header_ser = nullptr;
+        ASSERT_TRUE(ser.serialize(&header, &len, &header_ser).ok());
+        buffer.append((char*)header_ser, len);
+        buffer.append((const char*)builder.bitset(), builder.num_bytes());
+    }
+    io::StringInputStream stream(std::move(buffer));
+
+    ParquetBloomFilter bloom_filter;
+    ASSERT_TRUE(bloom_filter.read(&stream, offset).ok());
+    ASSERT_EQ(builder.num_bytes(), bloom_filter.num_bytes());
+    for (const auto& value : values) {
+        ASSERT_TRUE(bloom_filter.test_hash(ParquetBloomFilter::hash(value.data(), value.size())));
+    }
+
+    ASSERT_FALSE(bloom_filter.read(&stream, 1 << 20).ok());
+}
+
+} // namespace starrocks::parquet
@@ -16,6 +16,8 @@
 
 #include <gtest/gtest.h>
 
+#include <limits>
+
 #include "column/binary_column.h"
 #include "column/fixed_length_column.h"
 #include "formats/parquet/encoding_dict.h"
@@ -522,4 +524,288 @@ TEST_F(ParquetEncodingTest, Boolean) {
     }
 }
 
+TEST_F(ParquetEncodingTest, DeltaBinaryPacked) {
+    std::vector<int32_t> int32_values;
+    std::vector<int64_t> int64_values;
+    for (int i = 0; i < 1000; i++) {
+        // mix increasing, decreasing and extreme values to cover different bit widths
+        int32_values.push_back(i % 7 == 0 ? -i * 1000 : i * 3);
+        int64_values.push_back(i % 100 == 0 ? std::numeric_limits<int64_t>::min() : i * (int64_t)1000000007);
+    }
+    int32_values[500] = std::numeric_limits<int32_t>::max();
+
+    const EncodingInfo* int32_encoding = nullptr;
+    EncodingInfo::get(tparquet::Type::INT32, tparquet::Encoding::DELTA_BINARY_PACKED, &int32_encoding);
+    ASSERT_TRUE(int32_encoding != nullptr);
+    {
+        std::unique_ptr<Decoder> decoder;
+        ASSERT_TRUE(int32_encoding->create_decoder(&decoder).ok());
+        std::unique_ptr<Encoder> encoder;
+        ASSERT_TRUE(int32_encoding->create_encoder(&encoder).ok());
+        ASSERT_TRUE(encoder->append(reinterpret_cast<uint8_t*>(&int32_values[0]), int32_values.size()).ok());
+        DecoderChecker<int32_t, false>::check(int32_values, encoder->build(), decoder.get());
+    }
+
+    const EncodingInfo* int64_encoding = nullptr;
+    EncodingInfo::get(tparquet::Type::INT64, tparquet::Encoding::DELTA_BINARY_PACKED, &int64_encoding);
+    ASSERT_TRUE(int64_encoding != nullptr);
+    {
+        std::unique_ptr<Decoder> decoder;
+        ASSERT_TRUE(int64_encoding->create_decoder(&decoder).ok());
+        std::unique_ptr<Encoder> encoder;
+        ASSERT_TRUE(int64_encoding->create_encoder(&encoder).ok());
+        ASSERT_TRUE(encoder->append(reinterpret_cast<uint8_t*>(&int64_values[0]), int64_values.size()).ok());
+        DecoderChecker<int64_t, false>::check(int64_values, encoder->build(), decoder.get());
+    }
+}
+
+TEST_F(ParquetEncodingTest, ByteStreamSplit) {
+    std::vector<float> float_values;
+    std::vector<double> double_values;
+    for (int i = 0; i < 100; i++) {
+        float_values.push_back(i * 1.5f - 20);
+        double_values.push_back(i * 3.25 - 100);
+    }
+
+    const EncodingInfo* float_encoding = nullptr;
+    EncodingInfo::get(tparquet::Type::FLOAT, tparquet::Encoding::BYTE_STREAM_SPLIT, &float_encoding);
+    ASSERT_TRUE(float_encoding != nullptr);
+    {
+        std::unique_ptr<Decoder> decoder;
+        ASSERT_TRUE(float_encoding->create_decoder(&decoder).ok());
+        std::unique_ptr<Encoder> encoder;
+        ASSERT_TRUE(float_encoding->create_encoder(&encoder).ok());
+        ASSERT_TRUE(encoder->append(reinterpret_cast<uint8_t*>(&float_values[0]), float_values.size()).ok());
+        DecoderChecker<float, false>::check(float_values, encoder->build(), decoder.get());
+    }
+
+    const EncodingInfo* double_encoding = nullptr;
+    EncodingInfo::get(tparquet::Type::DOUBLE, tparquet::Encoding::BYTE_STREAM_SPLIT, &double_encoding);
+    ASSERT_TRUE(double_encoding != nullptr);
+    {
+        std::unique_ptr<Decoder> decoder;
+        ASSERT_TRUE(double_encoding->create_decoder(&decoder).ok());
+        std::unique_ptr<Encoder> encoder;
+        ASSERT_TRUE(double_encoding->create_encoder(&encoder).ok());
+        ASSERT_TRUE(encoder->append(reinterpret_cast<uint8_t*>(&double_values[0]), double_values.size()).ok());
+        DecoderChecker<double, false>::check(double_values, encoder->build(), decoder.get());
+    }
+}
+
+TEST_F(ParquetEncodingTest, DeltaByteArray) {
+    std::vector<std::string> values;
+    for (int i = 0; i < 300; i++) {
+        // values with shared prefixes and an empty value
+        values.push_back(i == 150 ? "" : "prefix_" + std::to_string(i / 10) + "_" + std::to_string(i));
+    }
+    std::vector<Slice> slices;
+    for (const auto& value : values) {
+        slices.emplace_back(value);
+    }
+
+    for (auto encoding : {tparquet::Encoding::DELTA_LENGTH_BYTE_ARRAY, tparquet::Encoding::DELTA_BYTE_ARRAY}) {
+        const EncodingInfo* enc_info = nullptr;
+        EncodingInfo::get(tparquet::Type::BYTE_ARRAY, encoding, &enc_info);
+        ASSERT_TRUE(enc_info != nullptr);
+
+        std::unique_ptr<Decoder> decoder;
+        ASSERT_TRUE(enc_info->create_decoder(&decoder).ok());
+        std::unique_ptr<Encoder> encoder;
+        ASSERT_TRUE(enc_info->create_encoder(&encoder).ok());
+        ASSERT_TRUE(encoder->append(reinterpret_cast<uint8_t*>(&slices[0]), slices.size()).ok());
+        DecoderChecker<Slice, false>::check(slices, encoder->build(), decoder.get());
+    }
+}
+
+TEST_F(ParquetEncodingTest, DeltaBinaryPackedSpecExamples) {
+    // examples of https://github.com/apache/parquet-format/blob/master/Encodings.md, written with the block size
+    // of 128 values and 4 miniblocks as parquet-mr does.
+    // example 1: all deltas are 1, so min delta is 1 and the bit widths are 0.
+    const std::vector<uint8_t> example1 = {0x80, 0x01, 0x04, 0x05, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00};
+    // example 2: min delta is -2, the relative deltas are 0, 0, 0, 3, 3, 3, 3 packed with bit width 2.
+    const std::vector<uint8_t> example2 = {0x80, 0x01, 0x04, 0x08, 0x0e, 0x03, 0x02, 0x00, 0x00,
+                                           0x00, 0xc0, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+    const std::vector<std::pair<std::vector<uint8_t>, std::vector<int32_t>>> cases = {
+            {example1, {1, 2, 3, 4, 5}}, {example2, {7, 5, 3, 1, 2, 3, 4, 5}}};
+
+    for (const auto& [encoded, values] : cases) {
+        Slice encoded_data(reinterpret_cast<const char*>(encoded.data()), encoded.size());
+        const EncodingInfo* int32_encoding = nullptr;
+        EncodingInfo::get(tparquet::Type::INT32, tparquet::Encoding::DELTA_BINARY_PACKED, &int32_encoding);
+        ASSERT_TRUE(int32_encoding != nullptr);
+        {
+            std::unique_ptr<Decoder> decoder;
+            ASSERT_TRUE(int32_encoding->create_decoder(&decoder).ok());
+            DecoderChecker<int32_t, false>::check(values, encoded_data, decoder.get());
+
+            std::unique_ptr<Encoder> encoder;
+            ASSERT_TRUE(int32_encoding->create_encoder(&encoder).ok());
+            ASSERT_TRUE(encoder->append(reinterpret_cast<const uint8_t*>(values.data()), values.size()).ok());
+            ASSERT_EQ(encoded_data, encoder->build());
+        }
+
+        const EncodingInfo* int64_encoding = nullptr;
+        EncodingInfo::get(tparquet::Type::INT64, tparquet::Encoding::DELTA_BINARY_PACKED, &int64_encoding);
+        ASSERT_TRUE(int64_encoding != nullptr);
+        {
+            std::unique_ptr<Decoder> decoder;
+            ASSERT_TRUE(int64_encoding->create_decoder(&decoder).ok());
+            std::vector<int64_t> int64_values(values.begin(), values.end());
+            DecoderChecker<int64_t, false>::check(int64_values, encoded_data, decoder.get());
+        }
+    }
+}
+
+TEST_F(ParquetEncodingTest, DeltaByteArraySpecExamples) {
+    // DELTA_LENGTH_BYTE_ARRAY example: lengths 5, 5, 6, 6 followed by the concatenated values.
+    {
+        std::vector<uint8_t> encoded = {0x80, 0x01, 0x04, 0x04, 0x0a, 0x00, 0x01,
+                                        0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00};
+        std::string data = "HelloWorldFoobarABCDEF";
+        encoded.insert(encoded.end(), data.begin(), data.end());
+        std::vector<Slice> values = {"Hello", "World", "Foobar", "ABCDEF"};
+
+        const EncodingInfo* enc_info = nullptr;
+        EncodingInfo::get(tparquet::Type::BYTE_ARRAY, tparquet::Encoding::DELTA_LENGTH_BYTE_ARRAY, &enc_info);
+        ASSERT_TRUE(enc_info != nullptr);
+        std::unique_ptr<Decoder> decoder;
+        ASSERT_TRUE(enc_info->create_decoder(&decoder).ok());
+        Slice encoded_data(reinterpret_cast<const char*>(encoded.data()), encoded.size());
+        DecoderChecker<Slice, false>::check(values, encoded_data, decoder.get());
+
+        std::unique_ptr<Encoder> encoder;
+        ASSERT_TRUE(enc_info->create_encoder(&encoder).ok());
+        ASSERT_TRUE(encoder->append(reinterpret_cast<const uint8_t*>(values.data()), values.size()).ok());
+        ASSERT_EQ(encoded_data, encoder->build());
+    }
+    // DELTA_BYTE_ARRAY example: prefix lengths 0, 2, 0, 3, followed by the suffixes "axis", "le", "babble",
+    // "yhood" encoded by DELTA_LENGTH_BYTE_ARRAY.
+    {
+        std::vector<uint8_t> encoded = {
+                // prefix lengths
+                0x80, 0x01, 0x04, 0x04, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x44, 0x01, 0x00, 0x00, 0x00, 0x00,
+                0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+                // suffix lengths 4, 2, 6, 5
+                0x80, 0x01, 0x04, 0x04, 0x08, 0x03, 0x03, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+                0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+        std::string data = "axislebabbleyhood";
+        encoded.insert(encoded.end(), data.begin(), data.end());
+        std::vector<Slice> values = {"axis", "axle", "babble", "babyhood"};
+
+        const EncodingInfo* enc_info = nullptr;
+        EncodingInfo::get(tparquet::Type::BYTE_ARRAY, tparquet::Encoding::DELTA_BYTE_ARRAY, &enc_info);
+        ASSERT_TRUE(enc_info != nullptr);
+        std::unique_ptr<Decoder> decoder;
+        ASSERT_TRUE(enc_info->create_decoder(&decoder).ok());
+        Slice encoded_data(reinterpret_cast<const char*>(encoded.data()), encoded.size());
+        DecoderChecker<Slice, false>::check(values, encoded_data, decoder.get());
+
+        std::unique_ptr<Encoder> encoder;
+        ASSERT_TRUE(enc_info->create_encoder(&encoder).ok());
+        ASSERT_TRUE(encoder->append(reinterpret_cast<const uint8_t*>(values.data()), values.size()).ok());
+        ASSERT_EQ(encoded_data, encoder->build());
+    }
+}
+
+TEST_F(ParquetEncodingTest, FixedLenDeltaByteArray) {
+    const EncodingInfo* enc_info = nullptr;
+    EncodingInfo::get(tparquet::Type::FIXED_LEN_BYTE_ARRAY, tparquet::Encoding::DELTA_BYTE_ARRAY, &enc_info);
+    ASSERT_TRUE(enc_info != nullptr);
+
+    // prefix lengths 0, 3, 2, 0 and suffixes "abcd", "e", "zz", "bbbb"
+    {
+        std::vector<uint8_t> encoded = {
+                // prefix lengths
+                0x80, 0x01, 0x04, 0x04, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00,
+                0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+                // suffix lengths 4, 1, 2, 4
+                0x80, 0x01, 0x04, 0x04, 0x08, 0x05, 0x03, 0x00, 0x00, 0x00, 0x60, 0x01, 0x00, 0x00, 0x00, 0x00,
+                0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+        std::string data = "abcdezzbbbb";
+        encoded.insert(encoded.end(), data.begin(), data.end());
+        std::vector<Slice> values = {"abcd", "abce", "abzz", "bbbb"};
+
+        std::unique_ptr<Decoder> decoder;
+        ASSERT_TRUE(enc_info->create_decoder(&decoder).ok());
+        decoder->set_type_length(4);
+        Slice encoded_data(reinterpret_cast<const char*>(encoded.data()), encoded.size());
+        DecoderChecker<Slice, false>::check(values, encoded_data, decoder.get());
+
+        // values must be type_length bytes
+        decoder->set_type_length(3);
+        auto column = BinaryColumn::create();
+        ASSERT_TRUE(decoder->set_data(encoded_data).ok());
+        ASSERT_FALSE(decoder->next_batch(values.size(), ColumnContentType::VALUE, column.get()).ok());
+    }
+
+    std::vector<std::string> values;
+    for (int i = 1000; i < 1300; i++) {
+        values.push_back("key_" + std::to_string(i));
+    }
+    std::vector<Slice> slices;
+    for (const auto& value : values) {
+        slices.emplace_back(value);
+    }
+    std::unique_ptr<Decoder> decoder;
+    ASSERT_TRUE(enc_info->create_decoder(&decoder).ok());
+    std::unique_ptr<Encoder> encoder;
+    ASSERT_TRUE(enc_info->create_encoder(&encoder).ok());
+    ASSERT_TRUE(encoder->append(reinterpret_cast<uint8_t*>(&slices[0]), slices.size()).ok());
+    decoder->set_type_length(8);
+    DecoderChecker<Slice, false>::check(slices, encoder->build(), decoder.get());
+}
+
+// BYTE_STREAM_SPLIT scatters the k-th byte of each value to the k-th stream.
+template <typename T>
+static std::vector<uint8_t> byte_stream_split(const std::vector<T>& values) {
+    std::vector<uint8_t> encoded(values.size() * sizeof(T));
+    for (size_t i = 0; i < values.size(); i++) {
+        const auto* bytes = reinterpret_cast<const uint8_t*>(&values[i]);
+        for (size_t k = 0; k < sizeof(T); k++) {
+            encoded[k * values.size() + i] = bytes[k];
+        }
+    }
+    return encoded;
+}
+
+template <typename T>
+static void check_byte_stream_split(tparquet::Type::type type, const std::vector<T>& values,
+                                    const std::vector<uint8_t>& encoded) {
+    const EncodingInfo* enc_info = nullptr;
+    EncodingInfo::get(type, tparquet::Encoding::BYTE_STREAM_SPLIT, &enc_info);
+    ASSERT_TRUE(enc_info != nullptr);
+    Slice encoded_data(reinterpret_cast<const char*>(encoded.data()), encoded.size());
+
+    std::unique_ptr<Decoder> decoder;
+    ASSERT_TRUE(enc_info->create_decoder(&decoder).ok());
+    DecoderChecker<T, false>::check(values, encoded_data, decoder.get());
+
+    std::unique_ptr<Encoder> encoder;
+    ASSERT_TRUE(enc_info->create_encoder(&encoder).ok());
+    ASSERT_TRUE(encoder->append(reinterpret_cast<const uint8_t*>(values.data()), values.size()).ok());
+    ASSERT_EQ(encoded_data, encoder->build());
+}
+
+TEST_F(ParquetEncodingTest, ByteStreamSplitSpecExample) {
+    // the example of the spec: three 4-byte values AA BB CC DD, 00 11 22 33 and A3 B4 C5 D6 are encoded as
+    // AA 00 A3 BB 11 B4 CC 22 C5 DD 33 D6
+    const std::vector<uint8_t> bytes = {0xAA, 0xBB, 0xCC, 0xDD, 0x00, 0x11, 0x22, 0x33, 0xA3, 0xB4, 0xC5, 0xD6};
+    const std::vector<uint8_t> encoded = {0xAA, 0x00, 0xA3, 0xBB, 0x11, 0xB4, 0xCC, 0x22, 0xC5, 0xDD, 0x33, 0xD6};
+    std::vector<int32_t> values(3);
+    memcpy(values.data(), bytes.data(), bytes.size());
+    check_byte_stream_split<int32_t>(tparquet::Type::INT32, values, encoded);
+}
+
+TEST_F(ParquetEncodingTest, ByteStreamSplitIntegers) {
+    // more than 16 values and a tail to cover both the vectorized and the scalar paths
+    std::vector<int32_t> int32_values;
+    std::vector<int64_t> int64_values;
+    for (int i = 0; i < 101; i++) {
+        int32_values.push_back(i % 3 == 0 ? -i * 65537 : i * 16777259);
+        int64_values.push_back(i % 5 == 0 ? std::numeric_limits<int64_t>::min() + i : i * (int64_t)1099511628211);
+    }
+    check_byte_stream_split<int32_t>(tparquet::Type::INT32, int32_values, byte_stream_split(int32_values));
+    check_byte_stream_split<int64_t>(tparquet::Type::INT64, int64_values, byte_stream_split(int64_values));
+}
+
 } // namespace starrocks::parquet
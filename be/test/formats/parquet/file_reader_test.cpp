@@ -27,6 +27,7 @@
 #include "exec/hdfs_scanner.h"
 #include "exprs/binary_predicate.h"
 #include "exprs/expr_context.h"
+#include "formats/parquet/bloom_filter.h"
 #include "formats/parquet/column_chunk_reader.h"
 #include "formats/parquet/metadata.h"
 #include "formats/parquet/page_reader.h"
@@ -34,9 +35,12 @@
 #include "formats/parquet/parquet_ut_base.h"
 #include "fs/fs.h"
 #include "io/shared_buffered_input_stream.h"
+#include "io/string_input_stream.h"
 #include "runtime/descriptor_helper.h"
 #include "runtime/mem_tracker.h"
 #include "testutil/assert.h"
+#include "util/coding.h"
+#include "util/thrift_util.h"
 
 namespace starrocks::parquet {
 
@@ -3265,4 +3269,199 @@ TEST_F(FileReaderTest, TestReadNoMinMaxStatistics) {
     EXPECT_EQ(chunk->num_rows(), 111);
 }
 
+// Build a parquet file of a required INT32 column `c0`, one row group for each element of `row_groups`.
+// Data pages are plain encoded without statistics, and each column chunk has a bloom filter of its values.
+// If `broken_bloom_filter` is true, bloom filter offsets in metadata point beyond the end of file.
+static void build_file_with_bloom_filters(const std::vector<std::vector<int32_t>>& row_groups, std::string* file,
+                                          bool broken_bloom_filter = false) {
+    ThriftSerializer serializer(true, 1024);
+    uint8_t* buffer = nullptr;
+    uint32_t len = 0;
+
+    file->assign(PARQUET_MAGIC_NUMBER);
+    tparquet::FileMetaData metadata;
+    metadata.version = 1;
+    metadata.num_rows = 0;
+    tparquet::SchemaElement root;
+    root.__set_name("schema");
+    root.__set_num_children(1);
+    tparquet::SchemaElement c0;
+    c0.__set_name("c0");
+    c0.__set_type(tparquet::Type::INT32);
+    c0.__set_repetition_type(tparquet::FieldRepetitionType::REQUIRED);
+    metadata.schema = {root, c0};
+
+    for (const auto& values : row_groups) {
+        int64_t data_page_offset = file->size();
+        size_t data_size = values.size() * sizeof(int32_t);
+        tparquet::PageHeader page_header;
+        page_header.type = tparquet::PageType::DATA_PAGE;
+        page_header.uncompressed_page_size = data_size;
+        page_header.compressed_page_size = data_size;
+        tparquet::DataPageHeader data_page_header;
+        data_page_header.num_values = values.size();
+        data_page_header.encoding = tparquet::Encoding::PLAIN;
+        data_page_header.definition_level_encoding = tparquet::Encoding::RLE;
+        data_page_header.repetition_level_encoding = tparquet::Encoding::RLE;
+        page_header.__set_data_page_header(data_page_header);
+        ASSERT_OK(serializer.serialize(&page_header, &len, &buffer));
+        file->append(reinterpret_cast<const char*>(buffer), len);
+        file->append(reinterpret_cast<const char*>(values.data()), data_size);
+        int64_t column_size = file->size() - data_page_offset;
+
+        ParquetBloomFilter bloom_filter;
+        ASSERT_OK(bloom_filter.init(1024));
+        for (int32_t value : values) {
+            bloom_filter.insert_hash(ParquetBloomFilter::hash(&value, sizeof(value)));
+        }
+        int64_t bloom_filter_offset = file->size();
+        tparquet::BloomFilterHeader bloom_filter_header;
+        bloom_filter_header.numBytes = bloom_filter.num_bytes();
+        bloom_filter_header.algorithm.__set_BLOCK(tparquet::SplitBlockAlgorithm());
+        bloom_filter_header.hash.__set_XXHASH(tparquet::XxHash());
+        bloom_filter_header.compression.__set_UNCOMPRESSED(tparquet::Uncompressed());
+        ASSERT_OK(serializer.serialize(&bloom_filter_header, &len, &buffer));
+        file->append(reinterpret_cast<const char*>(buffer), len);
+        file->append(reinterpret_cast<const char*>(bloom_filter.bitset()), bloom_filter.num_bytes());
+
+        tparquet::ColumnMetaData column_metadata;
+        column_metadata.type = tparquet::Type::INT32;
+        column_metadata.encodings = {tparquet::Encoding::PLAIN};
+        column_metadata.path_in_schema = {"c0"};
+        column_metadata.codec = tparquet::CompressionCodec::UNCOMPRESSED;
+        column_metadata.num_values = values.size();
+        column_metadata.total_uncompressed_size = column_size;
+        column_metadata.total_compressed_size = column_size;
+        column_metadata.data_page_offset = data_page_offset;
+        column_metadata.__set_bloom_filter_offset(broken_bloom_filter ? (1L << 30) : bloom_filter_offset);
+        tparquet::ColumnChunk column_chunk;
+        column_chunk.file_offset = data_page_offset;
+        column_chunk.__set_meta_data(column_metadata);
+
+        tparquet::RowGroup row_group;
+        row_group.columns = {column_chunk};
+        row_group.total_byte_size = column_size;
+        row_group.num_rows = values.size();
+        metadata.row_groups.emplace_back(std::move(row_group));
+        metadata.num_rows += values.size();
+    }
+
+    ASSERT_OK(serializer.serialize(&metadata, &len, &buffer));
+    file->append(reinterpret_cast<const char*>(buffer), len);
+    uint8_t metadata_length[4];
+    encode_fixed32_le(metadata_length, len);
+    file->append(reinterpret_cast<const char*>(metadata_length), sizeof(metadata_length));
+    file->append(PARQUET_MAGIC_NUMBER);
+}
+
+TEST_F(FileReaderTest, TestSkipGroupByBloomFilter) {
+    // 150 only exists in the second row group, min/max statistics are absent so only bloom filters can skip groups.
+    std::vector<std::vector<int32_t>> row_groups(2);
+    for (int32_t i = 0; i < 100; i++) {
+        row_groups[0].push_back(i * 2);
+        row_groups[1].push_back(i * 2 + 101);
+    }
+    std::string buffer;
+    build_file_with_bloom_filters(row_groups, &buffer);
+    size_t file_size = buffer.size();
+    RandomAccessFile file(std::make_shared<io::StringInputStream>(std::move(buffer)), "bloom_filter.parquet");
+
+    for (bool bloom_filter_enable : {true, false}) {
+        config::parquet_bloom_filter_enable = bloom_filter_enable;
+        auto file_reader = std::make_shared<FileReader>(config::vector_chunk_size, &file, file_size, 0);
+
+        auto ctx = _create_scan_context();
+        TypeDescriptor type_int = TypeDescriptor::from_logical_type(LogicalType::TYPE_INT);
+        Utils::SlotDesc slot_descs[] = {
+                {"c0", type_int},
+                {""},
+        };
+        ctx->tuple_desc = Utils::create_tuple_descriptor(_runtime_state, &_pool, slot_descs);
+        Utils::make_column_info_vector(ctx->tuple_desc, &ctx->materialized_columns);
+        auto* scan_range = _pool.add(new THdfsScanRange());
+        scan_range->relative_path = "bloom_filter.parquet";
+        scan_range->file_length = file_size;
+        scan_range->offset = 4;
+        scan_range->length = file_size;
+        ctx->scan_range = scan_range;
+        // c0 = 151
+        _create_int_conjunct_ctxs(TExprOpcode::EQ, 0, 151, &ctx->conjunct_ctxs_by_slot[0]);
+
+        int64_t skip_groups_before = g_hdfs_scan_stats.bloom_filter_skip_groups;
+        ASSERT_OK(file_reader->init(ctx));
+        ASSERT_EQ(2, file_reader->_row_group_readers.size());
+
+        size_t total_rows = 0;
+        Status status;
+        while (status.ok()) {
+            auto chunk = std::make_shared<Chunk>();
+            chunk->append_column(ColumnHelper::create_column(type_int, true), chunk->num_columns());
+            status = file_reader->get_next(&chunk);
+            ASSERT_TRUE(status.ok() || status.is_end_of_file()) << status.to_string();
+            chunk->check_or_die();
+            for (size_t i = 0; i < chunk->num_rows(); i++) {
+                ASSERT_EQ("[151]", chunk->debug_row(i));
+            }
+            total_rows += chunk->num_rows();
+        }
+        // the matching row group is kept
+        ASSERT_EQ(1, total_rows);
+        // the first row group is skipped without reading any data page
+        int64_t skip_groups = g_hdfs_scan_stats.bloom_filter_skip_groups - skip_groups_before;
+        ASSERT_EQ(bloom_filter_enable ? 1 : 0, skip_groups);
+    }
+    config::parquet_bloom_filter_enable = true;
+}
+
+TEST_F(FileReaderTest, TestBrokenBloomFilter) {
+    std::vector<std::vector<int32_t>> row_groups(2);
+    for (int32_t i = 0; i < 100; i++) {
+        row_groups[0].push_back(i * 2);
+        row_groups[1].push_back(i * 2 + 101);
+    }
+    std::string buffer;
+    build_file_with_bloom_filters(row_groups, &buffer, true);
+    size_t file_size = buffer.size();
+    RandomAccessFile file(std::make_shared<io::StringInputStream>(std::move(buffer)), "broken_bloom_filter.parquet");
+    auto file_reader = std::make_shared<FileReader>(config::vector_chunk_size, &file, file_size, 0);
+
+    auto ctx = _create_scan_context();
+    TypeDescriptor type_int = TypeDescriptor::from_logical_type(LogicalType::TYPE_INT);
+    Utils::SlotDesc slot_descs[] = {
+            {"c0", type_int},
+            {""},
+    };
+    ctx->tuple_desc = Utils::create_tuple_descriptor(_runtime_state, &_pool, slot_descs);
+    Utils::make_column_info_vector(ctx->tuple_desc, &ctx->materialized_columns);
+    auto* scan_range = _pool.add(new THdfsScanRange());
+    scan_range->relative_path = "broken_bloom_filter.parquet";
+    scan_range->file_length = file_size;
+    scan_range->offset = 4;
+    scan_range->length = file_size;
+    ctx->scan_range = scan_range;
+    // c0 = 151
+    _create_int_conjunct_ctxs(TExprOpcode::EQ, 0, 151, &ctx->conjunct_ctxs_by_slot[0]);
+
+    // broken bloom filters can not skip any row group, but do not fail the query
+    int64_t skip_groups_before = g_hdfs_scan_stats.bloom_filter_skip_groups;
+    ASSERT_OK(file_reader->init(ctx));
+    ASSERT_EQ(2, file_reader->_row_group_readers.size());
+
+    size_t total_rows = 0;
+    Status status;
+    while (status.ok()) {
+        auto chunk = std::make_shared<Chunk>();
+        chunk->append_column(ColumnHelper::create_column(type_int, true), chunk->num_columns());
+        status = file_reader->get_next(&chunk);
+        ASSERT_TRUE(status.ok() || status.is_end_of_file()) << status.to_string();
+        chunk->check_or_die();
+        for (size_t i = 0; i < chunk->num_rows(); i++) {
+            ASSERT_EQ("[151]", chunk->debug_row(i));
+        }
+        total_rows += chunk->num_rows();
+    }
+    ASSERT_EQ(1, total_rows);
+    ASSERT_EQ(0, g_hdfs_scan_stats.bloom_filter_skip_groups - skip_groups_before);
+}
+
 } // namespace starrocks::parquet
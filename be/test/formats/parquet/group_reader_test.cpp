@@ -453,4 +453,28 @@ TEST_F(GroupReaderTest, ColumnReaderCreateTypeMismatch) {
     std::cout << st.message() << "\n";
 }
 
+TEST_F(GroupReaderTest, DictFilterEvaluateByCode) {
+    ColumnDictFilterContext ctx;
+    // dict values [a, b, c, d], conjuncts pass b and d
+    ctx.dict_code_filter = Filter{0, 1, 0, 1};
+
+    auto codes = ColumnHelper::create_column(
+            TypeDescriptor::from_logical_type(ColumnDictFilterContext::kDictCodePrimitiveType), true);
+    auto* nullable_codes = down_cast<NullableColumn*>(codes.get());
+    for (int32_t code : {0, 1, 2, 3, 1}) {
+        nullable_codes->append_datum(Datum(code));
+    }
+    nullable_codes->append_nulls(1);
+
+    Filter filter(codes->size(), 1);
+    ctx.evaluate_and(codes.get(), filter.data());
+    ASSERT_EQ(Filter({0, 1, 0, 1, 1, 0}), filter);
+
+    // filter is AND with existing one, and null passes now
+    ctx.null_is_ok = true;
+    filter = Filter{1, 1, 1, 0, 1, 1};
+    ctx.evaluate_and(codes.get(), filter.data());
+    ASSERT_EQ(Filter({0, 1, 0, 0, 1, 1}), filter);
+}
+
 } // namespace starrocks::parquet
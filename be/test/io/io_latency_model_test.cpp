@@ -0,0 +1,71 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "io/io_latency_model.h"
+
+#include <gtest/gtest.h>
+
+#include "testutil/parallel_test.h"
+
+namespace starrocks::io {
+
+static constexpr int64_t KB = 1024;
+static constexpr int64_t MB = 1024 * 1024;
+
+PARALLEL_TEST(IOLatencyModelTest, test_estimate) {
+    IOLatencyModel model;
+    // 10ms latency and 100MB/s bandwidth
+    auto elapsed_ns = [](int64_t bytes) { return 10 * 1000 * 1000 + bytes * 1000 * 1000 * 1000 / (100 * MB); };
+
+    for (int64_t i = 0; i < IOLatencyModel::MIN_SAMPLES - 1; i++) {
+        int64_t bytes = (i % 8 + 1) * 256 * KB;
+        model.update(bytes, elapsed_ns(bytes));
+    }
+    // not enough samples
+    double latency_ns = 0;
+    double bytes_per_ns = 0;
+    ASSERT_FALSE(model.estimate(&latency_ns, &bytes_per_ns));
+    ASSERT_EQ(123, model.coalesce_distance(123, 1, 8 * MB));
+
+    model.update(4 * MB, elapsed_ns(4 * MB));
+    ASSERT_TRUE(model.estimate(&latency_ns, &bytes_per_ns));
+    ASSERT_NEAR(10 * 1000 * 1000, latency_ns, 1000);
+    ASSERT_NEAR(100.0 * MB / 1e9, bytes_per_ns, 1e-3);
+
+    // 1MB is transferred during 10ms
+    ASSERT_NEAR(MB, model.coalesce_distance(123, 1, 8 * MB), 16 * KB);
+    ASSERT_EQ(512 * KB, model.coalesce_distance(123, 1, 512 * KB));
+    ASSERT_EQ(2 * MB, model.coalesce_distance(123, 2 * MB, 8 * MB));
+}
+
+PARALLEL_TEST(IOLatencyModelTest, test_same_size_reads) {
+    IOLatencyModel model;
+    for (int64_t i = 0; i < 2 * IOLatencyModel::MIN_SAMPLES; i++) {
+        model.update(MB, 20 * 1000 * 1000);
+    }
+    // latency and bandwidth can't be told apart
+    double latency_ns = 0;
+    double bytes_per_ns = 0;
+    ASSERT_FALSE(model.estimate(&latency_ns, &bytes_per_ns));
+    ASSERT_EQ(123, model.coalesce_distance(123, 1, 8 * MB));
+}
+
+PARALLEL_TEST(IOLatencyModelTest, test_get) {
+    auto* s3 = IOLatencyModel::get("s3");
+    auto* hdfs = IOLatencyModel::get("hdfs");
+    ASSERT_NE(s3, hdfs);
+    ASSERT_EQ(s3, IOLatencyModel::get("s3"));
+}
+
+} // namespace starrocks::io
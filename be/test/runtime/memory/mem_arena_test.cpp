@@ -0,0 +1,99 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "runtime/memory/mem_arena.h"
+
+#include <gtest/gtest.h>
+
+#include "util/phmap/phmap.h"
+
+namespace starrocks {
+
+TEST(MemArenaTest, allocate) {
+    MemArena arena(4096, false);
+    void* p1 = arena.allocate(100);
+    void* p2 = arena.allocate(100);
+    ASSERT_EQ(0, reinterpret_cast<uintptr_t>(p1) % MemArena::MIN_ALIGNMENT);
+    // carved from the same chunk
+    ASSERT_EQ(static_cast<uint8_t*>(p1) + 112, p2);
+    ASSERT_EQ(224, arena.total_allocated_bytes());
+    ASSERT_EQ(4096, arena.total_reserved_bytes());
+
+    // reuse the deallocated block of the same size
+    arena.deallocate(p1, 100);
+    ASSERT_EQ(p1, arena.allocate(110));
+    void* p3 = arena.allocate(50);
+    ASSERT_EQ(static_cast<uint8_t*>(p2) + 112, p3);
+
+    // large blocks are allocated individually
+    void* large = arena.allocate(1024);
+    ASSERT_EQ(4096 + 1024, arena.total_reserved_bytes());
+    arena.deallocate(large, 1024);
+    ASSERT_EQ(4096, arena.total_reserved_bytes());
+
+    arena.deallocate(p1, 110);
+    arena.deallocate(p2, 100);
+    arena.deallocate(p3, 50);
+    ASSERT_EQ(0, arena.total_allocated_bytes());
+}
+
+TEST(MemArenaTest, huge_pages) {
+    MemArena arena(MemArena::HUGE_PAGE_SIZE, true);
+    void* p = arena.allocate(MemArena::HUGE_PAGE_SIZE * 2);
+    ASSERT_EQ(0, reinterpret_cast<uintptr_t>(p) % MemArena::HUGE_PAGE_SIZE);
+    arena.deallocate(p, MemArena::HUGE_PAGE_SIZE * 2);
+    ASSERT_EQ(0, arena.total_reserved_bytes());
+}
+
+TEST(MemArenaTest, hash_map) {
+    using HashMap = phmap::flat_hash_map<int64_t, int64_t, phmap::Hash<int64_t>, phmap::EqualTo<int64_t>,
+                                         ArenaAllocator<phmap::priv::Pair<const int64_t, int64_t>>>;
+    auto arena = std::make_shared<MemArena>(64 * 1024, false);
+    {
+        HashMap map;
+        use_arena(&map, arena);
+        for (int64_t i = 0; i < 10000; i++) {
+            map.emplace(i, i * 2);
+        }
+        for (int64_t i = 0; i < 10000; i++) {
+            ASSERT_EQ(i * 2, map[i]);
+        }
+        ASSERT_GT(arena->total_allocated_bytes(), 0);
+
+        HashMap other;
+        other = std::move(map);
+        ASSERT_EQ(arena, other.get_allocator().arena());
+        ASSERT_EQ(10000, other.size());
+    }
+    ASSERT_EQ(0, arena->total_allocated_bytes());
+
+    // the global allocator is used without arena.
+    HashMap map;
+    use_arena(&map, nullptr);
+    map.emplace(1, 1);
+    ASSERT_EQ(nullptr, map.get_allocator().arena());
+}
+
+TEST(MemArenaTest, buffer) {
+    auto arena = std::make_shared<MemArena>(64 * 1024, false);
+    ArenaBuffer<uint32_t> buffer;
+    use_arena(&buffer, arena);
+    buffer.resize(100, 1);
+    ASSERT_EQ(400, arena->total_allocated_bytes());
+    buffer.clear();
+    buffer.shrink_to_fit();
+    ASSERT_EQ(0, arena->total_allocated_bytes());
+}
+
+} // namespace starrocks
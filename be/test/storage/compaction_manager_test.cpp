@@ -251,6 +251,72 @@ TEST_F(CompactionManagerTest, test_next_compaction_task_id) {
     ASSERT_LT(0, start_task_id);
 }
 
+TEST_F(CompactionManagerTest, test_read_amplification) {
+    TabletSharedPtr tablet = std::make_shared<Tablet>();
+    // never read
+    ASSERT_EQ(0, tablet->read_amplification());
+    tablet->update_read_amplification(10);
+    double read_amp = tablet->read_amplification();
+    ASSERT_GT(read_amp, 0);
+    ASSERT_LE(read_amp, 10);
+    // moving average follows later reads
+    for (int i = 0; i < 50; i++) {
+        tablet->update_read_amplification(1);
+    }
+    ASSERT_LT(tablet->read_amplification(), read_amp);
+
+    auto old_window = config::compaction_read_amplification_window_seconds;
+    config::compaction_read_amplification_window_seconds = 0;
+    ASSERT_EQ(0, tablet->read_amplification());
+    config::compaction_read_amplification_window_seconds = old_window;
+}
+
+TEST_F(CompactionManagerTest, test_candidates_read_amplification) {
+    auto old_weight = config::compaction_read_amplification_weight;
+    DataDir data_dir("./data_dir");
+    std::vector<TabletSharedPtr> tablets;
+    std::vector<CompactionCandidate> candidates;
+    for (int i = 0; i < 3; i++) {
+        TabletSharedPtr tablet = std::make_shared<Tablet>();
+        TabletMetaSharedPtr tablet_meta = std::make_shared<TabletMeta>();
+        tablet_meta->set_tablet_id(i);
+        tablet->set_tablet_meta(tablet_meta);
+        tablet->set_data_dir(&data_dir);
+        tablet->set_tablet_state(TABLET_RUNNING);
+        tablets.push_back(tablet);
+
+        CompactionCandidate candidate;
+        candidate.tablet = tablet;
+        candidate.score = 1 + i;
+        candidates.push_back(candidate);
+    }
+    auto* compaction_manager = _engine->compaction_manager();
+    auto pick_all = [&]() {
+        std::vector<int64_t> tablet_ids;
+        CompactionCandidate candidate;
+        while (compaction_manager->pick_candidate(&candidate)) {
+            tablet_ids.push_back(candidate.tablet->tablet_id());
+            // the policy score is kept
+            EXPECT_EQ(1 + candidate.tablet->tablet_id(), candidate.score);
+        }
+        return tablet_ids;
+    };
+
+    // tablet 0 is queried after it's queued, the boost is applied when picking
+    config::compaction_read_amplification_weight = 1.0;
+    compaction_manager->update_candidates(candidates);
+    tablets[0]->update_read_amplification(100);
+    ASSERT_EQ(3, compaction_manager->max_score());
+    ASSERT_EQ((std::vector<int64_t>{0, 2, 1}), pick_all());
+
+    // disabled
+    config::compaction_read_amplification_weight = 0;
+    compaction_manager->update_candidates(candidates);
+    ASSERT_EQ((std::vector<int64_t>{2, 1, 0}), pick_all());
+
+    config::compaction_read_amplification_weight = old_weight;
+}
+
 TEST_F(CompactionManagerTest, test_compaction_parallel) {
     std::vector<TabletSharedPtr> tablets;
     std::vector<std::shared_ptr<MockCompactionTask>> tasks;
@@ -18,6 +18,7 @@
 
 #include <cstdlib>
 
+#include "column/fixed_length_column.h"
 #include "fs/fs_memory.h"
 #include "fs/fs_util.h"
 #include "storage/chunk_helper.h"
@@ -1598,6 +1599,121 @@ TEST_P(PersistentIndexTest, test_fixlen_replace) {
     ASSERT_TRUE(fs::remove_all(kPersistentIndexDir).ok());
 }
 
+TEST_P(PersistentIndexTest, test_upsert_absent_keys) {
+    FileSystem* fs = FileSystem::Default();
+    const std::string kPersistentIndexDir = "./PersistentIndexTest_test_upsert_absent_keys";
+    const std::string kIndexFile = "./PersistentIndexTest_test_upsert_absent_keys/index.l0.0.0";
+    bool created;
+    ASSERT_OK(fs->create_dir_if_missing(kPersistentIndexDir, &created));
+
+    using Key = uint64_t;
+    PersistentIndexMetaPB index_meta;
+    const int N = 100000;
+    vector<Key> keys(N * 2);
+    vector<Slice> key_slices;
+    vector<IndexValue> values;
+    key_slices.reserve(N * 2);
+    for (int i = 0; i < N * 2; i++) {
+        keys[i] = i;
+        key_slices.emplace_back((uint8_t*)(&keys[i]), sizeof(Key));
+        values.emplace_back(i * 2);
+    }
+
+    ASSIGN_OR_ABORT(auto wfile, FileSystem::Default()->new_writable_file(kIndexFile));
+
+    EditVersion version(0, 0);
+    index_meta.set_key_size(sizeof(Key));
+    index_meta.set_size(0);
+    version.to_pb(index_meta.mutable_version());
+    MutableIndexMetaPB* l0_meta = index_meta.mutable_l0_meta();
+    l0_meta->set_format_version(PERSISTENT_INDEX_VERSION_5);
+    IndexSnapshotMetaPB* snapshot_meta = l0_meta->mutable_snapshot();
+    version.to_pb(snapshot_meta->mutable_version());
+
+    PersistentIndex index(kPersistentIndexDir);
+    ASSERT_OK(index.load(index_meta));
+
+    // first half goes through normal upsert, second half are known to be new keys
+    std::vector<IndexValue> old_values(N, IndexValue(NullIndexValue));
+    ASSERT_OK(index.prepare(EditVersion(1, 0), N));
+    ASSERT_OK(index.upsert(N, key_slices.data(), values.data(), old_values.data()));
+    ASSERT_OK(index.commit(&index_meta));
+    ASSERT_OK(index.on_commited());
+
+    ASSERT_OK(index.prepare(EditVersion(2, 0), N));
+    ASSERT_OK(index.upsert_absent_keys(N, key_slices.data() + N, values.data() + N, old_values.data()));
+    ASSERT_OK(index.commit(&index_meta));
+    ASSERT_OK(index.on_commited());
+    for (int i = 0; i < N; i++) {
+        ASSERT_EQ(NullIndexValue, old_values[i].get_value());
+    }
+    ASSERT_EQ((size_t)N * 2, index.size());
+
+    std::vector<IndexValue> get_values(N * 2);
+    ASSERT_OK(index.get(N * 2, key_slices.data(), get_values.data()));
+    for (int i = 0; i < N * 2; i++) {
+        ASSERT_EQ(values[i], get_values[i]);
+    }
+
+    ASSERT_TRUE(fs::remove_all(kPersistentIndexDir).ok());
+}
+
+TEST_P(PersistentIndexTest, test_primary_index_upsert_after_reload) {
+    const int64_t old_l0_max_mem_usage = config::l0_max_mem_usage;
+    // make sure the keys are flushed into l1
+    config::l0_max_mem_usage = 10;
+    TabletSharedPtr tablet = create_tablet(rand(), rand());
+    tablet->set_enable_persistent_index(true);
+    const int64_t N = 1000;
+    std::vector<int64_t> keys(N);
+    for (int64_t i = 0; i < N; i++) {
+        keys[i] = i;
+    }
+    RowsetSharedPtr rowset = create_rowset(tablet, keys);
+    ASSERT_OK(tablet->rowset_commit(2, rowset, 0));
+    std::vector<RowsetSharedPtr> rowsets;
+    EditVersion full_edit_version;
+    ASSERT_OK(tablet->updates()->get_applied_rowsets(2, &rowsets, &full_edit_version));
+
+    auto manager = StorageEngine::instance()->update_manager();
+    auto index_entry = manager->index_cache().get_or_create(tablet->tablet_id());
+    auto& index = index_entry->value();
+    // the index is evicted, or BE restarts, and then it's reloaded from disk
+    index.unload();
+    ASSERT_OK(index.load(tablet.get()));
+    ASSERT_TRUE(index.enable_persistent_index());
+
+    auto create_pks = [](int64_t begin, int64_t end) {
+        auto pks = Int64Column::create();
+        for (int64_t k = begin; k < end; k++) {
+            pks->append(k);
+        }
+        return pks;
+    };
+    ASSERT_OK(index.prepare(EditVersion(3, 0), 0));
+    PrimaryIndex::DeletesMap deletes;
+    // keys larger than any key loaded
+    ASSERT_OK(index.upsert(100, 0, *create_pks(N, 2 * N), &deletes));
+    ASSERT_TRUE(deletes.empty());
+    // the keys loaded from disk are smaller than the keys upserted after reload, they must still be found
+    ASSERT_OK(index.upsert(101, 0, *create_pks(0, N), &deletes));
+    size_t num_deletes = 0;
+    for (auto& [rssid, rowids] : deletes) {
+        ASSERT_NE(100, rssid);
+        num_deletes += rowids.size();
+    }
+    ASSERT_EQ(N, num_deletes);
+    // and the keys upserted after reload too
+    deletes.clear();
+    ASSERT_OK(index.upsert(102, 0, *create_pks(N, 2 * N), &deletes));
+    ASSERT_EQ(1, deletes.size());
+    ASSERT_EQ(N, deletes[100].size());
+    ASSERT_OK(index.abort());
+    index.unload();
+    manager->index_cache().release(index_entry);
+    config::l0_max_mem_usage = old_l0_max_mem_usage;
+}
+
 TEST_P(PersistentIndexTest, test_varlen_replace) {
     FileSystem* fs = FileSystem::Default();
     const std::string kPersistentIndexDir = "./PersistentIndexTest_test_varlen_replace";
@@ -2070,6 +2186,108 @@ TEST_P(PersistentIndexTest, test_bloom_filter_working) {
     ASSERT_TRUE(fs::remove_all(kPersistentIndexDir).ok());
 }
 
+TEST_P(PersistentIndexTest, test_release_cold_memory) {
+    write_pindex_bf = true;
+    const std::string kPersistentIndexDir = "./PersistentIndexTest_test_release_cold_memory";
+    ASSIGN_OR_ABORT(auto fs, FileSystem::CreateSharedFromString("posix://"));
+    bool created;
+    ASSERT_OK(fs->create_dir_if_missing(kPersistentIndexDir, &created));
+    const int64_t old_l0_max_mem_usage = config::l0_max_mem_usage;
+    // make sure generate l1
+    config::l0_max_mem_usage = 10;
+    const std::string kIndexFile = "./PersistentIndexTest_test_release_cold_memory/index.l0.0.0";
+
+    using Key = std::string;
+    PersistentIndexMetaPB index_meta;
+    const int N = 1000;
+    vector<Key> keys(N);
+    vector<Slice> key_slices;
+    vector<IndexValue> values;
+    key_slices.reserve(N);
+    for (int i = 0; i < N; i++) {
+        keys[i] = fmt::format("test_varlen_{:016X}", i);
+        values.emplace_back(i * 2);
+        key_slices.emplace_back(keys[i]);
+    }
+    {
+        ASSIGN_OR_ABORT(auto wfile, FileSystem::Default()->new_writable_file(kIndexFile));
+        ASSERT_OK(wfile->close());
+    }
+
+    auto check_lookups = [&](PersistentIndex& index) {
+        std::vector<IndexValue> get_values(N);
+        ASSERT_OK(index.get(N, key_slices.data(), get_values.data()));
+        for (int i = 0; i < N; i++) {
+            ASSERT_EQ(values[i], get_values[i]);
+        }
+        // absent keys
+        vector<Key> absent_keys(N);
+        vector<Slice> absent_key_slices(N);
+        for (int i = 0; i < N; i++) {
+            absent_keys[i] = fmt::format("test_varlen_{:016X}", i + N);
+            absent_key_slices[i] = absent_keys[i];
+        }
+        ASSERT_OK(index.get(N, absent_key_slices.data(), get_values.data()));
+        for (int i = 0; i < N; i++) {
+            ASSERT_EQ(NullIndexValue, get_values[i].get_value());
+        }
+    };
+
+    {
+        PersistentIndex index(kPersistentIndexDir);
+        EditVersion version(0, 0);
+        index_meta.set_key_size(0);
+        index_meta.set_size(0);
+        version.to_pb(index_meta.mutable_version());
+        MutableIndexMetaPB* l0_meta = index_meta.mutable_l0_meta();
+        l0_meta->set_format_version(PERSISTENT_INDEX_VERSION_5);
+        IndexSnapshotMetaPB* snapshot_meta = l0_meta->mutable_snapshot();
+        version.to_pb(snapshot_meta->mutable_version());
+
+        ASSERT_OK(index.load(index_meta));
+        ASSERT_OK(index.prepare(EditVersion(1, 0), N));
+        std::vector<IndexValue> old_values(N, IndexValue(NullIndexValue));
+        ASSERT_OK(index.upsert(N, key_slices.data(), values.data(), old_values.data()));
+        ASSERT_OK(index.commit(&index_meta));
+        ASSERT_OK(index.on_commited());
+        ASSERT_TRUE(index.has_bf());
+
+        // bloom filters of l1 are dropped, and reloaded from file by the lookups
+        size_t memory_usage = index.memory_usage();
+        ASSERT_GT(index.release_cold_memory(), 0);
+        ASSERT_LT(index.memory_usage(), memory_usage);
+        ASSERT_EQ(0, index.release_cold_memory());
+        check_lookups(index);
+        ASSERT_TRUE(index.has_bf());
+    }
+
+    {
+        // reload the index, release the bloom filters loaded and lookup again
+        PersistentIndex index(kPersistentIndexDir);
+        ASSERT_OK(index.load(index_meta));
+        check_lookups(index);
+        index.release_cold_memory();
+        check_lookups(index);
+
+        // the released bloom filters are still used to filter upserts
+        config::enable_parallel_get_and_bf = false;
+        index.release_cold_memory();
+        ASSERT_OK(index.prepare(EditVersion(2, 0), N));
+        std::vector<IndexValue> old_values(N, IndexValue(NullIndexValue));
+        IOStat io_stat;
+        ASSERT_OK(index.upsert(N, key_slices.data(), values.data(), old_values.data(), &io_stat));
+        for (int i = 0; i < N; i++) {
+            ASSERT_EQ(values[i], old_values[i]);
+        }
+        ASSERT_OK(index.commit(&index_meta));
+        ASSERT_OK(index.on_commited());
+        config::enable_parallel_get_and_bf = true;
+        check_lookups(index);
+    }
+    config::l0_max_mem_usage = old_l0_max_mem_usage;
+    ASSERT_TRUE(fs::remove_all(kPersistentIndexDir).ok());
+}
+
 TEST_P(PersistentIndexTest, test_multi_l2_tmp_l1) {
     config::l0_max_mem_usage = 50;
     config::max_tmp_l1_num = 10;
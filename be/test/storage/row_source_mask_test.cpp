@@ -229,4 +229,38 @@ TEST_F(RowSourceMaskTest, memory_masks_with_persistence) {
     ASSERT_FALSE(buffer.has_same_source(mask.get_source_num(), 4));
 }
 
+// NOLINTNEXTLINE
+TEST_F(RowSourceMaskTest, shared_reader) {
+    for (int64_t max_memory_bytes : {1L, 1024L * 1024L}) {
+        RowSourceMaskBuffer buffer(1, config::storage_root_path);
+        config::max_row_source_mask_memory_bytes = max_memory_bytes;
+        std::vector<RowSourceMask> source_masks;
+        for (uint16_t i = 0; i < 10; ++i) {
+            source_masks.emplace_back(RowSourceMask(i % 3, i % 2 == 0));
+            if (i % 4 == 3) {
+                ASSERT_TRUE(buffer.write(source_masks).ok());
+                source_masks.clear();
+            }
+        }
+        ASSERT_TRUE(buffer.write(source_masks).ok());
+        ASSERT_TRUE(buffer.flush().ok());
+        ASSERT_TRUE(buffer.flip_to_read().ok());
+
+        auto reader1 = buffer.create_shared_reader();
+        auto reader2 = buffer.create_shared_reader();
+        // interleave reads of the two readers
+        for (uint16_t i = 0; i < 10; ++i) {
+            for (auto* reader : {reader1.get(), reader2.get()}) {
+                ASSERT_TRUE(reader->has_remaining().value());
+                RowSourceMask mask = reader->current();
+                ASSERT_EQ(i % 3, mask.get_source_num());
+                ASSERT_EQ(i % 2 == 0, mask.get_agg_flag());
+                reader->advance();
+            }
+        }
+        ASSERT_FALSE(reader1->has_remaining().value());
+        ASSERT_FALSE(reader2->has_remaining().value());
+    }
+}
+
 } // namespace starrocks
@@ -0,0 +1,281 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "storage/vertical_compaction_task.h"
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include "column/schema.h"
+#include "fs/fs_util.h"
+#include "runtime/mem_tracker.h"
+#include "storage/chunk_helper.h"
+#include "storage/compaction.h"
+#include "storage/compaction_context.h"
+#include "storage/compaction_manager.h"
+#include "storage/default_compaction_policy.h"
+#include "storage/rowset/rowset_factory.h"
+#include "storage/rowset/rowset_writer.h"
+#include "storage/rowset/rowset_writer_context.h"
+#include "storage/storage_engine.h"
+#include "storage/tablet_meta.h"
+#include "storage/tablet_reader.h"
+#include "storage/tablet_reader_params.h"
+#include "testutil/assert.h"
+#include "util/defer_op.h"
+#include "util/threadpool.h"
+
+namespace starrocks {
+
+class VerticalCompactionTaskTest : public testing::Test {
+public:
+    ~VerticalCompactionTaskTest() override {
+        if (_engine) {
+            _engine->stop();
+            delete _engine;
+            _engine = nullptr;
+        }
+    }
+
+    void SetUp() override {
+        config::min_cumulative_compaction_num_singleton_deltas = 2;
+        config::max_cumulative_compaction_num_singleton_deltas = 5;
+        config::max_compaction_concurrency = 1;
+        config::min_base_compaction_num_singleton_deltas = 10;
+        Compaction::init(config::max_compaction_concurrency);
+
+        _default_storage_root_path = config::storage_root_path;
+        config::storage_root_path = std::filesystem::current_path().string() + "/vertical_compaction_task_test";
+        fs::remove_all(config::storage_root_path);
+        ASSERT_TRUE(fs::create_directories(config::storage_root_path).ok());
+        std::vector<StorePath> paths;
+        paths.emplace_back(config::storage_root_path);
+
+        _compaction_mem_tracker = std::make_unique<MemTracker>(-1);
+        starrocks::EngineOptions options;
+        options.store_paths = paths;
+        options.compaction_mem_tracker = _compaction_mem_tracker.get();
+        if (_engine == nullptr) {
+            Status s = starrocks::StorageEngine::open(options, &_engine);
+            ASSERT_TRUE(s.ok()) << s.to_string();
+        }
+        _engine->compaction_manager()->init_max_task_num(1);
+        _engine->compaction_manager()->_disable_update_tablet = true;
+
+        _max_columns_per_group = config::vertical_compaction_max_columns_per_group;
+        _max_parallel_column_groups = config::vertical_compaction_max_parallel_column_groups;
+        // a group per value column
+        config::vertical_compaction_max_columns_per_group = 1;
+        create_tablet_schema();
+    }
+
+    void TearDown() override {
+        config::vertical_compaction_max_columns_per_group = _max_columns_per_group;
+        config::vertical_compaction_max_parallel_column_groups = _max_parallel_column_groups;
+        if (fs::path_exist(config::storage_root_path)) {
+            ASSERT_TRUE(fs::remove_all(config::storage_root_path).ok());
+        }
+        config::storage_root_path = _default_storage_root_path;
+    }
+
+protected:
+    void create_tablet_schema() {
+        TabletSchemaPB tablet_schema_pb;
+        tablet_schema_pb.set_keys_type(DUP_KEYS);
+        tablet_schema_pb.set_num_short_key_columns(1);
+        tablet_schema_pb.set_num_rows_per_row_block(1024);
+        tablet_schema_pb.set_next_column_unique_id(6);
+
+        auto add_column = [&](int32_t uid, const std::string& name, const std::string& type, int32_t length,
+                              bool is_key, bool is_nullable) {
+            ColumnPB* column = tablet_schema_pb.add_column();
+            column->set_unique_id(uid);
+            column->set_name(name);
+            column->set_type(type);
+            column->set_length(length);
+            column->set_is_key(is_key);
+            if (is_key) {
+                column->set_index_length(length);
+            }
+            column->set_is_nullable(is_nullable);
+            column->set_is_bf_column(false);
+        };
+        add_column(1, "k1", "INT", 4, true, false);
+        add_column(2, "v1", "INT", 4, false, false);
+        add_column(3, "v2", "VARCHAR", 20, false, false);
+        add_column(4, "v3", "BIGINT", 8, false, true);
+        add_column(5, "v4", "INT", 4, false, true);
+
+        _tablet_schema = std::make_unique<TabletSchema>(tablet_schema_pb);
+    }
+
+    TabletMetaSharedPtr create_tablet_meta(int64_t tablet_id) {
+        TabletMetaPB tablet_meta_pb;
+        tablet_meta_pb.set_table_id(10000);
+        tablet_meta_pb.set_tablet_id(tablet_id);
+        tablet_meta_pb.set_schema_hash(1111);
+        tablet_meta_pb.set_partition_id(10);
+        tablet_meta_pb.set_shard_id(0);
+        tablet_meta_pb.set_creation_time(1575020449);
+        tablet_meta_pb.set_tablet_state(PB_RUNNING);
+        PUniqueId* tablet_uid = tablet_meta_pb.mutable_tablet_uid();
+        tablet_uid->set_hi(10);
+        tablet_uid->set_lo(tablet_id);
+        _tablet_schema->to_schema_pb(tablet_meta_pb.mutable_schema());
+
+        auto tablet_meta = std::make_shared<TabletMeta>();
+        tablet_meta->init_from_pb(&tablet_meta_pb);
+        return tablet_meta;
+    }
+
+    // The keys of all versions overlap, so the rows of the inputs are interleaved by the merge.
+    void write_version(const TabletMetaSharedPtr& tablet_meta, int64_t version) {
+        int64_t tablet_id = tablet_meta->tablet_id();
+        auto path = fmt::format("{}/data/0/{}/1111", config::storage_root_path, tablet_id);
+        ASSERT_OK(fs::create_directories(path));
+
+        RowsetWriterContext context;
+        RowsetId rowset_id;
+        rowset_id.init(_next_rowset_id++);
+        context.rowset_id = rowset_id;
+        context.tablet_id = tablet_id;
+        context.tablet_schema_hash = 1111;
+        context.partition_id = 10;
+        context.rowset_path_prefix = path;
+        context.rowset_state = VISIBLE;
+        context.tablet_schema = _tablet_schema;
+        context.version = Version(version, version);
+        std::unique_ptr<RowsetWriter> writer;
+        ASSERT_OK(RowsetFactory::create_rowset_writer(context, &writer));
+
+        auto schema = ChunkHelper::convert_schema(_tablet_schema);
+        auto chunk = ChunkHelper::new_chunk(schema, kRowsPerVersion);
+        auto& columns = chunk->columns();
+        for (int32_t i = 0; i < kRowsPerVersion; i++) {
+            int32_t value = static_cast<int32_t>(version * kRowsPerVersion + i);
+            columns[0]->append_datum(Datum(i * 2 + static_cast<int32_t>(version % 2)));
+            columns[1]->append_datum(Datum(value));
+            auto str = fmt::format("v{}", value);
+            columns[2]->append_datum(Datum(Slice(str)));
+            if (value % 7 == 0) {
+                columns[3]->append_nulls(1);
+            } else {
+                columns[3]->append_datum(Datum(static_cast<int64_t>(value) * 3));
+            }
+            if (value % 5 == 0) {
+                columns[4]->append_nulls(1);
+            } else {
+                columns[4]->append_datum(Datum(value % 100));
+            }
+        }
+        ASSERT_OK(writer->add_chunk(*chunk));
+        ASSERT_OK(writer->flush());
+        auto rowset = writer->build();
+        ASSERT_OK(rowset.status());
+        tablet_meta->add_rs_meta((*rowset)->rowset_meta());
+    }
+
+    // Compact the first versions of a new tablet, and return the rows of the output rowset.
+    void compact_and_read(int64_t tablet_id, std::vector<std::string>* rows) {
+        auto tablet_meta = create_tablet_meta(tablet_id);
+        for (int64_t version = 0; version < kNumVersions; version++) {
+            ASSERT_NO_FATAL_FAILURE(write_version(tablet_meta, version));
+        }
+        auto tablet = Tablet::create_tablet_from_meta(tablet_meta, StorageEngine::instance()->get_stores()[0]);
+        ASSERT_OK(tablet->init());
+        auto compaction_context = std::make_unique<CompactionContext>();
+        compaction_context->policy = std::make_unique<DefaultCumulativeBaseCompactionPolicy>(tablet.get());
+        tablet->set_compaction_context(compaction_context);
+
+        ASSERT_TRUE(tablet->need_compaction());
+        auto task = tablet->create_compaction_task();
+        ASSERT_NE(nullptr, task);
+        ASSERT_EQ(VERTICAL_COMPACTION, task->_task_info.algorithm);
+        task->run();
+        ASSERT_NE(COMPACTION_FAILED, task->compaction_task_state());
+
+        // the last version is left to the next cumulative compaction
+        std::vector<Version> versions;
+        tablet->list_versions(&versions);
+        ASSERT_EQ(2, versions.size());
+        ASSERT_EQ(Version(0, kNumVersions - 2), versions[0]);
+
+        auto schema = ChunkHelper::convert_schema(_tablet_schema);
+        TabletReader reader(tablet, versions[0], schema);
+        ASSERT_OK(reader.prepare());
+        TabletReaderParams params;
+        ASSERT_OK(reader.open(params));
+        auto chunk = ChunkHelper::new_chunk(schema, 1024);
+        while (true) {
+            chunk->reset();
+            auto st = reader.get_next(chunk.get());
+            if (st.is_end_of_file()) {
+                break;
+            }
+            ASSERT_OK(st);
+            for (size_t i = 0; i < chunk->num_rows(); i++) {
+                rows->emplace_back(chunk->debug_row(i));
+            }
+        }
+        reader.close();
+        ASSERT_EQ((kNumVersions - 1) * kRowsPerVersion, rows->size());
+    }
+
+    static constexpr int32_t kRowsPerVersion = 1000;
+    static constexpr int64_t kNumVersions = 6;
+
+    StorageEngine* _engine = nullptr;
+    std::shared_ptr<TabletSchema> _tablet_schema;
+    std::unique_ptr<MemTracker> _compaction_mem_tracker;
+    std::string _default_storage_root_path;
+    int64_t _next_rowset_id = 10000;
+    int64_t _max_columns_per_group = 0;
+    int64_t _max_parallel_column_groups = 0;
+};
+
+TEST_F(VerticalCompactionTaskTest, parallel_column_groups) {
+    std::vector<std::string> sequential_rows;
+    config::vertical_compaction_max_parallel_column_groups = 1;
+    ASSERT_NO_FATAL_FAILURE(compact_and_read(20001, &sequential_rows));
+
+    std::vector<std::string> parallel_rows;
+    config::vertical_compaction_max_parallel_column_groups = 4;
+    ASSERT_NO_FATAL_FAILURE(compact_and_read(20002, &parallel_rows));
+    ASSERT_EQ(sequential_rows, parallel_rows);
+}
+
+TEST_F(VerticalCompactionTaskTest, column_group_pool_rejected) {
+    std::vector<std::string> sequential_rows;
+    config::vertical_compaction_max_parallel_column_groups = 1;
+    ASSERT_NO_FATAL_FAILURE(compact_and_read(20003, &sequential_rows));
+
+    // only one merge task is accepted, the other column groups are merged by the compaction thread
+    auto* compaction_manager = _engine->compaction_manager();
+    std::unique_ptr<ThreadPool> pool;
+    ASSERT_OK(ThreadPoolBuilder("test_col_grp").set_max_threads(1).set_max_queue_size(0).build(&pool));
+    compaction_manager->_column_group_pool.swap(pool);
+    DeferOp restore_pool([&] {
+        compaction_manager->_column_group_pool->shutdown();
+        compaction_manager->_column_group_pool.swap(pool);
+    });
+
+    std::vector<std::string> parallel_rows;
+    config::vertical_compaction_max_parallel_column_groups = 4;
+    ASSERT_NO_FATAL_FAILURE(compact_and_read(20004, &parallel_rows));
+    ASSERT_EQ(sequential_rows, parallel_rows);
+}
+
+} // namespace starrocks
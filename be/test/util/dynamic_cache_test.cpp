@@ -86,4 +86,33 @@ TEST(DynamicCacheTest, cache2) {
     }
 }
 
+TEST(DynamicCacheTest, try_shrink) {
+    DynamicCache<int32_t, int64_t> cache(100);
+    for (int i = 0; i < 10; i++) {
+        auto e = cache.get_or_create(i);
+        e->value() = 10;
+        cache.update_object_size(e, 10);
+        cache.release(e);
+    }
+    ASSERT_EQ(100, cache.size());
+    // entry 0 is in use, can not be shrunk
+    auto in_use = cache.get(0);
+    // shrink each object to half of its size, coldest first
+    cache.try_shrink(80, [](int64_t& v) {
+        v /= 2;
+        return (size_t)v;
+    });
+    // entry 1~4 are shrunk
+    ASSERT_EQ(80, cache.size());
+    ASSERT_EQ(10, cache.object_size());
+    ASSERT_EQ(10, in_use->value());
+    cache.release(in_use);
+    auto sizes = cache.get_entry_sizes();
+    size_t nshrunk = 0;
+    for (auto& [key, size] : sizes) {
+        nshrunk += (size == 5);
+    }
+    ASSERT_EQ(4, nshrunk);
+}
+
 } // namespace starrocks
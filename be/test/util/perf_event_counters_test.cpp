@@ -0,0 +1,63 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "util/perf_event_counters.h"
+
+#include <gtest/gtest.h>
+#include <sys/mman.h>
+
+namespace starrocks {
+
+TEST(PerfEventCountersTest, disabled) {
+    // nothing is counted without profile counters.
+    SCOPED_PERF_EVENT_COUNTERS(nullptr);
+}
+
+TEST(PerfEventCountersTest, page_faults) {
+    RuntimeProfile profile("test");
+    auto counters = PerfEventProfileCounters::create(&profile);
+    if (counters == nullptr) {
+        ASSERT_FALSE(PerfEventCounters::is_supported());
+        ASSERT_EQ(nullptr, PerfEventCounters::thread_local_instance());
+        GTEST_SKIP() << "perf events are not supported";
+    }
+    auto* perf_counters = PerfEventCounters::thread_local_instance();
+    ASSERT_NE(nullptr, perf_counters);
+    // only the supported events have counters
+    for (int i = 0; i < PerfEventCounters::NUM_EVENTS; i++) {
+        auto event = static_cast<PerfEventCounters::Event>(i);
+        bool supported = perf_counters->has_event(event);
+        ASSERT_EQ(supported, PerfEventCounters::is_supported(event));
+        ASSERT_EQ(supported, profile.get_counter(PerfEventCounters::event_name(event)) != nullptr);
+        ASSERT_EQ(supported, counters->counter(event) != nullptr);
+    }
+    if (!perf_counters->has_event(PerfEventCounters::PAGE_FAULTS)) {
+        GTEST_SKIP() << "page faults are not supported";
+    }
+
+    const size_t size = 64 * 4096;
+    void* ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    ASSERT_NE(MAP_FAILED, ptr);
+    {
+        SCOPED_PERF_EVENT_COUNTERS(counters.get());
+        // touch every page for the first time.
+        for (size_t i = 0; i < size; i += 4096) {
+            static_cast<volatile char*>(ptr)[i] = 1;
+        }
+    }
+    munmap(ptr, size);
+    ASSERT_GT(counters->counter(PerfEventCounters::PAGE_FAULTS)->value(), 0);
+}
+
+} // namespace starrocks
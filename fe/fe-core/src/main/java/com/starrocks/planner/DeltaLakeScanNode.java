@@ -309,6 +309,8 @@ public class DeltaLakeScanNode extends ScanNode {
 
         if (deltaLakeTable != null) {
             msg.hdfs_scan_node.setTable_name(deltaLakeTable.getName());
+            HdfsScanNode.setQualifiedTableNameToThrift(tHdfsScanNode, deltaLakeTable.getCatalogName(), deltaLakeTable.getDbName(),
+                    deltaLakeTable.getTableName());
         }
 
         HdfsScanNode.setScanOptimizeOptionToThrift(tHdfsScanNode, this);
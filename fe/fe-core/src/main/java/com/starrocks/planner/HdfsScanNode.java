@@ -174,6 +174,8 @@ public class HdfsScanNode extends ScanNode {
         if (hiveTable != null) {
             msg.hdfs_scan_node.setHive_column_names(hiveTable.getDataColumnNames());
             msg.hdfs_scan_node.setTable_name(hiveTable.getName());
+            setQualifiedTableNameToThrift(tHdfsScanNode, hiveTable.getCatalogName(), hiveTable.getDbName(),
+                    hiveTable.getTableName());
         }
 
         setScanOptimizeOptionToThrift(tHdfsScanNode, this);
@@ -190,6 +192,11 @@ public class HdfsScanNode extends ScanNode {
         tHdfsScanNode.setUse_partition_column_value_only(option.getUsePartitionColumnValueOnly());
     }
 
+    public static void setQualifiedTableNameToThrift(THdfsScanNode tHdfsScanNode, String catalogName, String dbName,
+                                                     String tableName) {
+        tHdfsScanNode.setQualified_table_name(String.join(".", catalogName, dbName, tableName));
+    }
+
     public static void setCloudConfigurationToThrift(THdfsScanNode tHdfsScanNode, CloudConfiguration cc) {
         if (cc != null) {
             TCloudConfiguration tCloudConfiguration = new TCloudConfiguration();
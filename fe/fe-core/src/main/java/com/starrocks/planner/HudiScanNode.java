@@ -149,6 +149,8 @@ public class HudiScanNode extends ScanNode {
         if (hudiTable != null) {
             msg.hdfs_scan_node.setHive_column_names(hudiTable.getDataColumnNames());
             msg.hdfs_scan_node.setTable_name(hudiTable.getName());
+            HdfsScanNode.setQualifiedTableNameToThrift(tHdfsScanNode, hudiTable.getCatalogName(), hudiTable.getDbName(),
+                    hudiTable.getTableName());
         }
 
         HdfsScanNode.setScanOptimizeOptionToThrift(tHdfsScanNode, this);
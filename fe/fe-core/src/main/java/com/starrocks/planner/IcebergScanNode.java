@@ -412,6 +412,8 @@ public class IcebergScanNode extends ScanNode {
         msg.hdfs_scan_node.setSql_predicates(sqlPredicates);
 
         msg.hdfs_scan_node.setTable_name(icebergTable.getRemoteTableName());
+        HdfsScanNode.setQualifiedTableNameToThrift(tHdfsScanNode, icebergTable.getCatalogName(),
+                icebergTable.getRemoteDbName(), icebergTable.getRemoteTableName());
         if (!deleteColumnSlotIds.isEmpty()) {
             msg.hdfs_scan_node.setMor_tuple_id(equalityDeleteTupleDesc.getId().asInt());
         }
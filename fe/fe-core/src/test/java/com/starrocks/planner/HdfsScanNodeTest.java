@@ -21,8 +21,10 @@ import com.starrocks.connector.CatalogConnector;
 import com.starrocks.credential.CloudConfiguration;
 import com.starrocks.credential.CloudConfigurationFactory;
 import com.starrocks.server.GlobalStateMgr;
+import com.starrocks.thrift.THdfsScanNode;
 import mockit.Expectations;
 import mockit.Mocked;
+import org.junit.Assert;
 import org.junit.Test;
 
 import java.util.HashMap;
@@ -48,4 +50,11 @@ public class HdfsScanNodeTest {
         desc.setTable(table);
         HdfsScanNode scanNode = new HdfsScanNode(new PlanNodeId(0), desc, "XXX");
     }
-}
\ No newline at end of file
+
+    @Test
+    public void testSetQualifiedTableNameToThrift() {
+        THdfsScanNode tHdfsScanNode = new THdfsScanNode();
+        HdfsScanNode.setQualifiedTableNameToThrift(tHdfsScanNode, "hive_catalog", "db", "tbl");
+        Assert.assertEquals("hive_catalog.db.tbl", tHdfsScanNode.getQualified_table_name());
+    }
+}
@@ -1094,6 +1094,9 @@ struct THdfsScanNode {
 
     // if load column statistics for metadata table scan
     20: optional bool load_column_stats;
+
+    // catalog.db.table of the table it scans, table_name is not unique across dbs and catalogs
+    21: optional string qualified_table_name;
 }
 
 struct TProjectNode {